@@ -10,7 +10,9 @@
 #include "Application.h"
 
 #include "HTTPServer.h"
-#include "JSON.h"
+#include "JSONQuery.h"
+#include "JSONWriter.h"
+#include "KVStore.h"
 #include "MFS.h"
 #include "Shell.h"
 #include "StringStream.h"
@@ -27,6 +29,11 @@ using namespace m8r;
 #define ENABLE_HEARTBEAT
 #define ENABLE_SHELL
 
+static constexpr const char* SettingsDirectory = "/sys";
+// Holds the wifi "ssid" and "password" among other things. They're stored
+// as plain text, so anyone who can read the filesystem can read the password
+static constexpr const char* SettingsPath = "/sys/settings";
+
 SystemInterface* Application::_system = nullptr;
 
 Application::Application(HeartbeatType heartbeatType, const char* webServerRoot, uint16_t shellPort)
@@ -41,6 +48,23 @@ Application::Application(HeartbeatType heartbeatType, const char* webServerRoot,
         system()->setHeartrate(1s);
     }
     
+    // Settings come first so the saved wifi network is used when the
+    // network starts
+    if (mountFileSystem() && system()->fileSystem()->mounted()) {
+        system()->fileSystem()->makeDirectory(SettingsDirectory);
+        _settings = std::make_unique<KVStore>(system()->fileSystem(), SettingsPath);
+        if (_settings->load()) {
+            String ssid;
+            String password;
+            if (_settings->get("ssid", ssid) && !ssid.empty()) {
+                _settings->get("password", password);
+                system()->setSSID(ssid, password);
+            }
+        } else {
+            system()->print(Error::formatError(_settings->error().code(), "Unable to load settings, starting over").c_str());
+        }
+    }
+
     _webServerRoot = webServerRoot;
     _shellPort = shellPort;
     if (!_webServerRoot.empty() || _shellPort != 0) {
@@ -50,8 +74,6 @@ Application::Application(HeartbeatType heartbeatType, const char* webServerRoot,
     if (heartbeatType == HeartbeatType::Status) {
         system()->setHeartrate(3s);
     }
-    
-    mountFileSystem();
 
     // Start things running
     system()->printf("\n*** m8rscript v%d.%d - %s\n", MajorVersion, MinorVersion, __TIMESTAMP__);
@@ -64,15 +86,25 @@ Application::Application(HeartbeatType heartbeatType, const char* webServerRoot,
     }
 }
 
+Application::Application(SystemOnly)
+{
+    assert(!_system);
+    _system = SystemInterface::create();
+}
+
 Application::~Application()
 {
+    // Unflushed settings go out while there's still a filesystem
+    _settings.reset();
     delete _system;
 }
 
 void Application::runAutostartTask(const char* filename)
 {
+    // The script is read on the AsyncIO worker, so a big one doesn't hold
+    // up the main loop. The task waits until it's loaded
     SharedPtr<Task> task(new Task);
-    task->load(filename);
+    task->loadAsync(filename);
     runAutostartTaskHelper(task);
 }
 
@@ -114,24 +146,55 @@ void Application::startNetworkServers()
         _webServer = std::make_unique<HTTPServer>(80, _webServerRoot.c_str());
         _webServer->on("/", "index.html");
         _webServer->on("/favicon.ico", "favicon.ico");
-        _webServer->on("/rest/v1/", [](const String& uri, const String& suffix, const HTTPServer::Request& request, int16_t connectionId)
+        _webServer->on("/rest/v1/", [this](const String& uri, const String& suffix, const HTTPServer::Request& request, int16_t connectionId)
         {
-            JSON json;
-            
+            // Responses are JSON or CBOR depending on the Accept header
             if (suffix == "getSSIDList") {
                 Vector<String> ssidList = system()->ssidList();
-                return json.stringify(ssidList);
-            } else if (suffix == "getCurrentSSID") {
-                String ssid = system()->currentSSID();
-                return json.stringify(ssid);
+                _webServer->sendJSON(connectionId, request, [&ssidList](JSONWriter& writer) {
+                    writer.startArray();
+                    for (const auto& it : ssidList) {
+                        writer.value(it);
+                    }
+                    writer.endArray();
+                });
+                return String();
+            }
+            
+            String result;
+            if (suffix == "getCurrentSSID") {
+                result = system()->currentSSID();
             } else if (suffix == "setSSID") {
-                String ssid = request.params.find("ssid")->value;
-                String password = request.params.find("password")->value;
+                // Take the values from the query string or from a JSON body
+                String ssid;
+                String password;
+                auto it = request.params.find("ssid");
+                if (it != request.params.end()) {
+                    ssid = it->value;
+                    it = request.params.find("password");
+                    if (it != request.params.end()) {
+                        password = it->value;
+                    }
+                } else {
+                    JSONQuery query(request.body.c_str(), request.body.size());
+                    query.getString("/ssid", ssid);
+                    query.getString("/password", password);
+                }
                 system()->setSSID(ssid, password);
-                
-                return json.stringify(ssid);
+                if (_settings) {
+                    _settings->set("ssid", ssid);
+                    _settings->set("password", password);
+                    _settings->flush();
+                }
+                result = ssid;
+            } else {
+                result = "*** unimplemented ***";
             }
-            return json.stringify("*** unimplemented ***");
+            
+            _webServer->sendJSON(connectionId, request, [&result](JSONWriter& writer) {
+                writer.value(result);
+            });
+            return String();
         });
     }
 
@@ -201,6 +264,9 @@ bool Application::runOneIteration()
             case SystemInterface::Event::NetworkStarted:
                 startNetworkServers();
                 break;
+            case SystemInterface::Event::FSChanged:
+                FS::dispatchChanges();
+                break;
             default:
                 break;
         }
@@ -212,6 +278,9 @@ bool Application::runOneIteration()
     if (_webServer) {
         _webServer->handleEvents();
     }
+    if (_settings) {
+        _settings->runOneIteration();
+    }
     return system()->runOneIteration();
 }
 
@@ -220,6 +289,7 @@ void Application::uploadFiles(const Vector<const char*>& files, const char* dest
 #ifdef __APPLE__
     // This function is used to upload files from the real MacOS filesystem to the
     // LittleFS based virtual filesystem. On ESP do nothing
+    static constexpr size_t UploadBufferSize = 4096;
     
     for (const auto it : files) {
         m8r::String toPath;
@@ -252,25 +322,24 @@ void Application::uploadFiles(const Vector<const char*>& files, const char* dest
                                                             "Error: unable to open '%s'", toPath.c_str()).c_str());
                 } else {
                     bool success = true;
+                    char buf[UploadBufferSize];
                     while (1) {
-                        char c;
-                        size_t size = fread(&c, 1, 1, fromFile);
-                        if (size != 1) {
-                            if (!feof(fromFile)) {
+                        size_t size = fread(buf, 1, sizeof(buf), fromFile);
+                        if (size == 0) {
+                            if (ferror(fromFile)) {
                                 fprintf(stderr, "Error reading '%s', upload failed\n", it);
                                 success = false;
                             }
                             break;
                         }
                         
-                        toFile->write(c);
-                        if (!toFile->valid()) {
+                        if (toFile->write(buf, static_cast<uint32_t>(size)) != static_cast<int32_t>(size)) {
                             fprintf(stderr, "Error writing '%s', upload failed\n", toPath.c_str());
                             success = false;
                             break;
                         }
                     }
-                    toFile->close();
+                    m8r::system()->fileSystem()->release(toFile);
                     if (success) {
                         printf("Uploaded '%s' to '%s'\n", it, toPath.c_str());
                     }
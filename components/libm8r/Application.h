@@ -18,6 +18,7 @@ namespace m8r {
 class Error;
 class FS;
 class HTTPServer;
+class KVStore;
 
 class Application {
 public:
@@ -25,6 +26,12 @@ public:
     
     Application(HeartbeatType = HeartbeatType::None, const char* webServerRoot = nullptr, uint16_t shellPort = 0);
     
+    // Only creates the SystemInterface. Nothing is mounted, started or
+    // printed. For host tools, like the image builders, that need system()
+    // but mustn't touch the device filesystem
+    struct SystemOnly { };
+    Application(SystemOnly);
+    
     ~Application();
     
     void runAutostartTask(const SharedPtr<Executable>& exec);
@@ -43,6 +50,9 @@ public:
 
     bool mountFileSystem();
     
+    // Settings kept in flash, like the SSID. Null if there's no filesystem
+    KVStore* settings() { return _settings.get(); }
+    
     static void uploadFiles(const Vector<const char*>& files, const char* destPath);
     
     static SystemInterface* system() { assert(_system); return _system; }
@@ -54,6 +64,7 @@ private:
     SharedPtr<Task> _autostartTask;
     std::unique_ptr<Terminal> _terminal;
     std::unique_ptr<HTTPServer> _webServer;
+    std::unique_ptr<KVStore> _settings;
 
     String _webServerRoot;
     uint16_t _shellPort = 0;
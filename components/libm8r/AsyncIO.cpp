@@ -0,0 +1,160 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "AsyncIO.h"
+
+#include "MFS.h"
+#include "SystemInterface.h"
+#include "Task.h"
+
+using namespace m8r;
+
+void AsyncIO::stop()
+{
+    if (_started && !_stopping) {
+        {
+            Lock lock(_mutex);
+            _stopping = true;
+            _condition.notify();
+        }
+        _thread.join();
+    }
+
+    // Anything left never completes
+    for (auto it : _requests) {
+        it.destroy(MemoryType::Native);
+    }
+    for (auto it : _completions) {
+        it.destroy(MemoryType::Native);
+    }
+    _requests.clear();
+    _completions.clear();
+    _pending = 0;
+}
+
+void AsyncIO::read(Mad<File> file, char* buf, uint32_t size, Completion completion)
+{
+    submit(Op::Read, file, buf, size, completion, SharedPtr<Task>());
+}
+
+void AsyncIO::write(Mad<File> file, const char* buf, uint32_t size, Completion completion)
+{
+    submit(Op::Write, file, const_cast<char*>(buf), size, completion, SharedPtr<Task>());
+}
+
+void AsyncIO::read(Mad<File> file, char* buf, uint32_t size, Completion completion, const SharedPtr<Task>& waiter)
+{
+    submit(Op::Read, file, buf, size, completion, waiter);
+}
+
+void AsyncIO::write(Mad<File> file, const char* buf, uint32_t size, Completion completion, const SharedPtr<Task>& waiter)
+{
+    submit(Op::Write, file, const_cast<char*>(buf), size, completion, waiter);
+}
+
+void AsyncIO::submit(Op op, Mad<File> file, char* buf, uint32_t size, Completion completion, const SharedPtr<Task>& waiter)
+{
+    if (_stopping) {
+        return;
+    }
+
+    // Start the worker on first use so nothing is spent on it if it's never needed
+    if (!_started) {
+        _started = true;
+        _thread = Thread(WorkerStackSize, [this] { run(); });
+    }
+
+    Mad<Request> request = Mad<Request>::create(MemoryType::Native);
+    request->op = op;
+    request->file = file;
+    request->buf = buf;
+    request->size = size;
+    request->result = -1;
+    request->completion = completion;
+    request->waiter = waiter;
+
+    ++_pending;
+    if (waiter) {
+        system()->taskManager()->suspend(waiter);
+    }
+
+    Lock lock(_mutex);
+    _requests.push_back(request);
+    _condition.notify();
+}
+
+bool AsyncIO::dispatchCompletions()
+{
+    if (!_pending) {
+        return false;
+    }
+
+    Vector<Mad<Request>> completions;
+    {
+        Lock lock(_mutex);
+        completions.swap(_completions);
+    }
+
+    for (auto it : completions) {
+        --_pending;
+        if (it->completion) {
+            it->completion(it->result);
+        }
+        if (it->waiter) {
+            system()->taskManager()->wake(it->waiter);
+        }
+        it.destroy(MemoryType::Native);
+    }
+    return !completions.empty();
+}
+
+int32_t AsyncIO::transfer(Request* request)
+{
+    if (!request->file.valid()) {
+        return -1;
+    }
+    
+    uint32_t done = 0;
+    while (done < request->size) {
+        uint32_t size = std::min(request->size - done, static_cast<uint32_t>(ChunkSize));
+        int32_t result = (request->op == Op::Read) ? request->file->read(request->buf + done, size)
+                                                   : request->file->write(request->buf + done, size);
+        if (result < 0) {
+            return done ? static_cast<int32_t>(done) : result;
+        }
+        done += result;
+        if (static_cast<uint32_t>(result) < size) {
+            break;
+        }
+    }
+    return static_cast<int32_t>(done);
+}
+
+void AsyncIO::run()
+{
+    Lock lock(_mutex);
+    while (true) {
+        while (_requests.empty() && !_stopping) {
+            _condition.wait(lock);
+        }
+        if (_stopping) {
+            break;
+        }
+
+        Mad<Request> request = _requests.front();
+        _requests.pop_front();
+
+        // Let the main loop queue more requests and take completions while this one runs
+        _mutex.unlock();
+        request->result = transfer(request.get());
+        _mutex.lock();
+
+        _completions.push_back(request);
+    }
+}
@@ -0,0 +1,107 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Containers.h"
+#include "Mallocator.h"
+#include "SharedPtr.h"
+#include "Thread.h"
+#include <functional>
+
+namespace m8r {
+
+class File;
+class Task;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: AsyncIO
+//
+//  Runs file reads and writes on a worker thread so a slow flash operation
+//  doesn't stall the main loop. Completions are delivered on the main loop
+//  from dispatchCompletions(), which SystemInterface calls every iteration.
+//
+//  The file and buffer belong to the worker until the completion runs, so
+//  they must not be touched or released before then. Requests on the same
+//  file run in the order they were made.
+//
+//  The main loop keeps using the filesystem while the worker runs, so a
+//  filesystem's files can only be passed here if it locks around every
+//  call. LittleFS and RamFS do, and RomFS files are read only and share
+//  nothing, so any file from the VFS will do.
+//
+//  The worker uses the filesystems of the SystemInterface that owns this,
+//  which are destroyed before it is. So each SystemInterface calls stop()
+//  in its destructor.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class AsyncIO {
+public:
+    // Passed the value returned by File::read or File::write
+    using Completion = std::function<void(int32_t result)>;
+
+    static constexpr uint32_t WorkerStackSize = 4096;
+    
+    // Big requests are done in pieces this size, so the filesystem lock is
+    // given up between them and the main loop can get at other files
+    static constexpr uint32_t ChunkSize = 1024;
+
+    AsyncIO() { }
+    ~AsyncIO() { stop(); }
+
+    void read(Mad<File>, char* buf, uint32_t size, Completion);
+    void write(Mad<File>, const char* buf, uint32_t size, Completion);
+
+    // The waiter doesn't run until the completion has. If it was
+    // WaitingForEvent it is Ready after that
+    void read(Mad<File>, char* buf, uint32_t size, Completion, const SharedPtr<Task>& waiter);
+    void write(Mad<File>, const char* buf, uint32_t size, Completion, const SharedPtr<Task>& waiter);
+
+    // Returns true if any completions were run
+    bool dispatchCompletions();
+
+    uint16_t pending() const { return _pending; }
+
+    // Waits for the worker to finish the request it's on and ends it.
+    // Requests not yet started and completions not yet run are dropped
+    void stop();
+
+private:
+    enum class Op { Read, Write };
+
+    // Created and destroyed on the main loop. The worker only touches
+    // file, buf, size and result
+    struct Request
+    {
+        Op op;
+        Mad<File> file;
+        char* buf;
+        uint32_t size;
+        int32_t result;
+        Completion completion;
+        SharedPtr<Task> waiter;
+    };
+
+    void submit(Op, Mad<File>, char* buf, uint32_t size, Completion, const SharedPtr<Task>&);
+    int32_t transfer(Request*);
+    void run();
+
+    Mutex _mutex;
+    Condition _condition;
+    Vector<Mad<Request>> _requests;
+    Vector<Mad<Request>> _completions;
+    Thread _thread;
+    uint16_t _pending = 0;
+    bool _started = false;
+    bool _stopping = false;
+};
+
+}
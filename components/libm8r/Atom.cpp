@@ -8,11 +8,14 @@
 -------------------------------------------------------------------------*/
 
 #include "Atom.h"
+
+#include "MFS.h"
+#include "SystemInterface.h"
 #include <algorithm>
 
 using namespace m8r;
 
-static int32_t binarySearch(const char** names, uint16_t nelts, const char* value)
+static int32_t binarySearch(const char* const* names, uint16_t nelts, const char* value)
 {
     int32_t first = 0;
     int32_t last = nelts - 1;
@@ -32,41 +35,70 @@ static int32_t binarySearch(const char** names, uint16_t nelts, const char* valu
     return -1;
 }
 
-// Check that p and s are the same up to and including the '\0' at the end of s
-static bool atomcomp(const char* p, const char* s)
-{
-    while (1) {
-        if (*p++ != *s++) {
-            return false;
-        }
-        if (*s == '\0') {
-            return *p == '\0';
-        }
-    }
-}
+// Sorted, so it also works with setSharedAtomList(list, count)
+static constexpr const char* SharedAtomStrings[] = {
+    "Array",
+    "Boolean",
+    "Function",
+    "Iterator",
+    "JSON",
+    "Math",
+    "Number",
+    "Object",
+    "String",
+    "arguments",
+    "console",
+    "constructor",
+    "done",
+    "length",
+    "next",
+    "parse",
+    "print",
+    "println",
+    "prototype",
+    "stringify",
+    "toString",
+    "value",
+};
 
-static const char* atomfind(const char* buf, size_t size, const char* atom)
-{
-    const char* end = buf + size;
-    const char* p = buf;
-    while (p < end) {
-        if (*p == *atom) {
-            if (atomcomp(p, atom)) {
-                // We know the substrings match fully. and we know that
-                // the char at the end of p is a '\0'. But we need to also
-                // make sure the char before p is '\0'
-                if (p == buf || p[-1] == '\0') {
-                    return p;
-                }
-            }
-        }
-        ++p;
-    }
-    return nullptr;
-}
+static constexpr uint16_t SharedAtomCount = sizeof(SharedAtomStrings) / sizeof(const char*);
+static constexpr SharedAtomTable<SharedAtomCount> SharedAtoms(SharedAtomStrings);
+
+static constexpr bool isShared(const char* s, SA sa) { return SharedAtoms.id(s) == static_cast<int32_t>(sa); }
+
+static_assert(SharedAtoms.valid(), "Shared atom hash failed");
+static_assert(SharedAtomCount == static_cast<uint16_t>(SA::Count), "SA and SharedAtomStrings differ");
+static_assert(isShared("Array", SA::Array), "");
+static_assert(isShared("Boolean", SA::Boolean), "");
+static_assert(isShared("Function", SA::Function), "");
+static_assert(isShared("Iterator", SA::Iterator), "");
+static_assert(isShared("JSON", SA::JSON), "");
+static_assert(isShared("Math", SA::Math), "");
+static_assert(isShared("Number", SA::Number), "");
+static_assert(isShared("Object", SA::Object), "");
+static_assert(isShared("String", SA::String), "");
+static_assert(isShared("arguments", SA::arguments), "");
+static_assert(isShared("console", SA::console), "");
+static_assert(isShared("constructor", SA::constructor), "");
+static_assert(isShared("done", SA::done), "");
+static_assert(isShared("length", SA::length), "");
+static_assert(isShared("next", SA::next), "");
+static_assert(isShared("parse", SA::parse), "");
+static_assert(isShared("print", SA::print), "");
+static_assert(isShared("println", SA::println), "");
+static_assert(isShared("prototype", SA::prototype), "");
+static_assert(isShared("stringify", SA::stringify), "");
+static_assert(isShared("toString", SA::toString), "");
+static_assert(isShared("value", SA::value), "");
+
+// Ids of shared atoms can end up in snapshots and anything else saved
+// outside the image. Adding, removing or reordering atoms changes this.
+// Only update it when that's intended
+static_assert(SharedAtoms.fingerprint() == 0xfbc2cdd8, "Shared atom ids changed");
 
 AtomTable::AtomTable()
 {
+    setSharedAtomList(SharedAtoms.hash());
 }
 
 Atom AtomTable::atomizeString(const char* str) const
@@ -77,35 +109,314 @@ Atom AtomTable::atomizeString(const char* str) const
     }
     
     uint16_t len = strlen(str);
+    uint16_t offset = static_cast<uint16_t>(_table.size());
     
-    Atom a(static_cast<Atom::value_type>(_table.size() + ExternalAtomOffset));
+    // Atom ids for the string table must fit between ExternalAtomOffset and NoId
+    assert(static_cast<uint32_t>(offset) + len + 1 < NoEntry - ExternalAtomOffset);
+    
+    // Grow before adding the new string, since growing rehashes everything in the table
+    if ((static_cast<uint32_t>(_atomCount) + 1) * 4 > _hashTable.size() * 3) {
+        growHashTable();
+    }
+    
+    Atom a(static_cast<Atom::value_type>(offset + ExternalAtomOffset));
     _table.reserve(_table.size() + len + 1);
     for (uint16_t i = 0; i < len; ++i) {
         _table.push_back(str[i]);
     }
     _table.push_back('\0');
+    
+    addToHashTable(offset);
+    ++_atomCount;
     return a;
 }
 
 Atom AtomTable::findAtom(const char* s) const
 {
+    uint32_t hash = hashString(s);
+    
     // First look in the sharedAtom table, if any
     int32_t result = -1;
-    if (_sharedAtoms) {
+    if (_sharedAtomHash.valid()) {
+        uint16_t index = _sharedAtomHash.lookup(hash);
+        if (::strcmp(_sharedAtoms[index], s) == 0) {
+            result = index;
+        }
+    } else if (_sharedAtoms) {
         result = binarySearch(_sharedAtoms, _sharedAtomCount, s);
     }
    if (result >= 0) {
         return Atom(static_cast<Atom::value_type>(result));
     }
     
-    if (_table.size()) {
-        const char* p = atomfind(&(_table[0]), _table.size(), s);
-        if (p) {
-            return Atom(static_cast<Atom::value_type>(p - &(_table[0]) + ExternalAtomOffset));
+    if (_hashTable.empty()) {
+        return Atom();
+    }
+    
+    uint32_t mask = static_cast<uint32_t>(_hashTable.size()) - 1;
+    for (uint32_t i = hash & mask; ; i = (i + 1) & mask) {
+        uint16_t offset = _hashTable[i];
+        if (offset == NoEntry) {
+            return Atom();
+        }
+        const char* p = &(_table[offset]);
+        if (*p == *s && ::strcmp(p, s) == 0) {
+            return Atom(static_cast<Atom::value_type>(offset + ExternalAtomOffset));
+        }
+    }
+}
+
+void AtomTable::addToHashTable(uint16_t offset) const
+{
+    uint32_t mask = static_cast<uint32_t>(_hashTable.size()) - 1;
+    uint32_t i = hashString(&(_table[offset])) & mask;
+    while (_hashTable[i] != NoEntry) {
+        i = (i + 1) & mask;
+    }
+    _hashTable[i] = offset;
+}
+
+void AtomTable::growHashTable() const
+{
+    uint16_t size = _hashTable.empty() ? MinHashTableSize : static_cast<uint16_t>(_hashTable.size() * 2);
+    _hashTable.resize(size);
+    for (auto& it : _hashTable) {
+        it = NoEntry;
+    }
+    
+    // Atoms are stored back to back, each terminated by a '\0', so walk
+    // the string table to rehash them all
+    uint16_t offset = 0;
+    while (offset < _table.size()) {
+        addToHashTable(offset);
+        offset += strlen(&(_table[offset])) + 1;
+    }
+}
+
+uint32_t AtomTable::contentHash() const
+{
+    uint32_t hash = 2166136261u;
+    for (auto it : _table) {
+        hash = (hash ^ static_cast<uint8_t>(it)) * 16777619u;
+    }
+    for (auto it : _hashTable) {
+        hash = (hash ^ static_cast<uint8_t>(it)) * 16777619u;
+        hash = (hash ^ static_cast<uint8_t>(it >> 8)) * 16777619u;
+    }
+    return hash;
+}
+
+// Make sure a loaded snapshot can't send lookups outside the tables
+bool AtomTable::validate() const
+{
+    if (_table.empty()) {
+        return _hashTable.empty() && _atomCount == 0;
+    }
+    
+    // Ids are ExternalAtomOffset plus the offset in the table, so a table
+    // this big would have ids that don't fit
+    if (_table.size() >= MaxTableSize) {
+        return false;
+    }
+    
+    if (_table.back() != '\0' || _hashTable.size() < MinHashTableSize || (_hashTable.size() & (_hashTable.size() - 1)) != 0) {
+        return false;
+    }
+    
+    if (static_cast<uint32_t>(_atomCount) * 4 > _hashTable.size() * 3) {
+        return false;
+    }
+    
+    uint16_t count = 0;
+    for (auto it : _hashTable) {
+        if (it == NoEntry) {
+            continue;
+        }
+        if (it >= _table.size() || (it > 0 && _table[it - 1] != '\0')) {
+            return false;
         }
+        ++count;
+    }
+    return count == _atomCount;
+}
+
+void AtomTable::clear()
+{
+    _table.clear();
+    _hashTable.clear();
+    _atomCount = 0;
+}
+
+static void putUInt(uint8_t*& buf, uint32_t value, uint8_t bytes)
+{
+    for (uint8_t i = 0; i < bytes; ++i) {
+        *buf++ = static_cast<uint8_t>(value >> (i * 8));
+    }
+}
+
+static uint32_t getUInt(const uint8_t*& buf, uint8_t bytes)
+{
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < bytes; ++i) {
+        value |= static_cast<uint32_t>(*buf++) << (i * 8);
+    }
+    return value;
+}
+
+// The hash table is written and read in bulk straight from its storage,
+// which is already little endian on the ESP and the Mac
+static void swapHashTable(Vector<uint16_t>& table)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    for (auto& it : table) {
+        it = static_cast<uint16_t>((it << 8) | (it >> 8));
+    }
+#else
+    (void) table;
+#endif
+}
+
+void AtomTable::SnapshotHeader::encode(uint8_t* buf) const
+{
+    putUInt(buf, magic, 4);
+    putUInt(buf, version, 2);
+    putUInt(buf, atomCount, 2);
+    putUInt(buf, tableSize, 2);
+    putUInt(buf, hashTableSize, 2);
+    putUInt(buf, contentHash, 4);
+}
+
+bool AtomTable::SnapshotHeader::decode(const uint8_t* buf)
+{
+    magic = getUInt(buf, 4);
+    version = static_cast<uint16_t>(getUInt(buf, 2));
+    atomCount = static_cast<uint16_t>(getUInt(buf, 2));
+    tableSize = static_cast<uint16_t>(getUInt(buf, 2));
+    hashTableSize = static_cast<uint16_t>(getUInt(buf, 2));
+    contentHash = getUInt(buf, 4);
+    return magic == SnapshotMagic && version == SnapshotVersion && tableSize < MaxTableSize;
+}
+
+bool AtomTable::save(const char* filename) const
+{
+    if (!system()->fileSystem()) {
+        return false;
+    }
+    
+    Mad<File> file = system()->fileSystem()->open(filename, FS::FileOpenMode::Write);
+    if (!file->valid()) {
+        system()->fileSystem()->release(file);
+        return false;
+    }
+    
+    SnapshotHeader header;
+    header.magic = SnapshotMagic;
+    header.version = SnapshotVersion;
+    header.atomCount = _atomCount;
+    header.tableSize = static_cast<uint16_t>(_table.size());
+    header.hashTableSize = static_cast<uint16_t>(_hashTable.size());
+    header.contentHash = contentHash();
+    
+    uint8_t buf[SnapshotHeaderSize];
+    header.encode(buf);
+    bool success = file->write(reinterpret_cast<const char*>(buf), SnapshotHeaderSize) == SnapshotHeaderSize;
+    if (success && header.tableSize) {
+        int32_t size = header.tableSize;
+        success = file->write(_table.begin(), size) == size;
+    }
+    if (success && header.hashTableSize) {
+        int32_t size = header.hashTableSize * sizeof(uint16_t);
+        swapHashTable(_hashTable);
+        success = file->write(reinterpret_cast<const char*>(_hashTable.begin()), size) == size;
+        swapHashTable(_hashTable);
     }
     
-    return Atom();
+    system()->fileSystem()->release(file);
+    return success;
+}
+
+bool AtomTable::load(const char* filename)
+{
+    if (!system()->fileSystem()) {
+        return false;
+    }
+    
+    // A filesystem that holds its files in addressable memory, like a
+    // RomFS, gives the snapshot in place, so the tables are copied
+    // straight out of it. Otherwise they're read from the file
+    FS::Mapping mapping;
+    if (system()->fileSystem()->map(filename, mapping)) {
+        return loadMapped(mapping);
+    }
+    return loadFile(filename);
+}
+
+bool AtomTable::loadMapped(const FS::Mapping& mapping)
+{
+    SnapshotHeader header;
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(mapping.data);
+    if (mapping.size < SnapshotHeaderSize || !header.decode(data) || mapping.size != header.fileSize()) {
+        clear();
+        return false;
+    }
+    
+    data += SnapshotHeaderSize;
+    _table.resize(header.tableSize);
+    _hashTable.resize(header.hashTableSize);
+    if (header.tableSize) {
+        memcpy(_table.begin(), data, header.tableSize);
+    }
+    if (header.hashTableSize) {
+        memcpy(_hashTable.begin(), data + header.tableSize, header.hashTableSize * sizeof(uint16_t));
+    }
+    return finishLoad(header);
+}
+
+bool AtomTable::loadFile(const char* filename)
+{
+    Mad<File> file = system()->fileSystem()->open(filename, FS::FileOpenMode::Read);
+    if (!file->valid()) {
+        system()->fileSystem()->release(file);
+        return false;
+    }
+
+    uint8_t buf[SnapshotHeaderSize];
+    SnapshotHeader header;
+    bool success = file->read(reinterpret_cast<char*>(buf), SnapshotHeaderSize) == SnapshotHeaderSize &&
+                   header.decode(buf) && file->size() == static_cast<int32_t>(header.fileSize());
+    
+    if (success) {
+        // Read each table in one go directly into its storage
+        _table.resize(header.tableSize);
+        _hashTable.resize(header.hashTableSize);
+        
+        if (header.tableSize) {
+            int32_t size = header.tableSize;
+            success = file->read(_table.begin(), size) == size;
+        }
+        if (success && header.hashTableSize) {
+            int32_t size = header.hashTableSize * sizeof(uint16_t);
+            success = file->read(reinterpret_cast<char*>(_hashTable.begin()), size) == size;
+        }
+    }
+
+    system()->fileSystem()->release(file);
+    if (!success) {
+        clear();
+        return false;
+    }
+    return finishLoad(header);
+}
+
+bool AtomTable::finishLoad(const SnapshotHeader& header)
+{
+    swapHashTable(_hashTable);
+    _atomCount = header.atomCount;
+    if (contentHash() != header.contentHash || !validate()) {
+        clear();
+        return false;
+    }
+    return true;
 }
 
 const char* AtomTable::stringFromAtom(const Atom atom) const
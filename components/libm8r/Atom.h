@@ -10,6 +10,7 @@
 #pragma once
 
 #include "Containers.h"
+#include "MFS.h"
 #include "MString.h"
 
 namespace m8r {
@@ -20,18 +21,25 @@ class Stream;
 //
 //  Class: AtomTable
 //
-//  Atoms go in a single string where each atom is preceeded by its size.
-//  Size byte is negated so its high order bit is set to identify it as
-//  a size. So max size of an individual atom is 127 bytes.
+//  Atoms go in a single string where each atom is terminated by a '\0'.
+//  Max size of an individual atom is 127 bytes.
 //
-//  Atoms are a 16 bit id, so 64K maximum. For non built-in Atoms, this
-//  id is the index into the string table. Given an average size of 8
-//  characters per atom, that can hold around 8000 Atoms.
+//  Atoms are a 16 bit id. Ids from ExternalAtomOffset up are non built-in
+//  Atoms, and the id minus ExternalAtomOffset is the atom's index into the
+//  string table. That leaves 32K for the table. Given an average size of
+//  8 characters plus the '\0' per atom, that can hold around 3600 Atoms.
+//
+//  Lookup of non built-in Atoms goes through an open addressing hash
+//  table (linear probing). Each slot holds the offset of an atom in the
+//  string table, or NoEntry if empty. The hash table is always a power
+//  of 2 in size and is kept no more than 3/4 full.
 //
 //  Predefined Atoms, those in the SA enum, have a table of their own
 //  which is a simple array of char pointers. These will have an Atom
 //  id which matches their enumerant. We'll make space for 500 of these
-//  ids, so the normal Atom Ids will be offset by that amount.
+//  ids, so the normal Atom Ids will be offset by that amount. The shared
+//  table is either a sorted list searched with a binary search or a
+//  SharedAtomTable, which is a perfect hash built at compile time.
 //
 //************************************************************************
 
@@ -49,6 +57,53 @@ public:
     friend int compare(const Atom& a, const Atom& b) { return int(a - b); }
 };
 
+//************************************************************************
+//
+//  Struct: SharedAtomHash
+//
+//  ROM resident view of a SharedAtomTable. Atoms are split into count
+//  buckets by their string hash. Each bucket has a displacement which
+//  maps the atoms in it to distinct entries of the slots array. Each
+//  slot holds the index of its atom in the atoms list, which is its
+//  Atom id.
+//
+//************************************************************************
+
+struct SharedAtomHash
+{
+    constexpr SharedAtomHash() { }
+    constexpr SharedAtomHash(const char* const* a, const uint16_t* d, const uint16_t* s, uint16_t n)
+        : atoms(a)
+        , displacements(d)
+        , slots(s)
+        , count(n)
+    { }
+    
+    static constexpr uint32_t mix(uint32_t hash, uint16_t displacement)
+    {
+        hash += static_cast<uint32_t>(displacement) * 0x9e3779b9u;
+        hash ^= hash >> 16;
+        hash *= 0x85ebca6bu;
+        hash ^= hash >> 13;
+        hash *= 0xc2b2ae35u;
+        hash ^= hash >> 16;
+        return hash;
+    }
+    
+    // Return the index of the atom in atoms which might match the passed hash
+    constexpr uint16_t lookup(uint32_t hash) const
+    {
+        return slots[mix(hash, displacements[hash % count]) % count];
+    }
+    
+    constexpr bool valid() const { return slots != nullptr; }
+    
+    const char* const* atoms = nullptr;
+    const uint16_t* displacements = nullptr;
+    const uint16_t* slots = nullptr;
+    uint16_t count = 0;
+};
+
 class AtomTable {
 public:
     
@@ -58,18 +113,295 @@ public:
 
     const char* stringFromAtom(const Atom) const;
     
-    void setSharedAtomList(const char** list, uint16_t count) { _sharedAtoms = list; _sharedAtomCount = count; }
+    // List must be sorted. Replaces any SharedAtomHash
+    void setSharedAtomList(const char* const* list, uint16_t count)
+    {
+        _sharedAtomHash = SharedAtomHash();
+        _sharedAtoms = list;
+        _sharedAtomCount = count;
+    }
+    
+    void setSharedAtomList(const SharedAtomHash& hash)
+    {
+        _sharedAtomHash = hash;
+        _sharedAtoms = hash.atoms;
+        _sharedAtomCount = hash.count;
+    }
+    
+    // Save the external atoms and their hash index to a file, so they can be
+    // restored at startup with a single read instead of atomizing each one again.
+    // Loading replaces any external atoms. Snapshot is validated with a content
+    // hash and rejected if it doesn't match.
+    bool save(const char* filename) const;
+    bool load(const char* filename);
+    
+    // FNV-1a hash of a '\0' terminated string
+    static constexpr uint32_t hashString(const char* s)
+    {
+        uint32_t hash = 2166136261u;
+        while (*s) {
+            hash = (hash ^ static_cast<uint8_t>(*s++)) * 16777619u;
+        }
+        return hash;
+    }
         
 private:
     Atom findAtom(const char* s) const;
+    
+    void addToHashTable(uint16_t offset) const;
+    void growHashTable() const;
+    
+    uint32_t contentHash() const;
+    bool validate() const;
+    void clear();
+    
+    bool loadMapped(const FS::Mapping&);
+    bool loadFile(const char* filename);
 
     static constexpr uint8_t MaxAtomSize = 127;
+    static constexpr uint16_t NoEntry = std::numeric_limits<uint16_t>::max();
+    static constexpr uint16_t MinHashTableSize = 64;
+    
+    // External atom ids run from ExternalAtomOffset to NoEntry, which
+    // bounds the string table
+    static constexpr uint16_t MaxTableSize = NoEntry - ExternalAtomOffset;
+    
+    // Snapshot file header. Followed by the string table then the hash
+    // table. Everything in the file is little endian. The header is
+    // SnapshotHeaderSize bytes: magic, version, atomCount, tableSize,
+    // hashTableSize and contentHash, in that order, with no padding
+    static constexpr uint32_t SnapshotMagic = 0x6d386174; // 'm8at'
+    static constexpr uint16_t SnapshotVersion = 1;
+    static constexpr uint32_t SnapshotHeaderSize = 16;
+    
+    struct SnapshotHeader
+    {
+        uint32_t magic = 0;
+        uint16_t version = 0;
+        uint16_t atomCount = 0;
+        uint16_t tableSize = 0;
+        uint16_t hashTableSize = 0;
+        uint32_t contentHash = 0;
+        
+        void encode(uint8_t* buf) const;
+        
+        // False if this isn't a snapshot header of this version
+        bool decode(const uint8_t* buf);
+        
+        uint32_t fileSize() const { return SnapshotHeaderSize + tableSize + hashTableSize * sizeof(uint16_t); }
+    };
+    
+    // Checks the tables just read against header. Clears them if they
+    // don't match
+    bool finishLoad(const SnapshotHeader&);
 
     mutable Vector<char> _table;
+    mutable Vector<uint16_t> _hashTable;
+    mutable uint16_t _atomCount = 0;
     
     // Shared atom table
-    const char** _sharedAtoms = nullptr;
+    const char* const* _sharedAtoms = nullptr;
     uint16_t _sharedAtomCount = 0;
+    SharedAtomHash _sharedAtomHash;
+};
+
+//************************************************************************
+//
+//  Class: SharedAtomTable
+//
+//  Minimal perfect hash over a static list of shared atoms, built by the
+//  compiler using hash and displace. Buckets are placed largest first,
+//  trying displacements until every atom in the bucket lands in a free
+//  slot. A lookup hashes the string once, reads 2 table entries and does
+//  a single strcmp to confirm. Declare the table constexpr so it lives
+//  in ROM and takes no RAM:
+//
+//      static constexpr const char* SharedAtoms[] = { "foo", "bar", ... };
+//      static constexpr SharedAtomTable<sizeof(SharedAtoms) / sizeof(const char*)> SharedAtomList(SharedAtoms);
+//      static_assert(SharedAtomList.valid(), "Shared atom hash failed");
+//      static_assert(SharedAtomList.fingerprint() == 0x12345678, "Shared atom ids changed");
+//
+//  The fingerprint covers every string and its position in the list,
+//  so adding, removing or reordering atoms changes it. Pin it with a
+//  static_assert to catch changes to Atom ids at build time. Use id()
+//  to check individual atoms against their enumerants, as Atom.cpp does
+//  for SA:
+//
+//      static_assert(SharedAtomList.id("bar") == 1, "");
+//
+//************************************************************************
+
+template<uint16_t N>
+class SharedAtomTable
+{
+public:
+    static_assert(N > 0 && N < ExternalAtomOffset, "Invalid shared atom count");
+    
+    constexpr SharedAtomTable(const char* const (&atoms)[N])
+        : _atoms(atoms)
+    {
+        // Sort the atoms into buckets by hash
+        uint32_t hashes[N] { };
+        uint16_t bucketStart[N + 1] { };
+        for (uint16_t i = 0; i < N; ++i) {
+            hashes[i] = AtomTable::hashString(atoms[i]);
+            bucketStart[hashes[i] % N + 1]++;
+        }
+        
+        uint16_t maxBucketSize = 0;
+        for (uint16_t i = 0; i < N; ++i) {
+            if (bucketStart[i + 1] > maxBucketSize) {
+                maxBucketSize = bucketStart[i + 1];
+            }
+            bucketStart[i + 1] += bucketStart[i];
+        }
+        
+        uint16_t bucketFill[N] { };
+        uint16_t members[N] { };
+        for (uint16_t i = 0; i < N; ++i) {
+            uint16_t bucket = hashes[i] % N;
+            members[bucketStart[bucket] + bucketFill[bucket]++] = i;
+        }
+        
+        for (uint16_t i = 0; i < N; ++i) {
+            _slots[i] = NoSlot;
+        }
+        
+        // Place the largest buckets first, while the table is mostly empty
+        for (uint16_t size = maxBucketSize; size > 0; --size) {
+            for (uint16_t bucket = 0; bucket < N; ++bucket) {
+                if (bucketStart[bucket + 1] - bucketStart[bucket] != size) {
+                    continue;
+                }
+                
+                const uint16_t* bucketMembers = members + bucketStart[bucket];
+                uint16_t displacement = 0;
+                while (!place(hashes, bucketMembers, size, displacement)) {
+                    if (displacement == MaxDisplacement) {
+                        // Duplicate strings or a full 32 bit hash collision
+                        _valid = false;
+                        return;
+                    }
+                    ++displacement;
+                }
+                _displacements[bucket] = displacement;
+            }
+        }
+    }
+    
+    constexpr SharedAtomHash hash() const { return SharedAtomHash(_atoms, _displacements, _slots, N); }
+    
+    // Return the Atom id of the passed string, or -1 if it is not in the table
+    constexpr int32_t id(const char* s) const
+    {
+        uint16_t index = hash().lookup(AtomTable::hashString(s));
+        return equal(_atoms[index], s) ? index : -1;
+    }
+    
+    // True if every atom hashes back to its own position in the list
+    constexpr bool valid() const
+    {
+        if (!_valid) {
+            return false;
+        }
+        for (uint16_t i = 0; i < N; ++i) {
+            if (id(_atoms[i]) != i) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    constexpr uint32_t fingerprint() const
+    {
+        uint32_t hash = 2166136261u;
+        for (uint16_t i = 0; i < N; ++i) {
+            for (const char* s = _atoms[i]; ; ++s) {
+                hash = (hash ^ static_cast<uint8_t>(*s)) * 16777619u;
+                if (*s == '\0') {
+                    break;
+                }
+            }
+        }
+        return hash;
+    }
+
+private:
+    static constexpr uint16_t NoSlot = std::numeric_limits<uint16_t>::max();
+    
+    // Lists of a few hundred atoms place every bucket with a displacement
+    // well under this. Giving up here fails valid() rather than running
+    // into the compiler's limit on constexpr evaluation
+    static constexpr uint16_t MaxDisplacement = 1024;
+    
+    static constexpr bool equal(const char* a, const char* b)
+    {
+        while (*a && *a == *b) {
+            ++a;
+            ++b;
+        }
+        return *a == *b;
+    }
+    
+    // Try to put all the atoms in a bucket into free slots. Slots are
+    // claimed as we go, which also catches atoms in the same bucket
+    // colliding with each other. On failure release the claimed slots.
+    constexpr bool place(const uint32_t* hashes, const uint16_t* bucketMembers, uint16_t size, uint16_t displacement)
+    {
+        for (uint16_t i = 0; i < size; ++i) {
+            uint16_t slot = SharedAtomHash::mix(hashes[bucketMembers[i]], displacement) % N;
+            if (_slots[slot] != NoSlot) {
+                for (uint16_t j = 0; j < i; ++j) {
+                    _slots[SharedAtomHash::mix(hashes[bucketMembers[j]], displacement) % N] = NoSlot;
+                }
+                return false;
+            }
+            _slots[slot] = bucketMembers[i];
+        }
+        return true;
+    }
+    
+    const char* const* _atoms;
+    uint16_t _displacements[N] { };
+    uint16_t _slots[N] { };
+    bool _valid = true;
+};
+
+//************************************************************************
+//
+//  Enum: SA
+//
+//  The shared atoms every AtomTable starts with. Each enumerant is the
+//  Atom id of the string of the same name in SharedAtoms, which is a
+//  SharedAtomTable. Atom.cpp checks at build time that the two agree.
+//
+//************************************************************************
+
+enum class SA : uint16_t {
+    Array,
+    Boolean,
+    Function,
+    Iterator,
+    JSON,
+    Math,
+    Number,
+    Object,
+    String,
+    arguments,
+    console,
+    constructor,
+    done,
+    length,
+    next,
+    parse,
+    print,
+    println,
+    prototype,
+    stringify,
+    toString,
+    value,
+    
+    Count
 };
 
 }
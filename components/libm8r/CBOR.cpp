@@ -0,0 +1,412 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "CBOR.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace m8r;
+
+JSONWriter& CBORWriter::start(uint8_t initialByte)
+{
+    if (_depth >= MaxDepth) {
+        _valid = false;
+        return *this;
+    }
+    ++_depth;
+    write(static_cast<char>(initialByte));
+    return *this;
+}
+
+JSONWriter& CBORWriter::end()
+{
+    if (_depth == 0) {
+        _valid = false;
+        return *this;
+    }
+    --_depth;
+    write(static_cast<char>(0xff));
+    return *this;
+}
+
+void CBORWriter::head(Major major, uint32_t value)
+{
+    uint8_t m = static_cast<uint8_t>(major) << 5;
+    if (value < 24) {
+        write(static_cast<char>(m | value));
+    } else if (value <= 0xff) {
+        write(static_cast<char>(m | 24));
+        write(static_cast<char>(value));
+    } else if (value <= 0xffff) {
+        write(static_cast<char>(m | 25));
+        write(static_cast<char>(value >> 8));
+        write(static_cast<char>(value));
+    } else {
+        write(static_cast<char>(m | 26));
+        write(static_cast<char>(value >> 24));
+        write(static_cast<char>(value >> 16));
+        write(static_cast<char>(value >> 8));
+        write(static_cast<char>(value));
+    }
+}
+
+JSONWriter& CBORWriter::key(const char* s)
+{
+    return value(s);
+}
+
+JSONWriter& CBORWriter::value(const char* s)
+{
+    uint32_t size = static_cast<uint32_t>(strlen(s));
+    head(Major::Text, size);
+    write(s, size);
+    return *this;
+}
+
+JSONWriter& CBORWriter::value(float v)
+{
+    // Integral values are smaller as integers
+    if (v >= -2147483648.0f && v < 2147483648.0f && v == static_cast<float>(static_cast<int32_t>(v))) {
+        return value(static_cast<int32_t>(v));
+    }
+
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    write(static_cast<char>(0xfa));
+    write(static_cast<char>(bits >> 24));
+    write(static_cast<char>(bits >> 16));
+    write(static_cast<char>(bits >> 8));
+    write(static_cast<char>(bits));
+    return *this;
+}
+
+JSONWriter& CBORWriter::value(int32_t v)
+{
+    if (v < 0) {
+        head(Major::Negative, static_cast<uint32_t>(-1 - v));
+    } else {
+        head(Major::Unsigned, static_cast<uint32_t>(v));
+    }
+    return *this;
+}
+
+JSONWriter& CBORWriter::value(bool v)
+{
+    write(static_cast<char>(v ? 0xf5 : 0xf4));
+    return *this;
+}
+
+JSONWriter& CBORWriter::null()
+{
+    write(static_cast<char>(0xf6));
+    return *this;
+}
+
+JSONWriter& CBORWriter::bytes(const uint8_t* data, uint32_t size)
+{
+    head(Major::Bytes, size);
+    write(reinterpret_cast<const char*>(data), size);
+    return *this;
+}
+
+static float halfToFloat(uint16_t half)
+{
+    int32_t exp = (half >> 10) & 0x1f;
+    int32_t mant = half & 0x3ff;
+    float value;
+    if (exp == 0) {
+        value = ldexpf(static_cast<float>(mant), -24);
+    } else if (exp != 31) {
+        value = ldexpf(static_cast<float>(mant + 1024), exp - 25);
+    } else {
+        value = (mant == 0) ? INFINITY : NAN;
+    }
+    return (half & 0x8000) ? -value : value;
+}
+
+bool CBORReader::fail(const uint8_t* p, const uint8_t* buf)
+{
+    _error = Error::Code::ParseError;
+    _offset = static_cast<uint32_t>(p - buf);
+    return false;
+}
+
+bool CBORReader::argument(const uint8_t*& p, const uint8_t* end, uint8_t info, uint64_t& value)
+{
+    if (info < 24) {
+        value = info;
+        return true;
+    }
+
+    uint8_t size;
+    switch (info) {
+        case 24: size = 1; break;
+        case 25: size = 2; break;
+        case 26: size = 4; break;
+        case 27: size = 8; break;
+        default: return false;
+    }
+
+    if (end - p < size) {
+        return false;
+    }
+
+    value = 0;
+    while (size--) {
+        value = (value << 8) | *p++;
+    }
+    return true;
+}
+
+bool CBORReader::parse(const uint8_t* buf, uint32_t size)
+{
+    _error = Error::Code::OK;
+    _offset = 0;
+
+    // Items left in each open container, with a bit stack for maps and
+    // another for whether a map expects a key next
+    uint32_t remaining[MaxDepth];
+    uint32_t mapStack = 0;
+    uint32_t keyStack = 0;
+    uint8_t depth = 0;
+    bool started = false;
+
+    const uint8_t* p = buf;
+    const uint8_t* end = buf + size;
+
+    while (true) {
+        // Close finished definite length containers
+        while (depth && remaining[depth - 1] == 0) {
+            --depth;
+            if (mapStack & (1u << depth)) {
+                _handler->endObject();
+            } else {
+                _handler->endArray();
+            }
+        }
+
+        if (started && depth == 0) {
+            break;
+        }
+
+        if (p >= end) {
+            return fail(p, buf);
+        }
+
+        const uint8_t* itemStart = p;
+        uint8_t initialByte = *p++;
+
+        if (initialByte == 0xff) {
+            // Break, closes an indefinite length container
+            if (depth == 0 || remaining[depth - 1] != Indefinite) {
+                return fail(itemStart, buf);
+            }
+            uint32_t bit = 1u << (depth - 1);
+            if ((mapStack & bit) && !(keyStack & bit)) {
+                // Map has a key with no value
+                return fail(itemStart, buf);
+            }
+            remaining[depth - 1] = 0;
+            continue;
+        }
+
+        uint8_t major = initialByte >> 5;
+        uint8_t info = initialByte & 0x1f;
+        uint64_t arg = 0;
+
+        // Tags don't change the item that follows
+        if (major == 6) {
+            if (!argument(p, end, info, arg)) {
+                return fail(itemStart, buf);
+            }
+            continue;
+        }
+
+        // Floats are read below, everything else has an integer argument
+        bool indefinite = info == 31 && (major == 4 || major == 5);
+        if (!indefinite && major != 7 && !argument(p, end, info, arg)) {
+            return fail(itemStart, buf);
+        }
+
+        // Take a slot in the enclosing container
+        bool isKey = false;
+        if (depth) {
+            uint32_t bit = 1u << (depth - 1);
+            if (mapStack & bit) {
+                isKey = keyStack & bit;
+                keyStack ^= bit;
+            }
+            if (remaining[depth - 1] != Indefinite) {
+                --remaining[depth - 1];
+            }
+        }
+        started = true;
+
+        if (isKey && major != 3) {
+            return fail(itemStart, buf);
+        }
+
+        switch (major) {
+            case 0:
+                _handler->number(static_cast<float>(arg));
+                break;
+            case 1:
+                _handler->number(-1 - static_cast<float>(arg));
+                break;
+            case 2:
+            case 3:
+                if (arg > static_cast<uint64_t>(end - p) || (major == 3 && arg > 0xffff)) {
+                    return fail(itemStart, buf);
+                }
+                if (major == 2) {
+                    _handler->bytes(p, static_cast<uint32_t>(arg));
+                } else if (isKey) {
+                    _handler->key(reinterpret_cast<const char*>(p), static_cast<uint16_t>(arg));
+                } else {
+                    _handler->string(reinterpret_cast<const char*>(p), static_cast<uint16_t>(arg));
+                }
+                p += arg;
+                break;
+            case 4:
+            case 5: {
+                if (depth >= MaxDepth) {
+                    return fail(itemStart, buf);
+                }
+                uint32_t bit = 1u << depth;
+                if (major == 5) {
+                    if (!indefinite && arg > 0x7fffffff) {
+                        return fail(itemStart, buf);
+                    }
+                    mapStack |= bit;
+                    keyStack |= bit;
+                    remaining[depth] = indefinite ? Indefinite : static_cast<uint32_t>(arg * 2);
+                    _handler->startObject();
+                } else {
+                    if (!indefinite && arg >= Indefinite) {
+                        return fail(itemStart, buf);
+                    }
+                    mapStack &= ~bit;
+                    remaining[depth] = indefinite ? Indefinite : static_cast<uint32_t>(arg);
+                    _handler->startArray();
+                }
+                ++depth;
+                break;
+            }
+            case 7:
+                switch (info) {
+                    case 20: _handler->boolean(false); break;
+                    case 21: _handler->boolean(true); break;
+                    case 22:
+                    case 23: _handler->null(); break;
+                    case 25: {
+                        if (!argument(p, end, info, arg)) {
+                            return fail(itemStart, buf);
+                        }
+                        _handler->number(halfToFloat(static_cast<uint16_t>(arg)));
+                        break;
+                    }
+                    case 26: {
+                        if (!argument(p, end, info, arg)) {
+                            return fail(itemStart, buf);
+                        }
+                        uint32_t bits = static_cast<uint32_t>(arg);
+                        float value;
+                        memcpy(&value, &bits, sizeof(value));
+                        _handler->number(value);
+                        break;
+                    }
+                    case 27: {
+                        if (!argument(p, end, info, arg)) {
+                            return fail(itemStart, buf);
+                        }
+                        double value;
+                        memcpy(&value, &arg, sizeof(value));
+                        _handler->number(static_cast<float>(value));
+                        break;
+                    }
+                    default:
+                        return fail(itemStart, buf);
+                }
+                break;
+            default:
+                return fail(itemStart, buf);
+        }
+    }
+
+    return (p == end) ? true : fail(p, buf);
+}
+
+// Handler which builds a JSON Value tree
+class ValueBuilder : public JSONReader::Handler
+{
+public:
+    SharedPtr<JSON::Value>& result() { return _result; }
+
+    virtual void startObject() override
+    {
+        SharedPtr<JSON::ObjectValue> object(new JSON::ObjectValue());
+        add(object);
+        _stack.push_back({ object, SharedPtr<JSON::ArrayValue>() });
+    }
+
+    virtual void startArray() override
+    {
+        SharedPtr<JSON::ArrayValue> array(new JSON::ArrayValue());
+        add(array);
+        _stack.push_back({ SharedPtr<JSON::ObjectValue>(), array });
+    }
+
+    virtual void endObject() override { _stack.pop_back(); }
+    virtual void endArray() override { _stack.pop_back(); }
+
+    virtual void key(const char* s, uint16_t length) override { _key = String(s, length); }
+    virtual void string(const char* s, uint16_t length) override { add(SharedPtr<JSON::Value>(new JSON::StringValue(String(s, length)))); }
+    virtual void number(float v) override { add(SharedPtr<JSON::Value>(new JSON::NumberValue(v))); }
+    virtual void boolean(bool v) override { add(SharedPtr<JSON::Value>(new JSON::BooleanValue(v))); }
+    virtual void null() override { add(SharedPtr<JSON::Value>(new JSON::NullValue())); }
+
+    virtual void bytes(const uint8_t* data, uint32_t size) override
+    {
+        add(SharedPtr<JSON::Value>(new JSON::StringValue(String(data, static_cast<int32_t>(size)))));
+    }
+
+private:
+    struct Container
+    {
+        SharedPtr<JSON::ObjectValue> object;
+        SharedPtr<JSON::ArrayValue> array;
+    };
+
+    void add(const SharedPtr<JSON::Value>& value)
+    {
+        if (_stack.empty()) {
+            _result = value;
+        } else if (_stack.back().object) {
+            _stack.back().object->map().emplace(_key, value);
+        } else {
+            _stack.back().array->array().push_back(value);
+        }
+    }
+
+    SharedPtr<JSON::Value> _result;
+    Vector<Container> _stack;
+    String _key;
+};
+
+bool CBORReader::parse(const uint8_t* buf, uint32_t size, SharedPtr<JSON::Value>& value)
+{
+    ValueBuilder builder;
+    CBORReader reader(&builder);
+    if (!reader.parse(buf, size)) {
+        return false;
+    }
+    value = builder.result();
+    return true;
+}
@@ -0,0 +1,107 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Error.h"
+#include "JSON.h"
+#include "JSONReader.h"
+#include "JSONWriter.h"
+
+namespace m8r {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: CBORWriter
+//
+//  Writes the JSON value model as CBOR (RFC 7049). It has the same
+//  interface and output targets as JSONWriter, so anything that writes
+//  JSON (JSON::Value::write, JSONTape::write, HTTPServer::sendJSON) can
+//  write CBOR instead. Objects and arrays use indefinite length encoding
+//  so nothing has to be counted up front. Floats with integral values are
+//  written as integers, other floats as single precision. bytes() writes
+//  a CBOR byte string.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class CBORWriter : public JSONWriter {
+public:
+    CBORWriter() { }
+    CBORWriter(Stream* stream) : JSONWriter(stream) { }
+    CBORWriter(const Sink& sink) : JSONWriter(sink) { }
+
+    using JSONWriter::key;
+    using JSONWriter::value;
+
+    virtual JSONWriter& startObject() override { return start(0xbf); }
+    virtual JSONWriter& endObject() override { return end(); }
+    virtual JSONWriter& startArray() override { return start(0x9f); }
+    virtual JSONWriter& endArray() override { return end(); }
+
+    virtual JSONWriter& key(const char*) override;
+    virtual JSONWriter& value(const char*) override;
+    virtual JSONWriter& value(float) override;
+    virtual JSONWriter& value(int32_t) override;
+    virtual JSONWriter& value(bool) override;
+    virtual JSONWriter& null() override;
+    virtual JSONWriter& bytes(const uint8_t*, uint32_t size) override;
+
+private:
+    enum class Major : uint8_t { Unsigned = 0, Negative = 1, Bytes = 2, Text = 3 };
+
+    JSONWriter& start(uint8_t initialByte);
+    JSONWriter& end();
+
+    void head(Major, uint32_t value);
+
+    uint8_t _depth = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: CBORReader
+//
+//  Decodes CBOR from a contiguous buffer and calls a JSONReader::Handler
+//  for each item, so the same handlers work for both encodings. Text and
+//  byte strings are passed in place, pointing into the input buffer, with
+//  no copy. Definite and indefinite length arrays and maps are accepted.
+//  Tags are skipped. Integers and half, single and double floats are all
+//  delivered as float. Map keys must be text strings and chunked
+//  (indefinite length) strings are not supported.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class CBORReader {
+public:
+    static constexpr uint8_t MaxDepth = 32;
+
+    CBORReader(JSONReader::Handler* handler) : _handler(handler) { }
+
+    bool parse(const uint8_t* buf, uint32_t size);
+
+    // Decode into the JSON Value tree. Byte strings become StringValues
+    static bool parse(const uint8_t* buf, uint32_t size, SharedPtr<JSON::Value>&);
+
+    Error error() const { return _error; }
+
+    // Offset of the byte where an error was found
+    uint32_t offset() const { return _offset; }
+
+private:
+    static constexpr uint32_t Indefinite = 0xffffffff;
+
+    bool fail(const uint8_t* p, const uint8_t* buf);
+    bool argument(const uint8_t*& p, const uint8_t* end, uint8_t info, uint64_t& value);
+
+    JSONReader::Handler* _handler;
+    Error _error;
+    uint32_t _offset = 0;
+};
+
+}
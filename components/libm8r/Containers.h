@@ -15,6 +15,7 @@
 #include <cstdint>
 #include <cstring>
 #include <limits>
+#include <utility>
 #include <vector>
 #include "Defines.h"
 #include "Mallocator.h"
@@ -149,7 +150,6 @@ public:
     T& front() { return at(0); }
     const T& front() const { return at(0); }
 
-    // TODO: Make this more robust and destroy erased element
     iterator erase(iterator pos)
     {
         if (pos == end()) {
@@ -173,18 +173,17 @@ public:
             
             assert(_data - first < _size);
             
-            // destruct
-            for (iterator it = first; it != last; ++it) {
-                *it = T();
+            // Move the elements after the erased ones down, then reset the
+            // vacated slots at the end. Slots past _size stay constructed
+            iterator to = first;
+            for (iterator from = last; from != end(); ++from, ++to) {
+                *to = std::move(*from);
             }
-            
-            uint32_t numToDelete = static_cast<uint32_t>(last - first);
-            if (last < end()) {
-                // move
-                memmove(first, first + numToDelete, (_size - numToDelete) * sizeof(T));
+            for ( ; to != end(); ++to) {
+                *to = T();
             }
             
-            _size -= numToDelete;
+            _size -= static_cast<uint16_t>(last - first);
         }
         return first;
     }
@@ -208,7 +207,10 @@ public:
         
         if (pos < end()) {
             if (_size) {
-                memmove(pos + numToInsert, pos, (_size - i) * sizeof(T));
+                // Move the elements from pos up, last one first
+                for (iterator it = end() + numToInsert - 1; it >= pos + numToInsert; --it) {
+                    *it = std::move(*(it - numToInsert));
+                }
             } else {
                 // If _size == 0, set pos to the start of the vector
                 pos = begin();
@@ -216,7 +218,6 @@ public:
         }
         
         for (int i = 0; i < numToInsert; ++i) {
-            new(pos + i) T();
             *(pos + i) = *(from + i);
         }
         
@@ -0,0 +1,211 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "FileStream.h"
+
+#include <cstring>
+
+using namespace m8r;
+
+FileStream::FileStream(Mad<File> file, uint16_t bufferSize)
+    : _file(file)
+    , _bufferSize(bufferSize ? bufferSize : 1)
+{
+    _buffer = Mallocator::shared()->allocate<uint8_t>(MemoryType::Native, _bufferSize);
+}
+
+FileStream::~FileStream()
+{
+    if (_buffer.valid()) {
+        writeBuffer();
+        Mallocator::shared()->deallocate(MemoryType::Native, _buffer);
+    }
+}
+
+int FileStream::read() const
+{
+    if (!valid() || (!available() && !fill())) {
+        return -1;
+    }
+    return _buffer.get()[_pos++];
+}
+
+int FileStream::write(uint8_t c)
+{
+    if (!startWrite()) {
+        return -1;
+    }
+    _buffer.get()[_end++] = c;
+    if (_end == _bufferSize && !writeBuffer()) {
+        return -1;
+    }
+    return c;
+}
+
+int32_t FileStream::read(uint8_t* buf, uint32_t size) const
+{
+    if (!valid()) {
+        return -1;
+    }
+    
+    uint32_t total = 0;
+    while (total < size) {
+        if (!available()) {
+            // Large reads bypass the buffer
+            if (size - total >= _bufferSize) {
+                if (_writing && !writeBuffer()) {
+                    break;
+                }
+                _writing = false;
+                int32_t result = _file->read(reinterpret_cast<char*>(buf + total), size - total);
+                if (result > 0) {
+                    total += result;
+                }
+                break;
+            }
+            if (!fill()) {
+                break;
+            }
+        }
+        
+        uint32_t n = _end - _pos;
+        if (n > size - total) {
+            n = size - total;
+        }
+        memcpy(buf + total, _buffer.get() + _pos, n);
+        _pos += n;
+        total += n;
+    }
+    return total;
+}
+
+int32_t FileStream::write(const uint8_t* buf, uint32_t size)
+{
+    if (!startWrite()) {
+        return -1;
+    }
+    
+    // Large writes go straight to the file after what is pending
+    if (size >= _bufferSize) {
+        if (!writeBuffer()) {
+            return -1;
+        }
+        return _file->write(reinterpret_cast<const char*>(buf), size);
+    }
+    
+    uint32_t total = 0;
+    while (total < size) {
+        uint32_t n = _bufferSize - _end;
+        if (n > size - total) {
+            n = size - total;
+        }
+        memcpy(_buffer.get() + _end, buf + total, n);
+        _end += n;
+        total += n;
+        if (_end == _bufferSize && !writeBuffer()) {
+            return -1;
+        }
+    }
+    return total;
+}
+
+int FileStream::peek() const
+{
+    if (!valid() || (!available() && !fill())) {
+        return -1;
+    }
+    return _buffer.get()[_pos];
+}
+
+const uint8_t* FileStream::span(uint32_t& size) const
+{
+    if (!valid() || (!available() && !fill())) {
+        size = 0;
+        return nullptr;
+    }
+    size = _end - _pos;
+    return _buffer.get() + _pos;
+}
+
+uint32_t FileStream::skip(uint32_t size) const
+{
+    if (!valid()) {
+        return 0;
+    }
+    
+    // Use up the read-ahead first, then seek over the rest
+    uint32_t n = 0;
+    if (!_writing) {
+        n = _end - _pos;
+        if (n > size) {
+            n = size;
+        }
+        _pos += n;
+        size -= n;
+    } else if (!writeBuffer()) {
+        return 0;
+    }
+    
+    if (size == 0) {
+        return n;
+    }
+    
+    int32_t remaining = _file->size() - _file->tell();
+    if (remaining <= 0) {
+        return n;
+    }
+    if (size > static_cast<uint32_t>(remaining)) {
+        size = remaining;
+    }
+    _file->seek(size, File::SeekWhence::Cur);
+    return n + size;
+}
+
+bool FileStream::fill() const
+{
+    if (_writing) {
+        if (!writeBuffer()) {
+            return false;
+        }
+        _writing = false;
+    }
+    
+    int32_t result = _file->read(reinterpret_cast<char*>(_buffer.get()), _bufferSize);
+    _pos = 0;
+    _end = (result > 0) ? result : 0;
+    return _end > 0;
+}
+
+bool FileStream::startWrite()
+{
+    if (!valid()) {
+        return false;
+    }
+    if (!_writing) {
+        // Give back the read-ahead so the write goes where the reader is
+        if (_end > _pos) {
+            _file->seek(-static_cast<int32_t>(_end - _pos), File::SeekWhence::Cur);
+        }
+        _pos = _end = 0;
+        _writing = true;
+    }
+    return true;
+}
+
+bool FileStream::writeBuffer() const
+{
+    if (!_writing || _end == 0) {
+        return true;
+    }
+    
+    int32_t result = _file->write(reinterpret_cast<const char*>(_buffer.get()), _end);
+    bool ok = result == static_cast<int32_t>(_end);
+    _end = 0;
+    return ok;
+}
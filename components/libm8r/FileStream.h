@@ -18,46 +18,60 @@ namespace m8r {
 //
 //  Class: FileStream
 //
+//  Stream on a File, with a block buffer so single byte reads and writes
+//  don't each go to the filesystem. Reads fill the buffer a block at a
+//  time (read-ahead) and span() exposes it, so a Scanner reads straight
+//  out of it. Writes collect in the buffer and go to the file when it
+//  fills, on flush() or when the stream is destroyed (write-behind).
+//  Requests of at least a buffer's size go to the file directly.
 //
+//  The buffer is either holding read-ahead or pending writes. Switching
+//  from reading to writing seeks the file back over the unread bytes.
 //
 //////////////////////////////////////////////////////////////////////////////
 
 class FileStream : public Stream {
 public:
-	FileStream(Mad<File> file)
-        : _file(file)
-    { }
+    static constexpr uint16_t DefaultBufferSize = 512;
     
-    ~FileStream() { }
+	FileStream(Mad<File> file, uint16_t bufferSize = DefaultBufferSize);
+    ~FileStream();
+    
+    FileStream(const FileStream&) = delete;
+    FileStream& operator=(const FileStream&) = delete;
 
     bool loaded()
     {
-        return _file.valid() && _file->valid();
-    }
-    virtual int read() const override
-    {
-        if (!_file.valid()) {
-            return -1;
-        }
-        char c;
-        if (_file->read(&c, 1) != 1) {
-            return -1;
-        }
-        return static_cast<uint8_t>(c);
-    }
-    virtual int write(uint8_t c) override
-    {
-        if (!_file.valid()) {
-            return -1;
-        }
-        if (_file->write(reinterpret_cast<char*>(&c), 1) != 1) {
-            return -1;
-        }
-        return c;
+        return _file.valid() && _file->valid() && _buffer.valid();
     }
+    
+    virtual int read() const override;
+    virtual int write(uint8_t c) override;
+    virtual int32_t read(uint8_t* buf, uint32_t size) const override;
+    virtual int32_t write(const uint8_t* buf, uint32_t size) override;
+    virtual int peek() const override;
+    virtual const uint8_t* span(uint32_t& size) const override;
+    virtual uint32_t skip(uint32_t size) const override;
+    
+    // Write any pending output to the file. Returns false on a write error
+    bool flush() { return writeBuffer(); }
 	
 private:
+    bool valid() const { return _file.valid() && _buffer.valid(); }
+    bool available() const { return !_writing && _pos < _end; }
+    
+    bool fill() const;
+    bool startWrite();
+    bool writeBuffer() const;
+    
     Mad<File> _file;
+    Mad<uint8_t> _buffer;
+    uint16_t _bufferSize;
+    
+    // Unread bytes are _pos to _end. When writing, pending bytes are 0 to _end
+    mutable uint16_t _pos = 0;
+    mutable uint16_t _end = 0;
+    mutable bool _writing = false;
 };
 
 }
@@ -9,12 +9,14 @@
 
 #include "HTTPServer.h"
 
+#include "CBOR.h"
 #include "Containers.h"
 #include "MFS.h"
 #include "MString.h"
 #include "SystemInterface.h"
 #include "SystemTime.h"
 #include "TCP.h"
+#include <algorithm>
 
 
 using namespace m8r;
@@ -62,8 +64,19 @@ static String toString(HTTPServer::Method method)
 // values follow the '?' of the uri. Query values are 
 // separated by '&' and each query value is a key/value pair
 // with the form: <key>=<value> with no spaces allowed.
-static void parseRequest(const String& s, HTTPServer::Request& request)
+static void parseRequest(const String& raw, HTTPServer::Request& request)
 {
+    // Headers end at the first blank line, the rest is the body
+    String s = raw;
+    const char* bodyStart = strstr(raw.c_str(), "\r\n\r\n");
+    if (bodyStart) {
+        request.body = String(bodyStart + 4);
+        s = String(raw.c_str(), static_cast<int32_t>(bodyStart - raw.c_str()));
+    } else if ((bodyStart = strstr(raw.c_str(), "\n\n"))) {
+        request.body = String(bodyStart + 2);
+        s = String(raw.c_str(), static_cast<int32_t>(bodyStart - raw.c_str()));
+    }
+    
     // Split into lines
     Vector<String> lines = s.split("\n");
     if (lines.empty()) {
@@ -209,14 +222,109 @@ HTTPServer::HTTPServer(uint16_t port, const char* rootDir, bool dirAccess)
     _socket = socket;
 }
 
-void HTTPServer::sendResponseHeader(int16_t connectionId, uint32_t size)
+void HTTPServer::sendResponseHeader(int16_t connectionId, uint32_t size, const char* contentType, const char* extraHeaders)
 {
     // This is for a valid response
-    String s = String::format("HTTP/1.0 200 OK\r\nDate: %s\r\nContent-Length: %d\r\nContent-Type: text/html\r\n\r\n",
-                                 dateString().c_str(), size);
+    String s = String::format("HTTP/1.0 200 OK\r\nDate: %s\r\nContent-Length: %d\r\nContent-Type: %s\r\n%s\r\n",
+                                 dateString().c_str(), size, contentType, extraHeaders);
     _socket->send(connectionId, s.c_str());
 }
 
+void HTTPServer::sendMapping(int16_t connectionId, const Request& request, const FS::Mapping& mapping)
+{
+    // The ETag only changes when the bytes do, so a browser that has them
+    // gets a 304 and nothing else
+    auto ifNoneMatch = request.headers.find("If-None-Match");
+    if (mapping.etag && ifNoneMatch != request.headers.end() && ifNoneMatch->value == mapping.etag) {
+        String s = String::format("HTTP/1.0 304 Not Modified\r\nDate: %s\r\nETag: %s\r\n\r\n",
+                                     dateString().c_str(), mapping.etag);
+        _socket->send(connectionId, s.c_str());
+        return;
+    }
+
+    String headers;
+    if (mapping.etag) {
+        headers += String::format("ETag: %s\r\n", mapping.etag);
+    }
+    
+    const char* data = mapping.data;
+    uint32_t dataSize = mapping.size;
+    if (mapping.gzipData) {
+        // Caches have to keep the two encodings apart
+        headers += "Vary: Accept-Encoding\r\n";
+        if (acceptsGzip(request)) {
+            headers += "Content-Encoding: gzip\r\n";
+            data = mapping.gzipData;
+            dataSize = mapping.gzipSize;
+        }
+    }
+    
+    const char* contentType = mapping.contentType ? mapping.contentType : "application/octet-stream";
+    sendResponseHeader(connectionId, dataSize, contentType, headers.c_str());
+
+    // Send straight from the mapping, in pieces the socket can take
+    static constexpr uint32_t MaxSendSize = 32 * 1024;
+    for (uint32_t offset = 0; offset < dataSize; offset += MaxSendSize) {
+        uint16_t size = static_cast<uint16_t>(std::min(dataSize - offset, MaxSendSize));
+        _socket->send(connectionId, data + offset, size);
+    }
+}
+
+bool HTTPServer::acceptsGzip(const Request& request)
+{
+    auto acceptEncoding = request.headers.find("Accept-Encoding");
+    if (acceptEncoding == request.headers.end()) {
+        return false;
+    }
+    
+    // Each coding is like "gzip" or "gzip;q=0.5". q=0 means not acceptable
+    for (const String& coding : acceptEncoding->value.split(",", true)) {
+        Vector<String> parts = coding.split(";");
+        String name = parts[0].trim();
+        if (name != "gzip" && name != "*") {
+            continue;
+        }
+        
+        bool acceptable = true;
+        for (uint16_t i = 1; i < parts.size(); ++i) {
+            String param = parts[i].trim();
+            if (param.size() > 2 && (param[0] == 'q' || param[0] == 'Q') && param[1] == '=') {
+                acceptable = atof(param.c_str() + 2) > 0;
+            }
+        }
+        return acceptable;
+    }
+    return false;
+}
+
+void HTTPServer::sendJSON(int16_t connectionId, const Request& request, const std::function<void(JSONWriter&)>& f)
+{
+    auto accept = request.headers.find("Accept");
+    bool cbor = accept != request.headers.end() && strstr(accept->value.c_str(), "application/cbor");
+    
+    JSONWriter::Sink sink = [this, connectionId](const char* data, uint16_t size) {
+        _socket->send(connectionId, data, size);
+    };
+    
+    if (cbor) {
+        CBORWriter counter;
+        f(counter);
+        sendResponseHeader(connectionId, counter.size(), "application/cbor");
+        
+        CBORWriter writer(sink);
+        f(writer);
+        writer.flush();
+    } else {
+        JSONWriter counter;
+        f(counter);
+        sendResponseHeader(connectionId, counter.size(), "application/json");
+        
+        JSONWriter writer(sink);
+        f(writer);
+        writer.flush();
+    }
+}
+
 String HTTPServer::dateString()
 {
     // Format is <abbrev wkday>, <day> <abbrev month> <year> <hr>:<min>:<sec> <tz name>
@@ -253,6 +361,20 @@ void HTTPServer::on(const String& uri, const String& path, bool dirAccess)
         filename += request.path;
         if (filename.back() == '/') {
             filename += "index.html";
+        } else {
+            // A directory serves its index.html too. Lookups are cached, so
+            // this doesn't cost another walk of the path on flash
+            FS::Info info;
+            if (system()->fileSystem()->stat(filename.c_str(), info) && info.directory) {
+                filename += "/index.html";
+            }
+        }
+
+        // Assets in memory go out as they are
+        FS::Mapping mapping;
+        if (system()->fileSystem()->map(filename.c_str(), mapping)) {
+            sendMapping(connectionId, request, mapping);
+            return String();
         }
 
         // Get the file and send it
@@ -260,6 +382,7 @@ void HTTPServer::on(const String& uri, const String& path, bool dirAccess)
         if (!file->valid()) {
             system()->print(Error::formatError(file->error().code(), 
                                     "******** HTTPServer: unable to open '%s'", filename.c_str()).c_str());
+            system()->fileSystem()->release(file);
             return String();
         }
         
@@ -285,7 +408,7 @@ void HTTPServer::on(const String& uri, const String& path, bool dirAccess)
             }
         }
         
-        file->close();
+        system()->fileSystem()->release(file);
         return String();
     });
 }
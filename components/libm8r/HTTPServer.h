@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "MFS.h"
 #include "MString.h"
 #include <cstdint>
 
@@ -19,6 +20,7 @@ namespace m8r {
 // Build on top of TCP class
 // Adapted from https://github.com/konteck/wpp
 
+class JSONWriter;
 class TCP;
 
 class HTTPServer {
@@ -40,6 +42,7 @@ public:
         String path;                    // First line: path without any params
         Map<String, String> params;     // First line: key/value pairs of params
         Map<String, String> headers;    // Next lines: each header as key/value pair 
+        String body;                    // Everything after the blank line ending the headers
         bool valid = false;
         
         String toString() const
@@ -76,10 +79,25 @@ public:
     void on(const String& uri, RequestFunction);
     void on(const String& uri, const String& path, bool dirAccess = true);
 
+    // Send a JSON response without holding it in memory. The function is
+    // called twice, once to measure the Content-Length and once to send.
+    // If the request's Accept header asks for application/cbor the writer
+    // is a CBORWriter and the response is CBOR
+    void sendJSON(int16_t connectionId, const Request&, const std::function<void(JSONWriter&)>&);
+
 private:
     static String dateString();
         
-    void sendResponseHeader(int16_t connectionId, uint32_t size);
+    // extraHeaders is added as is, each header ending in "\r\n"
+    void sendResponseHeader(int16_t connectionId, uint32_t size, const char* contentType = "text/html",
+                            const char* extraHeaders = "");
+    
+    // Send an asset that's in memory, like one in a RomFS, without copying it.
+    // The gzipped copy goes out if there is one and the client accepts it
+    void sendMapping(int16_t connectionId, const Request&, const FS::Mapping&);
+    
+    // True if Accept-Encoding lists gzip, or *, with a q that isn't 0
+    static bool acceptsGzip(const Request&);
     
     struct RequestHandler
     {
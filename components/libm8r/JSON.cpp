@@ -29,7 +29,12 @@ bool JSON::value(Scanner& scanner, SharedPtr<JSON::Value>& v)
             break;
         case Token::Float: v = SharedPtr<Value>(new NumberValue(scanner.getTokenValue().number)); scanner.retireToken(); break;
         case Token::Integer: v = SharedPtr<Value>(new NumberValue(static_cast<float>(scanner.getTokenValue().integer))); scanner.retireToken(); break;
-        case Token::String: v = SharedPtr<Value>(new StringValue(scanner.getTokenValue().str)); scanner.retireToken(); break;
+        case Token::String: {
+            const Scanner::TokenType& token = scanner.getTokenValue();
+            v = SharedPtr<Value>(new StringValue(String(token.str, token.length)));
+            scanner.retireToken();
+            break;
+        }
         case Token::True: v = SharedPtr<Value>(new BooleanValue(true)); scanner.retireToken(); break;
         case Token::False: v = SharedPtr<Value>(new BooleanValue(false)); scanner.retireToken(); break;
         case Token::Null: v = SharedPtr<Value>(new NullValue()); scanner.retireToken(); break;;
@@ -104,7 +109,8 @@ bool JSON::propertyAssignment(Scanner& scanner, String& key, SharedPtr<Value>& v
         return false;
     }
     
-    key = scanner.getTokenValue().str;
+    const Scanner::TokenType& token = scanner.getTokenValue();
+    key = String(token.str, token.length);
     scanner.retireToken();
     if (scanner.getToken() != Token::Colon) {
         _error = Error::Code::RuntimeError;
@@ -138,59 +144,50 @@ String JSON::stringify(const SharedPtr<Value>& v)
 
 String JSON::stringify(const Vector<String>& v)
 {
-    String s("[ ");
-    bool first = true;
+    String s;
+    JSONWriter writer(s);
+    writer.startArray();
     for (auto const& it : v) {
-        if (!first) {
-            s += ", ";
-        }
-        first = false;
-        s += '"';
-        s += it;
-        s += '"';
+        writer.value(it);
     }
-    s += " ]";
+    writer.endArray();
+    writer.flush();
     return s;
 }
 
 String JSON::stringify(const String& v)
 {
     String s;
-    s += '"';
-    s += v;
-    s += '"';
+    JSONWriter writer(s);
+    writer.value(v);
+    writer.flush();
+    return s;
+}
+
+String JSON::Value::toString() const
+{
+    String s;
+    JSONWriter writer(s);
+    write(writer);
+    writer.flush();
     return s;
 }
 
-String JSON::ArrayValue::toString() const
+void JSON::ArrayValue::write(JSONWriter& writer) const
 {
-    String s("[ ");
-    bool first = true;
+    writer.startArray();
     for (auto const& it : _value) {
-        if (!first) {
-            s += ", ";
-        }
-        first = false;
-        s += it->toString();
+        it->write(writer);
     }
-    s += " ]";
-    return s;
+    writer.endArray();
 }
 
-String JSON::ObjectValue::toString() const
+void JSON::ObjectValue::write(JSONWriter& writer) const
 {
-    String s("{ ");
-    bool first = true;
+    writer.startObject();
     for (auto const& it : _value) {
-        if (!first) {
-            s += ", ";
-        }
-        first = false;
-        
-        s += it.key;
-        s += " : ";
-        s += it.value->toString();
+        writer.key(it.key);
+        it.value->write(writer);
     }
-    s += " }";
-    return s;
+    writer.endObject();
 }
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "Error.h"
+#include "JSONWriter.h"
 #include "MString.h"
 #include "SharedPtr.h"
 
@@ -25,7 +26,8 @@ public:
     public:
         virtual ~Value() { }
         
-        virtual String toString() const = 0;
+        String toString() const;
+        virtual void write(JSONWriter&) const = 0;
     };
     
     class StringValue : public Value
@@ -33,7 +35,7 @@ public:
     public:
         StringValue(const String& v) : _value(v) { }
         
-        virtual String toString() const { return _value; }
+        virtual void write(JSONWriter& writer) const override { writer.value(_value); }
     
     private:
         String _value;
@@ -44,7 +46,7 @@ public:
     public:
         NumberValue(float v) : _value(v) { }
         
-        virtual String toString() const { return String(_value); }
+        virtual void write(JSONWriter& writer) const override { writer.value(_value); }
     
     private:
         float _value;
@@ -55,7 +57,7 @@ public:
     public:
         ObjectValue() { }
         
-        virtual String toString() const;
+        virtual void write(JSONWriter&) const override;
     
         Map<String, SharedPtr<Value>>& map() { return _value; }
 
@@ -68,7 +70,7 @@ public:
     public:
         ArrayValue() { }
         
-        virtual String toString() const;
+        virtual void write(JSONWriter&) const override;
         
         Vector<SharedPtr<Value>>& array() { return _value; }
     
@@ -81,7 +83,7 @@ public:
     public:
         BooleanValue(bool v) : _value(v) { }
         
-        virtual String toString() const { return _value ? "true" : "false"; }
+        virtual void write(JSONWriter& writer) const override { writer.value(_value); }
     
     private:
         bool _value;
@@ -92,7 +94,7 @@ public:
     public:
         NullValue() { }
         
-        virtual String toString() const { return "null"; }
+        virtual void write(JSONWriter& writer) const override { writer.null(); }
     };
 
     JSON() { }
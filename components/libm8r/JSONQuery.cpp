@@ -0,0 +1,362 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "JSONQuery.h"
+
+#include "Defines.h"
+#include "JSONReader.h"
+#include "MString.h"
+#include <cstring>
+#include <limits>
+
+using namespace m8r;
+
+static bool hex4(const char* p, const char* end, uint32_t& value)
+{
+    if (end - p < 4) {
+        return false;
+    }
+    value = 0;
+    for (int i = 0; i < 4; ++i) {
+        if (!isxdigit(p[i])) {
+            return false;
+        }
+        value = (value << 4) | JSONReader::hexValue(p[i]);
+    }
+    return true;
+}
+
+// Decode one character of a JSON string starting at p into UTF-8 bytes.
+// Advances p and returns the number of bytes, or 0 if malformed
+static uint8_t decodeChar(const char*& p, const char* end, uint8_t out[4])
+{
+    if (*p != '\\') {
+        out[0] = *p++;
+        return 1;
+    }
+
+    if (end - p < 2) {
+        return 0;
+    }
+
+    char c = p[1];
+    p += 2;
+    switch (c) {
+        case '"':
+        case '\\':
+        case '/': out[0] = c; return 1;
+        case 'b': out[0] = 0x08; return 1;
+        case 'f': out[0] = 0x0c; return 1;
+        case 'n': out[0] = 0x0a; return 1;
+        case 'r': out[0] = 0x0d; return 1;
+        case 't': out[0] = 0x09; return 1;
+        case 'u': break;
+        default: return 0;
+    }
+
+    uint32_t cp;
+    if (!hex4(p, end, cp)) {
+        return 0;
+    }
+    p += 4;
+
+    // Combine a surrogate pair if there is one
+    if (cp >= 0xd800 && cp <= 0xdbff && end - p >= 6 && p[0] == '\\' && p[1] == 'u') {
+        uint32_t low;
+        if (hex4(p + 2, end, low) && low >= 0xdc00 && low <= 0xdfff) {
+            cp = 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+            p += 6;
+        }
+    }
+
+    // An unpaired surrogate becomes U+FFFD, as in JSONReader
+    if (cp >= 0xd800 && cp <= 0xdfff) {
+        cp = JSONReader::ReplacementChar;
+    }
+    return JSONReader::encodeUTF8(cp, out);
+}
+
+bool JSONQuery::View::toFloat(float& value) const
+{
+    if (_type != Type::Number) {
+        return false;
+    }
+
+    class NumberHandler : public JSONReader::Handler
+    {
+    public:
+        NumberHandler(float& value) : _value(value) { }
+        virtual void number(float value) override { _value = value; }
+
+    private:
+        float& _value;
+    };
+
+    NumberHandler handler(value);
+    JSONReader reader(&handler);
+    return reader.parse(_data, _size);
+}
+
+bool JSONQuery::View::toBool(bool& value) const
+{
+    if (_type != Type::True && _type != Type::False) {
+        return false;
+    }
+    value = _type == Type::True;
+    return true;
+}
+
+bool JSONQuery::View::toString(String& value) const
+{
+    if (_type != Type::String) {
+        return false;
+    }
+
+    value.clear();
+    const char* end = _data + _size;
+    for (const char* p = _data; p < end; ) {
+        uint8_t buf[4];
+        uint8_t n = decodeChar(p, end, buf);
+        if (n == 0) {
+            return false;
+        }
+        for (uint8_t i = 0; i < n; ++i) {
+            value += buf[i];
+        }
+    }
+    return true;
+}
+
+JSONQuery::View JSONQuery::find(const char* pointer) const
+{
+    const char* p = skipWhitespace(_json);
+    if (!p || (*pointer != '\0' && *pointer != '/')) {
+        return View();
+    }
+
+    while (*pointer == '/') {
+        const char* token = pointer + 1;
+        const char* tokenEnd = token;
+        while (*tokenEnd != '\0' && *tokenEnd != '/') {
+            ++tokenEnd;
+        }
+
+        if (*p == '{') {
+            p = findMember(p, token, tokenEnd);
+        } else if (*p == '[') {
+            p = findElement(p, token, tokenEnd);
+        } else {
+            return View();
+        }
+
+        if (!p) {
+            return View();
+        }
+        pointer = tokenEnd;
+    }
+
+    return makeView(p);
+}
+
+const char* JSONQuery::skipWhitespace(const char* p) const
+{
+    while (p < _end && isspace(*p)) {
+        ++p;
+    }
+    return (p < _end) ? p : nullptr;
+}
+
+const char* JSONQuery::skipString(const char* p) const
+{
+    for (++p; p < _end; ++p) {
+        if (*p == '\\') {
+            ++p;
+        } else if (*p == '"') {
+            return p + 1;
+        }
+    }
+    return nullptr;
+}
+
+const char* JSONQuery::skipValue(const char* p) const
+{
+    switch (*p) {
+        case '"':
+            return skipString(p);
+        case '{':
+        case '[': {
+            // Only brackets matter, as long as brackets in strings are ignored
+            uint32_t depth = 0;
+            while (p < _end) {
+                char c = *p;
+                if (c == '"') {
+                    p = skipString(p);
+                    if (!p) {
+                        return nullptr;
+                    }
+                    continue;
+                }
+                if (c == '{' || c == '[') {
+                    ++depth;
+                } else if (c == '}' || c == ']') {
+                    if (--depth == 0) {
+                        return p + 1;
+                    }
+                }
+                ++p;
+            }
+            return nullptr;
+        }
+        default:
+            while (p < _end && *p != ',' && *p != '}' && *p != ']' && !isspace(*p)) {
+                ++p;
+            }
+            return p;
+    }
+}
+
+const char* JSONQuery::findMember(const char* p, const char* token, const char* tokenEnd) const
+{
+    p = skipWhitespace(p + 1);
+    if (!p || *p == '}') {
+        return nullptr;
+    }
+
+    while (true) {
+        if (*p != '"') {
+            return nullptr;
+        }
+        const char* key = p + 1;
+        p = skipString(p);
+        if (!p || !(p = skipWhitespace(p)) || *p != ':') {
+            return nullptr;
+        }
+        p = skipWhitespace(p + 1);
+        if (!p) {
+            return nullptr;
+        }
+
+        if (keyMatches(key, token, tokenEnd)) {
+            return p;
+        }
+
+        p = skipValue(p);
+        if (!p || !(p = skipWhitespace(p)) || *p != ',') {
+            return nullptr;
+        }
+        p = skipWhitespace(p + 1);
+        if (!p) {
+            return nullptr;
+        }
+    }
+}
+
+const char* JSONQuery::findElement(const char* p, const char* token, const char* tokenEnd) const
+{
+    // Index must be a decimal number without leading zeros
+    if (token == tokenEnd || (*token == '0' && tokenEnd - token > 1)) {
+        return nullptr;
+    }
+    uint32_t index = 0;
+    for (const char* t = token; t < tokenEnd; ++t) {
+        if (!isdigit(*t)) {
+            return nullptr;
+        }
+        uint32_t digit = *t - '0';
+        if (index > (std::numeric_limits<uint32_t>::max() - digit) / 10) {
+            return nullptr;
+        }
+        index = index * 10 + digit;
+    }
+
+    p = skipWhitespace(p + 1);
+    if (!p || *p == ']') {
+        return nullptr;
+    }
+
+    for (uint32_t i = 0; ; ++i) {
+        if (i == index) {
+            return p;
+        }
+        p = skipValue(p);
+        if (!p || !(p = skipWhitespace(p)) || *p != ',') {
+            return nullptr;
+        }
+        p = skipWhitespace(p + 1);
+        if (!p) {
+            return nullptr;
+        }
+    }
+}
+
+bool JSONQuery::keyMatches(const char* key, const char* token, const char* tokenEnd) const
+{
+    // Compare the decoded key to the token with its '~0' and '~1' escapes
+    // decoded, one byte at a time
+    const char* t = token;
+    while (key < _end) {
+        if (*key == '"') {
+            return t == tokenEnd;
+        }
+
+        uint8_t buf[4];
+        uint8_t n = decodeChar(key, _end, buf);
+        if (n == 0) {
+            return false;
+        }
+
+        for (uint8_t i = 0; i < n; ++i) {
+            if (t == tokenEnd) {
+                return false;
+            }
+            char c = *t++;
+            if (c == '~') {
+                // RFC 6901 has only these two escapes
+                if (t == tokenEnd || (*t != '0' && *t != '1')) {
+                    return false;
+                }
+                c = (*t++ == '1') ? '/' : '~';
+            }
+            if (static_cast<uint8_t>(c) != buf[i]) {
+                return false;
+            }
+        }
+    }
+    return false;
+}
+
+JSONQuery::View JSONQuery::makeView(const char* p) const
+{
+    const char* end = skipValue(p);
+    if (!end) {
+        return View();
+    }
+
+    uint32_t size = static_cast<uint32_t>(end - p);
+    switch (*p) {
+        case '{': return View(Type::Object, p, size);
+        case '[': return View(Type::Array, p, size);
+        case '"': return View(Type::String, p + 1, size - 2);
+        default: break;
+    }
+
+    if (size == 4 && memcmp(p, "true", 4) == 0) {
+        return View(Type::True, p, size);
+    }
+    if (size == 5 && memcmp(p, "false", 5) == 0) {
+        return View(Type::False, p, size);
+    }
+    if (size == 4 && memcmp(p, "null", 4) == 0) {
+        return View(Type::Null, p, size);
+    }
+    if (*p == '-' || isdigit(*p)) {
+        return View(Type::Number, p, size);
+    }
+    return View();
+}
@@ -0,0 +1,99 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace m8r {
+
+class String;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: JSONQuery
+//
+//  Pulls individual fields out of JSON text without parsing the whole
+//  thing. Fields are addressed with RFC 6901 JSON Pointers, for instance
+//  "/config/wifi/ssid" or "/list/0". The text is scanned from the start
+//  each time. Members and elements that aren't on the path are skipped
+//  by matching brackets and quotes, without being decoded. No memory is
+//  allocated and the text is not copied.
+//
+//  A found value is returned as a View into the original text. The
+//  text must outlive it. String views cover the characters between the
+//  quotes with escapes still in place. toString() decodes them.
+//
+//  Text outside the path is not validated, so malformed JSON there
+//  may go unnoticed.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class JSONQuery {
+public:
+    enum class Type : uint8_t { None, Object, Array, String, Number, True, False, Null };
+
+    class View
+    {
+        friend class JSONQuery;
+
+    public:
+        View() { }
+
+        Type type() const { return _type; }
+        bool valid() const { return _type != Type::None; }
+
+        // Raw text of the value. For strings it excludes the quotes
+        const char* data() const { return _data; }
+        uint32_t size() const { return _size; }
+
+        bool toFloat(float&) const;
+        bool toBool(bool&) const;
+        bool toString(String&) const;
+
+    private:
+        View(Type type, const char* data, uint32_t size) : _type(type), _data(data), _size(size) { }
+
+        Type _type = Type::None;
+        const char* _data = nullptr;
+        uint32_t _size = 0;
+    };
+
+    JSONQuery(const char* json, uint32_t size) : _json(json), _end(json + size) { }
+
+    // An empty pointer returns the whole document
+    View find(const char* pointer) const;
+
+    // Shortcuts for find() followed by a conversion. False if the value
+    // is missing or the wrong type
+    bool getFloat(const char* pointer, float& value) const { return find(pointer).toFloat(value); }
+    bool getBool(const char* pointer, bool& value) const { return find(pointer).toBool(value); }
+    bool getString(const char* pointer, String& value) const { return find(pointer).toString(value); }
+
+private:
+    const char* skipWhitespace(const char*) const;
+
+    // Return the end of the value at p, or nullptr if it is malformed
+    const char* skipValue(const char*) const;
+    const char* skipString(const char*) const;
+
+    // Find the member of the object at p matching the pointer token
+    // [token, tokenEnd). Returns the start of its value or nullptr
+    const char* findMember(const char* p, const char* token, const char* tokenEnd) const;
+    const char* findElement(const char* p, const char* token, const char* tokenEnd) const;
+
+    bool keyMatches(const char* key, const char* token, const char* tokenEnd) const;
+
+    View makeView(const char* p) const;
+
+    const char* _json;
+    const char* _end;
+};
+
+}
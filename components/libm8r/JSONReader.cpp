@@ -0,0 +1,535 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "JSONReader.h"
+
+#include "Defines.h"
+#include "MStream.h"
+#include <algorithm>
+
+using namespace m8r;
+
+// Mantissa digits past this are dropped and just bump the exponent
+static constexpr uint32_t MaxMantissa = 100000000;
+
+static float pow10(int32_t e)
+{
+    bool neg = false;
+    if (e < 0) {
+        neg = true;
+        e = -e;
+    }
+
+    float r = 1;
+    float p = 10;
+
+    while (true) {
+        if (e % 2 == 1) {
+            r *= p;
+            e--;
+        }
+        if (e == 0) {
+            break;
+        }
+        p *= p;
+        e /= 2;
+    }
+    return neg ? (1 / r) : r;
+}
+
+uint8_t JSONReader::hexValue(uint8_t c)
+{
+    return isdigit(c) ? (c - '0') : (isUpper(c) ? (c - 'A' + 10) : (c - 'a' + 10));
+}
+
+uint8_t JSONReader::encodeUTF8(uint32_t c, uint8_t out[4])
+{
+    if (c < 0x80) {
+        out[0] = c;
+        return 1;
+    }
+    if (c < 0x800) {
+        out[0] = 0xc0 | (c >> 6);
+        out[1] = 0x80 | (c & 0x3f);
+        return 2;
+    }
+    if (c < 0x10000) {
+        out[0] = 0xe0 | (c >> 12);
+        out[1] = 0x80 | ((c >> 6) & 0x3f);
+        out[2] = 0x80 | (c & 0x3f);
+        return 3;
+    }
+    out[0] = 0xf0 | (c >> 18);
+    out[1] = 0x80 | ((c >> 12) & 0x3f);
+    out[2] = 0x80 | ((c >> 6) & 0x3f);
+    out[3] = 0x80 | (c & 0x3f);
+    return 4;
+}
+
+void JSONReader::reset()
+{
+    _state = State::Value;
+    _error = Error::Code::OK;
+    _line = 1;
+    _column = 0;
+    _containerStack = 0;
+    _depth = 0;
+    _stringSize = 0;
+    _highSurrogate = 0;
+}
+
+bool JSONReader::parse(const char* buf, uint32_t size)
+{
+    reset();
+    return feed(buf, size) && finish();
+}
+
+bool JSONReader::parse(const Stream& stream)
+{
+    reset();
+    
+    // Parse in place if the stream is in memory, otherwise in chunks
+    uint32_t size;
+    const uint8_t* data = stream.span(size);
+    if (data) {
+        bool result = feed(reinterpret_cast<const char*>(data), size) && finish();
+        stream.skip(size);
+        return result;
+    }
+
+    uint8_t buf[32];
+    while (true) {
+        int32_t result = stream.read(buf, sizeof(buf));
+        if (result < 0) {
+            return fail();
+        }
+        if (result == 0) {
+            break;
+        }
+        if (!feed(reinterpret_cast<const char*>(buf), result)) {
+            return false;
+        }
+    }
+    return finish();
+}
+
+bool JSONReader::feed(const char* buf, uint32_t size)
+{
+    if (_state == State::Failed) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < size; ++i) {
+        if (!consume(buf[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool JSONReader::finish()
+{
+    switch (_state) {
+        case State::NumberZero:
+        case State::NumberInteger:
+        case State::NumberFraction:
+        case State::NumberExponent:
+            // A top level number is only terminated by the end of input
+            if (!endNumber()) {
+                return false;
+            }
+            break;
+        default:
+            break;
+    }
+
+    if (_state == State::Done) {
+        return true;
+    }
+    return (_state == State::Failed) ? false : fail();
+}
+
+bool JSONReader::fail()
+{
+    _error = Error::Code::ParseError;
+    _state = State::Failed;
+    return false;
+}
+
+bool JSONReader::consume(char ch)
+{
+    uint8_t c = static_cast<uint8_t>(ch);
+    if (c == '\n') {
+        ++_line;
+        _column = 0;
+    } else {
+        ++_column;
+    }
+
+    // Numbers are only terminated by the character following them. In
+    // that case the number is ended and we loop to handle the character
+    while (true) {
+        switch (_state) {
+            case State::FirstValueOrEnd:
+                if (c == ']') {
+                    return endContainer(false);
+                }
+                // Fall through
+            case State::Value:
+                if (isspace(c)) {
+                    return true;
+                }
+                switch (c) {
+                    case '{': return startContainer(true);
+                    case '[': return startContainer(false);
+                    case '"':
+                        _isKey = false;
+                        _stringSize = 0;
+                        _state = State::String;
+                        return true;
+                    case 't': _literal = "true"; break;
+                    case 'f': _literal = "false"; break;
+                    case 'n': _literal = "null"; break;
+                    case '-':
+                        startNumber();
+                        _negative = true;
+                        _state = State::NumberSign;
+                        return true;
+                    default:
+                        if (!isdigit(c)) {
+                            return fail();
+                        }
+                        startNumber();
+                        _mantissa = c - '0';
+                        _state = (c == '0') ? State::NumberZero : State::NumberInteger;
+                        return true;
+                }
+                _literalIndex = 1;
+                _state = State::Literal;
+                return true;
+            case State::FirstKeyOrEnd:
+                if (c == '}') {
+                    return endContainer(true);
+                }
+                // Fall through
+            case State::Key:
+                if (isspace(c)) {
+                    return true;
+                }
+                if (c != '"') {
+                    return fail();
+                }
+                _isKey = true;
+                _stringSize = 0;
+                _state = State::String;
+                return true;
+            case State::Colon:
+                if (isspace(c)) {
+                    return true;
+                }
+                if (c != ':') {
+                    return fail();
+                }
+                _state = State::Value;
+                return true;
+            case State::AfterValue:
+                if (isspace(c)) {
+                    return true;
+                }
+                switch (c) {
+                    case ',': _state = inObject() ? State::Key : State::Value; return true;
+                    case '}': return endContainer(true);
+                    case ']': return endContainer(false);
+                    default: return fail();
+                }
+            case State::String:
+                if (c == '"') {
+                    return endString();
+                }
+                if (c == '\\') {
+                    _state = State::StringEscape;
+                    return true;
+                }
+                if (c < 0x20) {
+                    return fail();
+                }
+                return appendChar(c);
+            case State::StringEscape:
+                _state = State::String;
+                switch (c) {
+                    case '"':
+                    case '\\':
+                    case '/': return appendChar(c);
+                    case 'b': return appendChar(0x08);
+                    case 'f': return appendChar(0x0c);
+                    case 'n': return appendChar(0x0a);
+                    case 'r': return appendChar(0x0d);
+                    case 't': return appendChar(0x09);
+                    case 'u':
+                        _unicodeDigits = 0;
+                        _unicodeValue = 0;
+                        _state = State::StringUnicode;
+                        return true;
+                    default: return fail();
+                }
+            case State::StringUnicode:
+                if (!isxdigit(c)) {
+                    return fail();
+                }
+                _unicodeValue = (_unicodeValue << 4) | hexValue(c);
+                if (++_unicodeDigits < 4) {
+                    return true;
+                }
+                _state = State::String;
+                return appendCodePoint(_unicodeValue);
+            case State::NumberSign:
+                if (!isdigit(c)) {
+                    return fail();
+                }
+                _mantissa = c - '0';
+                _state = (c == '0') ? State::NumberZero : State::NumberInteger;
+                return true;
+            case State::NumberInteger:
+                if (isdigit(c)) {
+                    if (_mantissa < MaxMantissa) {
+                        _mantissa = _mantissa * 10 + (c - '0');
+                    } else {
+                        ++_exponent;
+                    }
+                    return true;
+                }
+                // Fall through
+            case State::NumberZero:
+                if (c == '.') {
+                    _state = State::NumberFractionStart;
+                    return true;
+                }
+                if (c == 'e' || c == 'E') {
+                    _state = State::NumberExponentStart;
+                    return true;
+                }
+                if (!endNumber()) {
+                    return false;
+                }
+                continue;
+            case State::NumberFractionStart:
+                if (!isdigit(c)) {
+                    return fail();
+                }
+                _state = State::NumberFraction;
+                // Fall through
+            case State::NumberFraction:
+                if (isdigit(c)) {
+                    if (_mantissa < MaxMantissa) {
+                        _mantissa = _mantissa * 10 + (c - '0');
+                        --_exponent;
+                    }
+                    return true;
+                }
+                if (c == 'e' || c == 'E') {
+                    _state = State::NumberExponentStart;
+                    return true;
+                }
+                if (!endNumber()) {
+                    return false;
+                }
+                continue;
+            case State::NumberExponentStart:
+                if (c == '+' || c == '-') {
+                    _negativeExponent = c == '-';
+                    _state = State::NumberExponentSign;
+                    return true;
+                }
+                // Fall through
+            case State::NumberExponentSign:
+                if (!isdigit(c)) {
+                    return fail();
+                }
+                _explicitExponent = c - '0';
+                _state = State::NumberExponent;
+                return true;
+            case State::NumberExponent:
+                if (isdigit(c)) {
+                    // Anything this big is already out of range for a float
+                    if (_explicitExponent < 1000) {
+                        _explicitExponent = _explicitExponent * 10 + (c - '0');
+                    }
+                    return true;
+                }
+                if (!endNumber()) {
+                    return false;
+                }
+                continue;
+            case State::Literal:
+                if (c != static_cast<uint8_t>(_literal[_literalIndex])) {
+                    return fail();
+                }
+                if (_literal[++_literalIndex] != '\0') {
+                    return true;
+                }
+                if (_literal[0] == 'n') {
+                    _handler->null();
+                } else {
+                    _handler->boolean(_literal[0] == 't');
+                }
+                return endValue();
+            case State::Done:
+                return isspace(c) ? true : fail();
+            case State::Failed:
+                return false;
+        }
+    }
+}
+
+bool JSONReader::startContainer(bool object)
+{
+    if (_depth >= MaxDepth) {
+        return fail();
+    }
+
+    if (object) {
+        _containerStack |= 1u << _depth;
+    } else {
+        _containerStack &= ~(1u << _depth);
+    }
+    ++_depth;
+
+    if (object) {
+        _handler->startObject();
+        _state = State::FirstKeyOrEnd;
+    } else {
+        _handler->startArray();
+        _state = State::FirstValueOrEnd;
+    }
+    return true;
+}
+
+bool JSONReader::endContainer(bool object)
+{
+    if (_depth == 0 || inObject() != object) {
+        return fail();
+    }
+    --_depth;
+
+    if (object) {
+        _handler->endObject();
+    } else {
+        _handler->endArray();
+    }
+    return endValue();
+}
+
+bool JSONReader::endValue()
+{
+    _state = (_depth == 0) ? State::Done : State::AfterValue;
+    return true;
+}
+
+void JSONReader::startNumber()
+{
+    _negative = false;
+    _negativeExponent = false;
+    _mantissa = 0;
+    _exponent = 0;
+    _explicitExponent = 0;
+}
+
+bool JSONReader::endNumber()
+{
+    int32_t exponent = _exponent + (_negativeExponent ? -_explicitExponent : _explicitExponent);
+    float value = static_cast<float>(_mantissa);
+    if (exponent) {
+        value *= pow10(exponent);
+    }
+    _handler->number(_negative ? -value : value);
+    return endValue();
+}
+
+bool JSONReader::appendChar(uint8_t c)
+{
+    if (_highSurrogate && !flushSurrogate()) {
+        return false;
+    }
+
+    // Leave room for the terminating '\0'
+    if (_stringSize + 1u >= _string.size()) {
+        if (_string.size() >= static_cast<size_t>(_maxStringSize)) {
+            return fail();
+        }
+        uint32_t size = _string.empty() ? InitialStringSize : (_string.size() * 2);
+        _string.resize(static_cast<uint16_t>(std::min(size, static_cast<uint32_t>(_maxStringSize))));
+    }
+    _string[_stringSize++] = c;
+    return true;
+}
+
+bool JSONReader::appendCodePoint(uint32_t c)
+{
+    bool low = c >= 0xdc00 && c <= 0xdfff;
+    if (_highSurrogate) {
+        if (low) {
+            c = 0x10000 + ((_highSurrogate - 0xd800) << 10) + (c - 0xdc00);
+            _highSurrogate = 0;
+            return appendUTF8(c);
+        }
+        if (!flushSurrogate()) {
+            return false;
+        }
+    }
+
+    if (c >= 0xd800 && c <= 0xdbff) {
+        // Wait for the low half
+        _highSurrogate = c;
+        return true;
+    }
+    if (low) {
+        c = ReplacementChar;
+    }
+    return appendUTF8(c);
+}
+
+bool JSONReader::flushSurrogate()
+{
+    // Unpaired high surrogate
+    _highSurrogate = 0;
+    return appendUTF8(ReplacementChar);
+}
+
+bool JSONReader::appendUTF8(uint32_t c)
+{
+    uint8_t buf[4];
+    uint8_t size = encodeUTF8(c, buf);
+    for (uint8_t i = 0; i < size; ++i) {
+        if (!appendChar(buf[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool JSONReader::endString()
+{
+    if (_highSurrogate && !flushSurrogate()) {
+        return false;
+    }
+
+    if (_string.empty()) {
+        _string.resize(InitialStringSize);
+    }
+    _string[_stringSize] = '\0';
+
+    if (_isKey) {
+        _handler->key(_string.begin(), _stringSize);
+        _state = State::Colon;
+        return true;
+    }
+
+    _handler->string(_string.begin(), _stringSize);
+    return endValue();
+}
@@ -0,0 +1,180 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Containers.h"
+#include "Error.h"
+#include <cstdint>
+
+namespace m8r {
+
+class Stream;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: JSONReader
+//
+//  Event driven (SAX style) JSON parser. Rather than building a tree of
+//  Values like JSON::parse, it calls methods on a Handler as each token
+//  is recognized. Input is pushed in with feed(), in chunks of any size,
+//  so it can parse data as it arrives from a socket. A token split
+//  across chunks is picked up where it left off.
+//
+//  Nesting is tracked in a bit stack, so depth is limited to MaxDepth.
+//  Strings and keys are collected in a buffer, with escapes decoded. It
+//  starts at InitialStringSize bytes and doubles as needed, up to the
+//  maxStringSize passed to the constructor. Longer strings are an error.
+//  Numbers are accumulated as they are scanned.
+//
+//  Escaped UTF-16 surrogate pairs are combined. An unpaired surrogate
+//  can't be encoded as UTF-8, so it becomes U+FFFD.
+//
+//  Errors are reported with the line and column (both 1 based) of the
+//  offending character.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class JSONReader {
+public:
+    static constexpr uint8_t MaxDepth = 32;
+    static constexpr uint16_t InitialStringSize = 128;
+    static constexpr uint16_t MaxStringSize = 16 * 1024;
+
+    // U+FFFD, which stands in for unpaired surrogates
+    static constexpr uint32_t ReplacementChar = 0xfffd;
+
+    class Handler
+    {
+    public:
+        virtual ~Handler() { }
+
+        virtual void startObject() { }
+        virtual void endObject() { }
+        virtual void startArray() { }
+        virtual void endArray() { }
+
+        // String values are only valid for the duration of the call.
+        // JSONReader '\0' terminates them but other sources (CBORReader)
+        // pass them in place, so use the length
+        virtual void key(const char*, uint16_t /*length*/) { }
+        virtual void string(const char*, uint16_t /*length*/) { }
+        virtual void number(float) { }
+        virtual void boolean(bool) { }
+        virtual void null() { }
+
+        // Byte strings. Only CBORReader produces these
+        virtual void bytes(const uint8_t*, uint32_t /*size*/) { }
+    };
+
+    // maxStringSize includes the terminating '\0'
+    JSONReader(Handler* handler, uint16_t maxStringSize = MaxStringSize)
+        : _handler(handler)
+        , _maxStringSize(maxStringSize)
+    { }
+
+    // Parse a complete document
+    bool parse(const char* buf, uint32_t size);
+    bool parse(const Stream&);
+
+    // Incremental parsing. Call feed() with each chunk of input then
+    // finish() once there is no more. Both return false on error
+    bool feed(const char* buf, uint32_t size);
+    bool finish();
+
+    void reset();
+
+    // True once a complete top level value has been seen
+    bool complete() const { return _state == State::Done; }
+
+    Error error() const { return _error; }
+    uint32_t line() const { return _line; }
+    uint32_t column() const { return _column; }
+
+    // Also used by JSONQuery, which decodes strings in place. hexValue()
+    // takes a hex digit. encodeUTF8() writes the code point to out and
+    // returns the number of bytes
+    static uint8_t hexValue(uint8_t c);
+    static uint8_t encodeUTF8(uint32_t c, uint8_t out[4]);
+
+private:
+    enum class State : uint8_t {
+        Value,              // Expecting a value
+        FirstKeyOrEnd,      // After '{'
+        FirstValueOrEnd,    // After '['
+        Key,                // After ',' in an object
+        Colon,              // After a key
+        AfterValue,         // Expecting ',', a closing bracket or the end of input
+        String,
+        StringEscape,
+        StringUnicode,
+        NumberSign,         // After '-'
+        NumberZero,         // Leading '0'
+        NumberInteger,
+        NumberFractionStart,
+        NumberFraction,
+        NumberExponentStart,
+        NumberExponentSign,
+        NumberExponent,
+        Literal,            // Inside true, false or null
+        Done,
+        Failed,
+    };
+
+    bool consume(char c);
+    bool fail();
+
+    bool startContainer(bool object);
+    bool endContainer(bool object);
+    bool endValue();
+
+    void startNumber();
+    bool endNumber();
+
+    bool appendChar(uint8_t c);
+    bool appendCodePoint(uint32_t c);
+    bool flushSurrogate();
+    bool appendUTF8(uint32_t c);
+    bool endString();
+
+    bool inObject() const { return _depth > 0 && (_containerStack & (1u << (_depth - 1))); }
+
+    Handler* _handler;
+    uint16_t _maxStringSize;
+
+    State _state = State::Value;
+    Error _error;
+    uint32_t _line = 1;
+    uint32_t _column = 0;
+
+    // Bit for each nesting level. 1 for object, 0 for array
+    uint32_t _containerStack = 0;
+    uint8_t _depth = 0;
+
+    // String state
+    bool _isKey = false;
+    uint8_t _unicodeDigits = 0;
+    uint32_t _unicodeValue = 0;
+    uint32_t _highSurrogate = 0;
+    uint16_t _stringSize = 0;
+    Vector<char> _string;
+
+    // Number state
+    bool _negative = false;
+    bool _negativeExponent = false;
+    uint32_t _mantissa = 0;
+    int32_t _exponent = 0;
+    int32_t _explicitExponent = 0;
+
+    // Literal state
+    const char* _literal = nullptr;
+    uint8_t _literalIndex = 0;
+};
+
+}
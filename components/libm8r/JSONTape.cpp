@@ -0,0 +1,287 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "JSONTape.h"
+
+#include "JSONReader.h"
+#include "JSONWriter.h"
+#include <cstring>
+
+using namespace m8r;
+
+// JSONReader handler which appends entries to the tape. With a null tape
+// it only counts, to size the region for the real pass
+class JSONTape::Builder : public JSONReader::Handler
+{
+public:
+    Builder(uint64_t* tape, char* arena) : _tape(tape), _arena(arena) { }
+
+    uint32_t tapeSize() const { return _tapeSize; }
+    uint32_t arenaSize() const { return _arenaSize; }
+
+    virtual void startObject() override { start(Type::Object); }
+    virtual void endObject() override { end(Type::ObjectEnd); }
+    virtual void startArray() override { start(Type::Array); }
+    virtual void endArray() override { end(Type::ArrayEnd); }
+
+    virtual void key(const char* s, uint16_t length) override { addString(s, length); }
+    virtual void string(const char* s, uint16_t length) override { countElement(); addString(s, length); }
+
+    virtual void number(float value) override
+    {
+        countElement();
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        add(Type::Number, bits);
+    }
+
+    virtual void boolean(bool value) override { countElement(); add(value ? Type::True : Type::False, 0); }
+    virtual void null() override { countElement(); add(Type::Null, 0); }
+
+private:
+    void add(Type type, uint64_t payload)
+    {
+        if (_tape) {
+            _tape[_tapeSize] = (static_cast<uint64_t>(type) << 56) | payload;
+        }
+        ++_tapeSize;
+    }
+
+    void addString(const char* s, uint16_t length)
+    {
+        if (_arena) {
+            memcpy(_arena + _arenaSize, s, length);
+            _arena[_arenaSize + length] = '\0';
+        }
+        add(Type::String, (static_cast<uint64_t>(length) << 32) | _arenaSize);
+        _arenaSize += length + 1;
+    }
+
+    void countElement()
+    {
+        if (_depth) {
+            ++_counts[_depth - 1];
+        }
+    }
+
+    void start(Type type)
+    {
+        countElement();
+        _starts[_depth] = _tapeSize;
+        _counts[_depth] = 0;
+        ++_depth;
+        add(type, 0);
+    }
+
+    void end(Type type)
+    {
+        --_depth;
+        uint32_t start = _starts[_depth];
+        if (_tape) {
+            _tape[start] |= (static_cast<uint64_t>(_counts[_depth]) << 32) | _tapeSize;
+        }
+        add(type, start);
+    }
+
+    uint64_t* _tape;
+    char* _arena;
+    uint32_t _tapeSize = 0;
+    uint32_t _arenaSize = 0;
+
+    uint32_t _starts[JSONReader::MaxDepth];
+    uint32_t _counts[JSONReader::MaxDepth];
+    uint8_t _depth = 0;
+};
+
+bool JSONTape::parse(const char* json, uint32_t size)
+{
+    clear();
+
+    Builder counter(nullptr, nullptr);
+    JSONReader countReader(&counter);
+    if (!countReader.parse(json, size)) {
+        _error = countReader.error();
+        _errorLine = countReader.line();
+        return false;
+    }
+
+    // Region is allocated in 8 byte units, which must fit in 16 bits
+    uint32_t tapeSize = counter.tapeSize();
+    uint32_t arenaUnits = (counter.arenaSize() + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    if (tapeSize + arenaUnits > 0xffff) {
+        _error = Error::Code::OutOfMemory;
+        return false;
+    }
+
+    _region = Mallocator::shared()->allocate<uint64_t>(MemoryType::Native, tapeSize + arenaUnits);
+    if (!_region.valid()) {
+        _error = Error::Code::OutOfMemory;
+        return false;
+    }
+
+    char* arena = reinterpret_cast<char*>(_region.get() + tapeSize);
+    Builder builder(_region.get(), arena);
+    JSONReader reader(&builder);
+    if (!reader.parse(json, size)) {
+        // Can't happen, the counting pass accepted the same input
+        _error = Error::Code::InternalError;
+        clear();
+        return false;
+    }
+
+    _tape = _region.get();
+    _arena = arena;
+    _tapeSize = tapeSize;
+    _arenaSize = counter.arenaSize();
+    return true;
+}
+
+void JSONTape::clear()
+{
+    if (_region.valid()) {
+        Mallocator::shared()->deallocate(MemoryType::Native, _region);
+        _region.reset();
+    }
+    _tape = nullptr;
+    _arena = nullptr;
+    _tapeSize = 0;
+    _arenaSize = 0;
+    _error = Error::Code::OK;
+    _errorLine = 0;
+}
+
+float JSONTape::number(uint32_t index) const
+{
+    uint32_t bits = payload(index);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint32_t JSONTape::skip(uint32_t index) const
+{
+    switch (type(index)) {
+        case Type::Object:
+        case Type::Array: return payload(index) + 1;
+        default: return index + 1;
+    }
+}
+
+uint32_t JSONTape::Value::size() const
+{
+    switch (type()) {
+        case Type::Object:
+        case Type::Array:
+        case Type::String: return _tape->count(_index);
+        default: return 0;
+    }
+}
+
+JSONTape::Value JSONTape::Value::operator[](const char* key) const
+{
+    if (!isObject()) {
+        return Value();
+    }
+    for (Value it = first(); it.valid(); it = it.next()) {
+        if (strcmp(it.toString(), key) == 0) {
+            return it.value();
+        }
+    }
+    return Value();
+}
+
+JSONTape::Value JSONTape::Value::operator[](uint32_t index) const
+{
+    if (!isArray() || index >= size()) {
+        return Value();
+    }
+    uint32_t i = _index + 1;
+    while (index--) {
+        i = _tape->skip(i);
+    }
+    return Value(_tape, i);
+}
+
+JSONTape::Value JSONTape::Value::first() const
+{
+    if ((!isObject() && !isArray()) || size() == 0) {
+        return Value();
+    }
+    return Value(_tape, _index + 1, isObject());
+}
+
+JSONTape::Value JSONTape::Value::next() const
+{
+    if (!valid()) {
+        return Value();
+    }
+
+    // Keys are followed by their value, which must be skipped too
+    uint32_t i = _tape->skip(_key ? (_index + 1) : _index);
+    Type t = _tape->type(i);
+    if (t == Type::ObjectEnd || t == Type::ArrayEnd) {
+        return Value();
+    }
+    return Value(_tape, i, _key);
+}
+
+JSONTape::Value JSONTape::Value::value() const
+{
+    return _key ? Value(_tape, _index + 1) : *this;
+}
+
+String JSONTape::stringify(const Value& value) const
+{
+    String s;
+    JSONWriter writer(s);
+    write(writer, value);
+    writer.flush();
+    return s;
+}
+
+void JSONTape::write(JSONWriter& writer, const Value& value) const
+{
+    if (value.valid()) {
+        write(writer, value._index);
+    }
+}
+
+void JSONTape::write(JSONWriter& writer, uint32_t index) const
+{
+    switch (type(index)) {
+        case Type::Object:
+        case Type::Array: {
+            bool object = type(index) == Type::Object;
+            if (object) {
+                writer.startObject();
+            } else {
+                writer.startArray();
+            }
+            uint32_t end = payload(index);
+            for (uint32_t i = index + 1; i < end; i = skip(i)) {
+                if (object) {
+                    writer.key(string(i++));
+                }
+                write(writer, i);
+            }
+            if (object) {
+                writer.endObject();
+            } else {
+                writer.endArray();
+            }
+            break;
+        }
+        case Type::String: writer.value(string(index)); break;
+        case Type::Number: writer.value(number(index)); break;
+        case Type::True: writer.value(true); break;
+        case Type::False: writer.value(false); break;
+        case Type::Null: writer.null(); break;
+        default: break;
+    }
+}
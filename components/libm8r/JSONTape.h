@@ -0,0 +1,158 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Error.h"
+#include "Mallocator.h"
+#include "MString.h"
+
+namespace m8r {
+
+class JSONWriter;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: JSONTape
+//
+//  Compact alternative to the JSON Value tree. A parsed document is a flat
+//  array of 64 bit entries (the tape) followed by an arena holding all the
+//  strings, both in a single allocation which is freed in one shot.
+//
+//  Each entry has a Type in its top 8 bits and a 56 bit payload:
+//
+//      Object, Array   - element count in bits 32-55, index of the
+//                        matching end entry in bits 0-31
+//      ObjectEnd,
+//      ArrayEnd        - index of the matching start entry
+//      String          - length in bits 32-55, arena offset in bits 0-31
+//      Number          - float bits in bits 0-31
+//      True, False,
+//      Null            - no payload
+//
+//  Object members are a String entry for the key followed by the value.
+//  Strings in the arena are '\0' terminated.
+//
+//  parse() makes a counting pass over the input with JSONReader so the
+//  region can be allocated at its exact size, then a second pass to fill
+//  it in.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class JSONTape {
+public:
+    enum class Type : uint8_t {
+        None        = 0,
+        Object      = '{',
+        ObjectEnd   = '}',
+        Array       = '[',
+        ArrayEnd    = ']',
+        String      = '"',
+        Number      = 'd',
+        True        = 't',
+        False       = 'f',
+        Null        = 'n',
+    };
+
+    // Lightweight handle to an entry on the tape. Only valid while the
+    // JSONTape it came from is alive and not reparsed
+    class Value
+    {
+        friend class JSONTape;
+
+    public:
+        Value() { }
+
+        bool valid() const { return _tape; }
+        Type type() const { return valid() ? _tape->type(_index) : Type::None; }
+
+        bool isObject() const { return type() == Type::Object; }
+        bool isArray() const { return type() == Type::Array; }
+        bool isString() const { return type() == Type::String; }
+        bool isNumber() const { return type() == Type::Number; }
+        bool isBool() const { return type() == Type::True || type() == Type::False; }
+        bool isNull() const { return type() == Type::Null; }
+
+        float toFloat() const { return isNumber() ? _tape->number(_index) : 0; }
+        bool toBool() const { return type() == Type::True; }
+        const char* toString() const { return isString() ? _tape->string(_index) : ""; }
+
+        // Number of members or elements for containers, length for strings
+        uint32_t size() const;
+
+        // Object member by key. Members are searched in order
+        Value operator[](const char* key) const;
+
+        // Array element by index
+        Value operator[](uint32_t index) const;
+
+        // Iteration over members or elements. For objects, first()
+        // and next() return the key. Its value() is the member value
+        Value first() const;
+        Value next() const;
+        Value value() const;
+
+    private:
+        Value(const JSONTape* tape, uint32_t index, bool key = false) : _tape(tape), _index(index), _key(key) { }
+
+        const JSONTape* _tape = nullptr;
+        uint32_t _index = 0;
+        bool _key = false;
+    };
+
+    JSONTape() { }
+    ~JSONTape() { clear(); }
+
+    JSONTape(const JSONTape&) = delete;
+    JSONTape& operator=(const JSONTape&) = delete;
+
+    bool parse(const char* json, uint32_t size);
+    bool parse(const String& json) { return parse(json.c_str(), static_cast<uint32_t>(json.size())); }
+
+    void clear();
+
+    Value root() const { return _tapeSize ? Value(this, 0) : Value(); }
+
+    String stringify() const { return stringify(root()); }
+    String stringify(const Value&) const;
+    void write(JSONWriter&, const Value&) const;
+
+    Error error() const { return _error; }
+    uint32_t errorLine() const { return _errorLine; }
+
+    // Bytes used by the tape and string arena
+    uint32_t size() const { return _tapeSize * sizeof(uint64_t) + _arenaSize; }
+
+private:
+    class Builder;
+
+    static constexpr uint32_t PayloadMask = 0xffffffff;
+
+    Type type(uint32_t index) const { return static_cast<Type>(_tape[index] >> 56); }
+    uint32_t payload(uint32_t index) const { return static_cast<uint32_t>(_tape[index] & PayloadMask); }
+    uint32_t count(uint32_t index) const { return static_cast<uint32_t>((_tape[index] >> 32) & 0xffffff); }
+    float number(uint32_t index) const;
+    const char* string(uint32_t index) const { return _arena + payload(index); }
+
+    // Index of the entry following the value at index, skipping over containers
+    uint32_t skip(uint32_t index) const;
+
+    void write(JSONWriter&, uint32_t index) const;
+
+    Mad<uint64_t> _region;
+    const uint64_t* _tape = nullptr;
+    const char* _arena = nullptr;
+    uint32_t _tapeSize = 0;
+    uint32_t _arenaSize = 0;
+
+    Error _error;
+    uint32_t _errorLine = 0;
+};
+
+}
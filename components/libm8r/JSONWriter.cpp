@@ -0,0 +1,211 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "JSONWriter.h"
+
+#include "Base64.h"
+#include "MStream.h"
+#include "MString.h"
+
+using namespace m8r;
+
+JSONWriter& JSONWriter::start(char c)
+{
+    // Check before writing the separator, so a failed start leaves the
+    // output as it was
+    if (_depth >= MaxDepth) {
+        _valid = false;
+        return *this;
+    }
+    separator();
+    write(c);
+    _firstStack |= 1u << _depth;
+    ++_depth;
+    return *this;
+}
+
+JSONWriter& JSONWriter::end(char c)
+{
+    if (_depth == 0 || _afterKey) {
+        _valid = false;
+        return *this;
+    }
+    --_depth;
+    write(c);
+    return *this;
+}
+
+JSONWriter& JSONWriter::key(const char* s)
+{
+    separator();
+    writeString(s);
+    write(':');
+    _afterKey = true;
+    return *this;
+}
+
+JSONWriter& JSONWriter::key(const String& s)
+{
+    return key(s.c_str());
+}
+
+JSONWriter& JSONWriter::value(const char* s)
+{
+    separator();
+    writeString(s);
+    return *this;
+}
+
+JSONWriter& JSONWriter::value(const String& s)
+{
+    return value(s.c_str());
+}
+
+JSONWriter& JSONWriter::value(float v)
+{
+    separator();
+    write(String(v).c_str());
+    return *this;
+}
+
+JSONWriter& JSONWriter::value(int32_t v)
+{
+    separator();
+    write(String(v).c_str());
+    return *this;
+}
+
+JSONWriter& JSONWriter::value(bool v)
+{
+    separator();
+    write(v ? "true" : "false");
+    return *this;
+}
+
+JSONWriter& JSONWriter::null()
+{
+    separator();
+    write("null");
+    return *this;
+}
+
+JSONWriter& JSONWriter::bytes(const uint8_t* data, uint32_t size)
+{
+    // Encode in multiples of 3 bytes so there is no padding until the end
+    static constexpr uint16_t ChunkSize = 48;
+    char buf[ChunkSize / 3 * 4 + 4];
+
+    separator();
+    write('"');
+    while (size) {
+        uint16_t n = (size > ChunkSize) ? ChunkSize : static_cast<uint16_t>(size);
+        int result = Base64::encode(n, data, sizeof(buf), buf);
+        if (result < 0) {
+            _valid = false;
+            break;
+        }
+        write(buf, result);
+        data += n;
+        size -= n;
+    }
+    write('"');
+    return *this;
+}
+
+void JSONWriter::flush()
+{
+    if (_bufferSize == 0) {
+        return;
+    }
+
+    if (_stream) {
+        _stream->write(reinterpret_cast<const uint8_t*>(_buffer), _bufferSize);
+    } else if (_string) {
+        for (uint16_t i = 0; i < _bufferSize; ++i) {
+            *_string += _buffer[i];
+        }
+    } else if (_sink) {
+        _sink(_buffer, _bufferSize);
+    }
+    _bufferSize = 0;
+}
+
+void JSONWriter::separator()
+{
+    if (_afterKey) {
+        _afterKey = false;
+        return;
+    }
+    if (_depth == 0) {
+        return;
+    }
+
+    uint32_t bit = 1u << (_depth - 1);
+    if (_firstStack & bit) {
+        _firstStack &= ~bit;
+    } else {
+        write(',');
+    }
+}
+
+void JSONWriter::writeString(const char* s)
+{
+    static const char* hex = "0123456789abcdef";
+
+    write('"');
+    for ( ; *s; ++s) {
+        uint8_t c = static_cast<uint8_t>(*s);
+        switch (c) {
+            case '"': write("\\\""); break;
+            case '\\': write("\\\\"); break;
+            case '\n': write("\\n"); break;
+            case '\r': write("\\r"); break;
+            case '\t': write("\\t"); break;
+            case '\b': write("\\b"); break;
+            case '\f': write("\\f"); break;
+            default:
+                if (c < 0x20) {
+                    write("\\u00");
+                    write(hex[c >> 4]);
+                    write(hex[c & 0x0f]);
+                } else {
+                    write(static_cast<char>(c));
+                }
+                break;
+        }
+    }
+    write('"');
+}
+
+void JSONWriter::write(char c)
+{
+    ++_size;
+    if (!_stream && !_string && !_sink) {
+        return;
+    }
+
+    _buffer[_bufferSize++] = c;
+    if (_bufferSize >= BufferSize) {
+        flush();
+    }
+}
+
+void JSONWriter::write(const char* s)
+{
+    while (*s) {
+        write(*s++);
+    }
+}
+
+void JSONWriter::write(const char* s, uint32_t size)
+{
+    while (size--) {
+        write(*s++);
+    }
+}
@@ -0,0 +1,114 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace m8r {
+
+class Stream;
+class String;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: JSONWriter
+//
+//  Streaming JSON serializer. Values are written as they are added, with
+//  commas, quoting and string escapes handled here, so the caller never
+//  builds the whole document in memory. Output goes to a Stream, is
+//  appended to a String, or is passed in BufferSize chunks to a Sink
+//  function (e.g. one that sends to a TCP connection).
+//
+//  A writer made with no output just counts. That is useful to get a
+//  Content-Length before sending the real thing.
+//
+//  Memory use is fixed: a bit stack for nesting, MaxDepth deep, and the
+//  output buffer.
+//
+//  The token methods are virtual so other encodings of the same value
+//  model (see CBORWriter) can share the output handling, and anything
+//  that serializes to a JSONWriter can produce them too.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class JSONWriter {
+public:
+    static constexpr uint8_t MaxDepth = 32;
+    static constexpr uint16_t BufferSize = 64;
+
+    using Sink = std::function<void(const char* data, uint16_t size)>;
+
+    JSONWriter() { }
+    JSONWriter(Stream* stream) : _stream(stream) { }
+    JSONWriter(String& string) : _string(&string) { }
+    JSONWriter(const Sink& sink) : _sink(sink) { }
+    virtual ~JSONWriter() { flush(); }
+
+    JSONWriter(const JSONWriter&) = delete;
+    JSONWriter& operator=(const JSONWriter&) = delete;
+
+    virtual JSONWriter& startObject() { return start('{'); }
+    virtual JSONWriter& endObject() { return end('}'); }
+    virtual JSONWriter& startArray() { return start('['); }
+    virtual JSONWriter& endArray() { return end(']'); }
+
+    // In an object, each value must be preceded by a key
+    virtual JSONWriter& key(const char*);
+    JSONWriter& key(const String&);
+
+    virtual JSONWriter& value(const char*);
+    JSONWriter& value(const String&);
+    virtual JSONWriter& value(float);
+    virtual JSONWriter& value(int32_t);
+    virtual JSONWriter& value(bool);
+    virtual JSONWriter& null();
+
+    // Binary data. JSON has no byte strings so it is written as a base64 string
+    virtual JSONWriter& bytes(const uint8_t*, uint32_t size);
+
+    // Send any buffered output
+    void flush();
+
+    // Total bytes output so far
+    uint32_t size() const { return _size; }
+
+    // False if containers were unbalanced or nested too deep
+    bool valid() const { return _valid; }
+
+protected:
+    void write(char c);
+    void write(const char*);
+    void write(const char*, uint32_t size);
+
+    bool _valid = true;
+
+private:
+    JSONWriter& start(char c);
+    JSONWriter& end(char c);
+
+    void separator();
+    void writeString(const char*);
+
+    Stream* _stream = nullptr;
+    String* _string = nullptr;
+    Sink _sink;
+
+    // Bit for each nesting level. Set until the first element is written
+    uint32_t _firstStack = 0;
+    uint8_t _depth = 0;
+    bool _afterKey = false;
+
+    uint32_t _size = 0;
+    uint16_t _bufferSize = 0;
+    char _buffer[BufferSize];
+};
+
+}
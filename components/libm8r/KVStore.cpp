@@ -0,0 +1,509 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "KVStore.h"
+
+#include <cstring>
+#include <limits>
+
+using namespace m8r;
+
+// The log starts with Magic and the version, 4 bytes each. Each record is:
+//
+//      type (1 byte), key size (1 byte), value size (2 bytes),
+//      key, value, checksum (4 bytes)
+//
+// Sizes and the checksum are little endian. The checksum is FNV-1a of
+// everything in the record before it.
+static constexpr char Magic[] = "m8kv";
+static constexpr uint32_t Version = 1;
+static constexpr uint32_t HeaderSize = 8;
+static constexpr uint32_t RecordOverhead = 8;
+
+static constexpr uint16_t EmptySlot = 0xffff;
+static constexpr uint16_t MinIndexSize = 16;
+
+// The index is kept at most half full and its size is a power of 2 that
+// has to fit in a Vector
+static constexpr uint16_t MaxEntries = 16 * 1024;
+
+static constexpr Duration FlushDelay = 1s;
+
+static void appendUInt(Vector<char>& buf, uint32_t value, uint8_t bytes)
+{
+    for (uint8_t i = 0; i < bytes; ++i) {
+        buf.push_back(static_cast<char>(value >> (i * 8)));
+    }
+}
+
+static uint32_t toUInt(const char* data, uint8_t bytes)
+{
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < bytes; ++i) {
+        value |= static_cast<uint32_t>(static_cast<uint8_t>(data[i])) << (i * 8);
+    }
+    return value;
+}
+
+KVStore::KVStore(FS* fs, const char* path)
+    : _fs(fs)
+    , _path(path)
+    , _compactPath(String(path) + ".new")
+{
+}
+
+KVStore::~KVStore()
+{
+    flush();
+    abortCompaction();
+}
+
+bool KVStore::load()
+{
+    abortCompaction();
+    _entries.clear();
+    _index.clear();
+    _count = 0;
+    _logSize = 0;
+    _liveSize = 0;
+    _dirtySize = 0;
+    _sequence = 0;
+    _flushedSequence = 0;
+    _rewrite = false;
+    _error = Error::Code::OK;
+
+    // A new log that didn't get renamed into place is left from losing
+    // power while compacting. The old log is still whole, so use that
+    if (_fs->exists(_compactPath.c_str())) {
+        _fs->remove(_compactPath.c_str());
+    }
+
+    return readLog();
+}
+
+bool KVStore::get(const char* key, String& value) const
+{
+    int32_t index = find(key);
+    if (index < 0 || _entries[index].removed) {
+        return false;
+    }
+    value = _entries[index].value;
+    return true;
+}
+
+bool KVStore::contains(const char* key) const
+{
+    int32_t index = find(key);
+    return index >= 0 && !_entries[index].removed;
+}
+
+bool KVStore::set(const char* key, const String& value)
+{
+    size_t keySize = key ? strlen(key) : 0;
+    if (keySize == 0 || keySize > MaxKeySize || value.size() > MaxValueSize) {
+        return fail(Error::Code::InvalidArgumentValue);
+    }
+
+    // Settings often get set to what they already are, which costs nothing
+    int32_t index = find(key);
+    if (index >= 0 && !_entries[index].removed && _entries[index].value == value) {
+        return true;
+    }
+    if (index < 0 && _entries.size() >= MaxEntries) {
+        return fail(Error::Code::NoSpace);
+    }
+
+    apply(key, value, false);
+    return _dirtySize < FlushSize || flush();
+}
+
+bool KVStore::remove(const char* key)
+{
+    int32_t index = find(key);
+    if (index < 0 || _entries[index].removed) {
+        return fail(Error::Code::PropertyDoesNotExist);
+    }
+
+    apply(key, String(), true);
+    return _dirtySize < FlushSize || flush();
+}
+
+bool KVStore::flush()
+{
+    if (_rewrite) {
+        return compact();
+    }
+    if (_dirtySize == 0) {
+        return true;
+    }
+
+    Mad<File> file = _fs->open(_path.c_str(), _logSize ? FS::FileOpenMode::Append : FS::FileOpenMode::Write);
+    bool success = file->valid();
+
+    // The first write makes the log, header and all. After that it's a
+    // record for each entry changed since the last flush, however many
+    // times it changed
+    Vector<char> buf;
+    uint32_t size = 0;
+    if (_logSize == 0) {
+        appendHeader(buf);
+    }
+    for (uint16_t i = 0; success && i < _entries.size(); ++i) {
+        const Entry& entry = _entries[i];
+        if (entry.sequence > _flushedSequence) {
+            appendRecord(buf, entry.removed ? RecordType::Remove : RecordType::Set, entry.key, entry.value);
+        }
+        if (buf.size() >= FlushSize || (i == _entries.size() - 1 && !buf.empty())) {
+            success = file->write(&buf[0], buf.size()) == static_cast<int32_t>(buf.size());
+            size += buf.size();
+            buf.clear();
+        }
+    }
+    Error::Code code = file->valid() ? Error::Code::WriteError : file->error().code();
+    _fs->release(file);
+
+    if (!success) {
+        // Part of the records might be in the log now. Whatever is in memory
+        // goes into a new log instead, next time
+        _rewrite = true;
+        return fail(code);
+    }
+
+    _logSize += size;
+    _flushedSequence = _sequence;
+    _dirtySize = 0;
+    return true;
+}
+
+bool KVStore::compact()
+{
+    if (!_compactFile.valid() && !startCompaction()) {
+        return false;
+    }
+    while (_compactFile.valid()) {
+        if (!compactStep()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void KVStore::runOneIteration()
+{
+    if (_dirtySize && Time::now() - _dirtyTime >= FlushDelay) {
+        flush();
+    }
+
+    if (_compactFile.valid()) {
+        compactStep();
+    } else if (needsCompaction() && startCompaction()) {
+        compactStep();
+    }
+}
+
+int32_t KVStore::find(const char* key) const
+{
+    if (_index.empty() || !key) {
+        return -1;
+    }
+
+    uint32_t keyHash = hash(key, static_cast<uint32_t>(strlen(key)));
+    uint16_t mask = static_cast<uint16_t>(_index.size() - 1);
+    for (uint16_t slot = keyHash & mask; ; slot = (slot + 1) & mask) {
+        uint16_t index = _index[slot];
+        if (index == EmptySlot) {
+            return -1;
+        }
+        const Entry& entry = _entries[index];
+        if (entry.hash == keyHash && strcmp(entry.key.c_str(), key) == 0) {
+            return index;
+        }
+    }
+}
+
+void KVStore::apply(const char* key, const String& value, bool removed)
+{
+    int32_t index = find(key);
+    if (index < 0) {
+        if (removed) {
+            return;
+        }
+
+        Entry entry;
+        entry.key = key;
+        entry.hash = hash(key, static_cast<uint32_t>(strlen(key)));
+        entry.sequence = 0;
+        entry.removed = true;
+        _entries.push_back(entry);
+        index = static_cast<int32_t>(_entries.size() - 1);
+        rebuildIndex();
+    }
+
+    Entry& entry = _entries[index];
+    if (entry.sequence > _flushedSequence) {
+        _dirtySize -= recordSize(entry.key, entry.value);
+    } else if (_dirtySize == 0) {
+        _dirtyTime = Time::now();
+    }
+    if (!entry.removed) {
+        _liveSize -= recordSize(entry.key, entry.value);
+        --_count;
+    }
+
+    entry.removed = removed;
+    entry.value = removed ? String() : value;
+    entry.sequence = ++_sequence;
+    _dirtySize += recordSize(entry.key, entry.value);
+    if (!removed) {
+        _liveSize += recordSize(entry.key, entry.value);
+        ++_count;
+    }
+}
+
+void KVStore::rebuildIndex()
+{
+    // Grow by doubling once more than half full. Otherwise only the newest
+    // entry needs a slot
+    uint16_t size = _index.empty() ? MinIndexSize : static_cast<uint16_t>(_index.size());
+    while (_entries.size() * 2 > size) {
+        size *= 2;
+    }
+
+    uint16_t first = 0;
+    if (size == _index.size()) {
+        first = static_cast<uint16_t>(_entries.size() - 1);
+    } else {
+        _index.clear();
+        _index.resize(size);
+        for (auto& it : _index) {
+            it = EmptySlot;
+        }
+    }
+
+    uint16_t mask = size - 1;
+    for (uint16_t i = first; i < _entries.size(); ++i) {
+        uint16_t slot = _entries[i].hash & mask;
+        while (_index[slot] != EmptySlot) {
+            slot = (slot + 1) & mask;
+        }
+        _index[slot] = i;
+    }
+}
+
+void KVStore::purge()
+{
+    // Removed entries stay until the log no longer mentions them, so
+    // compaction can find them
+    Vector<Entry> entries;
+    for (const auto& it : _entries) {
+        if (!it.removed) {
+            entries.push_back(it);
+        }
+    }
+    _entries.swap(entries);
+    _index.clear();
+    if (!_entries.empty()) {
+        rebuildIndex();
+    }
+}
+
+bool KVStore::readLog()
+{
+    Mad<File> file = _fs->open(_path.c_str(), FS::FileOpenMode::Read);
+    if (!file->valid()) {
+        // No log yet is an empty store
+        Error::Code code = file->error().code();
+        _fs->release(file);
+        return code == Error::Code::FileNotFound || fail(code);
+    }
+
+    int32_t fileSize = file->size();
+    char header[HeaderSize];
+    if (file->read(header, HeaderSize) != static_cast<int32_t>(HeaderSize) ||
+            memcmp(header, Magic, 4) != 0 || toUInt(header + 4, 4) != Version) {
+        _fs->release(file);
+        _rewrite = true;
+        return fail(Error::Code::Corrupted);
+    }
+    _logSize = HeaderSize;
+
+    Vector<char> body;
+    while (true) {
+        char recordHeader[4];
+        if (file->read(recordHeader, 4) != 4) {
+            break;
+        }
+
+        uint8_t keySize = static_cast<uint8_t>(recordHeader[1]);
+        uint16_t valueSize = static_cast<uint16_t>(toUInt(recordHeader + 2, 2));
+        uint32_t bodySize = keySize + valueSize + 4;
+        if (keySize == 0 || bodySize > std::numeric_limits<uint16_t>::max()) {
+            break;
+        }
+        body.resize(static_cast<uint16_t>(bodySize));
+        if (file->read(&body[0], bodySize) != static_cast<int32_t>(bodySize)) {
+            break;
+        }
+
+        uint32_t checksum = hash(body.begin(), keySize + valueSize, hash(recordHeader, 4));
+        if (checksum != toUInt(body.begin() + keySize + valueSize, 4)) {
+            break;
+        }
+
+        RecordType type = static_cast<RecordType>(recordHeader[0]);
+        if (type != RecordType::Set && type != RecordType::Remove) {
+            break;
+        }
+
+        String key(body.begin(), keySize);
+        apply(key.c_str(), String(body.begin() + keySize, valueSize), type == RecordType::Remove);
+        _logSize += RecordOverhead + keySize + valueSize;
+    }
+    _fs->release(file);
+
+    // Anything after the last good record is a write that didn't finish.
+    // Records appended after it would be lost, so start a new log
+    if (static_cast<int32_t>(_logSize) != fileSize) {
+        _rewrite = true;
+    }
+
+    // Everything so far is in the log
+    _flushedSequence = _sequence;
+    _dirtySize = 0;
+    return true;
+}
+
+bool KVStore::startCompaction()
+{
+    _compactFile = _fs->open(_compactPath.c_str(), FS::FileOpenMode::Write);
+    if (!_compactFile->valid()) {
+        Error::Code code = _compactFile->error().code();
+        abortCompaction();
+        return fail(code);
+    }
+
+    Vector<char> header;
+    appendHeader(header);
+    if (_compactFile->write(&header[0], header.size()) != static_cast<int32_t>(header.size())) {
+        abortCompaction();
+        return fail(Error::Code::WriteError);
+    }
+
+    _compactCursor = 0;
+    _compactSequence = _sequence;
+    _compactSize = header.size();
+    return true;
+}
+
+bool KVStore::compactStep()
+{
+    Vector<char> buf;
+    while (_compactCursor < _entries.size() && buf.size() < CompactStepSize) {
+        const Entry& entry = _entries[_compactCursor++];
+        if (!entry.removed) {
+            appendRecord(buf, RecordType::Set, entry.key, entry.value);
+        }
+    }
+
+    if (!buf.empty()) {
+        if (_compactFile->write(&buf[0], buf.size()) != static_cast<int32_t>(buf.size())) {
+            abortCompaction();
+            return fail(Error::Code::WriteError);
+        }
+        _compactSize += buf.size();
+    }
+
+    return _compactCursor < _entries.size() || finishCompaction();
+}
+
+bool KVStore::finishCompaction()
+{
+    // Entries that changed since compaction started might have been copied
+    // before they changed, so write them again. The later record wins.
+    // Like flush(), they're written FlushSize at a time
+    Vector<char> buf;
+    for (uint16_t i = 0; i < _entries.size(); ++i) {
+        const Entry& entry = _entries[i];
+        if (entry.sequence > _compactSequence) {
+            appendRecord(buf, entry.removed ? RecordType::Remove : RecordType::Set, entry.key, entry.value);
+        }
+        if (buf.size() >= FlushSize || (i == _entries.size() - 1 && !buf.empty())) {
+            if (_compactFile->write(&buf[0], buf.size()) != static_cast<int32_t>(buf.size())) {
+                abortCompaction();
+                return fail(Error::Code::WriteError);
+            }
+            _compactSize += buf.size();
+            buf.clear();
+        }
+    }
+
+    _fs->release(_compactFile);
+    _compactFile = Mad<File>();
+
+    // This is the commit. Until the rename the old log is the store
+    if (!_fs->rename(_compactPath.c_str(), _path.c_str())) {
+        _fs->remove(_compactPath.c_str());
+        return fail(Error::Code::WriteError);
+    }
+
+    // The new log has everything, changes not yet flushed included
+    _logSize = _compactSize;
+    _flushedSequence = _sequence;
+    _dirtySize = 0;
+    _rewrite = false;
+    purge();
+    return true;
+}
+
+void KVStore::abortCompaction()
+{
+    if (_compactFile.valid()) {
+        _fs->release(_compactFile);
+        _compactFile = Mad<File>();
+        _fs->remove(_compactPath.c_str());
+    }
+}
+
+bool KVStore::needsCompaction() const
+{
+    if (_rewrite) {
+        return true;
+    }
+    return _logSize > CompactMinSize && _logSize > 2 * (_liveSize + HeaderSize);
+}
+
+void KVStore::appendHeader(Vector<char>& buf)
+{
+    buf.insert(buf.end(), Magic, Magic + 4);
+    appendUInt(buf, Version, 4);
+}
+
+void KVStore::appendRecord(Vector<char>& buf, RecordType type, const String& key, const String& value)
+{
+    uint16_t start = static_cast<uint16_t>(buf.size());
+    buf.push_back(static_cast<char>(type));
+    appendUInt(buf, key.size(), 1);
+    appendUInt(buf, value.size(), 2);
+    buf.insert(buf.end(), key.c_str(), key.c_str() + key.size());
+    buf.insert(buf.end(), value.c_str(), value.c_str() + value.size());
+    appendUInt(buf, hash(buf.begin() + start, static_cast<uint32_t>(buf.size() - start)), 4);
+}
+
+uint32_t KVStore::recordSize(const String& key, const String& value)
+{
+    return RecordOverhead + key.size() + value.size();
+}
+
+uint32_t KVStore::hash(const char* data, uint32_t size, uint32_t hash)
+{
+    for (uint32_t i = 0; i < size; ++i) {
+        hash = (hash ^ static_cast<uint8_t>(data[i])) * 16777619;
+    }
+    return hash;
+}
@@ -0,0 +1,146 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Containers.h"
+#include "Error.h"
+#include "MFS.h"
+#include "MString.h"
+#include "SystemTime.h"
+
+namespace m8r {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: KVStore
+//
+//  Key/value store for settings and other small state, kept in a log file
+//  on any FS. Every key and value is held in memory with a hash index over
+//  the keys, so lookups never read the file after load().
+//
+//  set() and remove() only change memory. The changed entries are
+//  appended to the log in one go when they add up to FlushSize, when
+//  they've waited a second or on flush(). A key set many times in between
+//  is written once, and one file commit covers all the keys, where a file
+//  per key would cost a commit for every set. Each record has a checksum
+//  and load() stops at the first one that doesn't check, so a write cut
+//  off by losing power drops that write and no more.
+//
+//  Once the log is mostly dead records, runOneIteration() writes the live
+//  ones to a new log a step at a time and renames it over the old one.
+//  The rename is atomic, so after power loss the store is either all old
+//  or all new.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class KVStore {
+public:
+    static constexpr uint16_t FlushSize = 1024;
+    static constexpr uint32_t CompactMinSize = 2048;
+    static constexpr uint16_t CompactStepSize = 512;
+    static constexpr uint16_t MaxKeySize = 255;
+    static constexpr uint16_t MaxValueSize = 16 * 1024;
+
+    KVStore(FS* fs, const char* path);
+    ~KVStore();
+
+    // Read the log. A missing log is an empty store
+    bool load();
+
+    bool get(const char* key, String& value) const;
+    bool contains(const char* key) const;
+    bool set(const char* key, const String& value);
+    bool remove(const char* key);
+
+    // Write out changes now. False if they couldn't be written, though
+    // they're still in memory and are tried again
+    bool flush();
+
+    // Rewrite the log with only the live records now
+    bool compact();
+
+    // Flushes changes that have waited long enough and does a step of
+    // compaction when the log needs it. Call from the main loop
+    void runOneIteration();
+
+    uint16_t size() const { return _count; }
+    uint32_t logSize() const { return _logSize; }
+    uint32_t liveSize() const { return _liveSize; }
+    Error error() const { return _error; }
+
+private:
+    enum class RecordType : uint8_t { Set = 1, Remove = 2 };
+
+    struct Entry
+    {
+        String key;
+        String value;
+        uint32_t hash;
+
+        // Changes are numbered so flush() and compaction can tell what
+        // changed since they last wrote
+        uint32_t sequence;
+        bool removed;
+    };
+
+    // Index of the entry for key, removed or not, or -1
+    int32_t find(const char* key) const;
+    void apply(const char* key, const String& value, bool removed);
+    void rebuildIndex();
+    void purge();
+
+    bool readLog();
+    bool startCompaction();
+    bool compactStep();
+    bool finishCompaction();
+    void abortCompaction();
+    bool needsCompaction() const;
+
+    // recordSize() is the size appendRecord() adds. Log, live and dirty
+    // sizes are kept as sums of it
+    static void appendHeader(Vector<char>&);
+    static void appendRecord(Vector<char>&, RecordType, const String& key, const String& value);
+    static uint32_t recordSize(const String& key, const String& value);
+    static uint32_t hash(const char* data, uint32_t size, uint32_t hash = 2166136261);
+
+    bool fail(Error::Code code) { _error = code; return false; }
+
+    FS* _fs;
+    String _path;
+    String _compactPath;
+
+    Vector<Entry> _entries;
+    Vector<uint16_t> _index;
+    uint16_t _count = 0;
+
+    uint32_t _logSize = 0;
+    uint32_t _liveSize = 0;
+
+    // Size of the records flush() would write
+    uint32_t _dirtySize = 0;
+    Time _dirtyTime;
+
+    uint32_t _sequence = 0;
+    uint32_t _flushedSequence = 0;
+
+    // Set when the end of the log can't be trusted, so records appended
+    // there might not be read back. The log is rewritten before any more
+    // are written
+    bool _rewrite = false;
+
+    Mad<File> _compactFile;
+    uint16_t _compactCursor = 0;
+    uint32_t _compactSequence = 0;
+    uint32_t _compactSize = 0;
+
+    Error _error;
+};
+
+}
@@ -10,5 +10,149 @@
 #include "MFS.h"
 
 #include "SystemInterface.h"
+#include <cstring>
+#include <limits>
 
 using namespace m8r;
+
+void FS::release(Mad<File> file)
+{
+    if (file.valid()) {
+        file->close();
+        file.destroy(MemoryType::Native);
+    }
+}
+
+Vector<FS::Notification> FS::_notifications;
+
+int16_t FS::watch(const char* path, bool prefix, WatchFunction func)
+{
+    if (!path || !func) {
+        return -1;
+    }
+    
+    Watch watch;
+    watch.id = _nextWatchId;
+    watch.path = normalizePath(path);
+    watch.prefix = prefix;
+    watch.func = func;
+    _watches.push_back(watch);
+    
+    _nextWatchId = (_nextWatchId == std::numeric_limits<int16_t>::max()) ? 0 : _nextWatchId + 1;
+    return watch.id;
+}
+
+void FS::unwatch(int16_t id)
+{
+    for (auto it = _watches.begin(); it != _watches.end(); ++it) {
+        if (it->id == id) {
+            _watches.erase(it);
+            break;
+        }
+    }
+    
+    // Don't call it for changes that are already queued
+    for (auto it = _notifications.begin(); it != _notifications.end(); ) {
+        if (it->fs == this && it->id == id) {
+            it = _notifications.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+bool FS::dispatchChanges()
+{
+    if (_notifications.empty()) {
+        return false;
+    }
+    
+    // A function can make more changes. Those go in a new batch
+    Vector<Notification> notifications;
+    notifications.swap(_notifications);
+    for (const auto& it : notifications) {
+        it.func(it.change, it.path, it.newPath);
+    }
+    return true;
+}
+
+void FS::notify(Change change, const char* path, const char* newPath)
+{
+    if (_watches.empty()) {
+        return;
+    }
+    
+    String from = normalizePath(path);
+    String to = newPath ? normalizePath(newPath) : String();
+    for (const auto& it : _watches) {
+        // A rename also brings the new path, and anything under it, into being
+        if (!matches(it, change, from) && !(change == Change::Rename && matches(it, change, to))) {
+            continue;
+        }
+        
+        if (_notifications.empty() && system()) {
+            system()->addEvent(SystemInterface::Event::FSChanged);
+        }
+        
+        Notification notification;
+        notification.fs = this;
+        notification.id = it.id;
+        notification.func = it.func;
+        notification.change = change;
+        notification.path = from;
+        notification.newPath = to;
+        _notifications.push_back(notification);
+    }
+}
+
+// True if path is somewhere below dir
+static bool isUnder(const String& path, const String& dir)
+{
+    if (dir == "/") {
+        return path != "/";
+    }
+    return path.size() > dir.size() && path[dir.size()] == '/' && memcmp(path.c_str(), dir.c_str(), dir.size()) == 0;
+}
+
+bool FS::watched(const char* path) const
+{
+    if (_watches.empty()) {
+        return false;
+    }
+    
+    String name = normalizePath(path);
+    for (const auto& it : _watches) {
+        if (matches(it, Change::Create, name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FS::matches(const Watch& watch, Change change, const String& path)
+{
+    if (watch.path == path) {
+        return true;
+    }
+    if (watch.prefix && isUnder(path, watch.path)) {
+        return true;
+    }
+    
+    // Removing or renaming a directory takes the watched path with it
+    return (change == Change::Remove || change == Change::Rename) && isUnder(watch.path, path);
+}
+
+String FS::normalizePath(const char* path)
+{
+    String result;
+    if (!path || path[0] != '/') {
+        result += '/';
+    }
+    if (path) {
+        result += path;
+    }
+    while (result.size() > 1 && result[result.size() - 1] == '/') {
+        result = result.slice(0, static_cast<int32_t>(result.size()) - 1);
+    }
+    return result;
+}
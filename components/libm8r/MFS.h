@@ -13,6 +13,7 @@
 #include "Error.h"
 #include "SharedPtr.h"
 #include <cstdint>
+#include <functional>
 #include <memory>
 
 namespace m8r {
@@ -63,15 +64,103 @@ public:
     virtual bool format() = 0;
     
     virtual Mad<File> open(const char* name, FileOpenMode) = 0;
+    
+    // Give back a file returned by open(). The filesystem may keep the
+    // object for reuse, so it must not be used or destroyed afterwards
+    virtual void release(Mad<File>);
+    
     virtual Mad<Directory> openDirectory(const char* name) = 0;
     virtual bool makeDirectory(const char* name) = 0;
     virtual bool remove(const char* name) = 0;
     virtual bool rename(const char* src, const char* dst) = 0;
     virtual bool exists(const char* name) const = 0;
     
+    // What's at a path. Filesystems that don't override stat() only say
+    // whether the path exists
+    struct Info
+    {
+        bool directory = false;
+        uint32_t size = 0;
+    };
+    
+    virtual bool stat(const char* name, Info& info) const { info = Info(); return exists(name); }
+    
+    // Files that are already in addressable memory, like the assets of a
+    // RomFS, can be used in place instead of being read through a File.
+    // data holds the file's bytes. gzipData, if not null, holds them
+    // gzipped, for clients that take that. etag and contentType are null
+    // if the filesystem doesn't know them
+    struct Mapping
+    {
+        const char* data = nullptr;
+        uint32_t size = 0;
+        const char* gzipData = nullptr;
+        uint32_t gzipSize = 0;
+        const char* etag = nullptr;
+        const char* contentType = nullptr;
+    };
+    
+    virtual bool map(const char* /*name*/, Mapping&) const { return false; }
+    
     virtual uint32_t totalSize() const = 0;
     virtual uint32_t totalUsed() const = 0;
     
+    // Block device activity since the filesystem was created or the stats
+    // were last reset. Always zero for filesystems that don't track it
+    struct FlashStats
+    {
+        // Bucket i of a latency histogram counts ops that took less than
+        // latencyLimit(i) us. The last bucket counts the rest
+        static constexpr uint8_t LatencyBuckets = 8;
+        static uint32_t latencyLimit(uint8_t i) { return 16u << (2 * i); }
+        
+        struct Op
+        {
+            uint32_t count = 0;
+            uint64_t bytes = 0;
+            uint64_t totalUs = 0;
+            uint32_t maxUs = 0;
+            uint32_t latency[LatencyBuckets] = { };
+            
+            uint32_t averageUs() const { return count ? static_cast<uint32_t>(totalUs / count) : 0; }
+        };
+        
+        Op reads;
+        Op progs;
+        Op erases;
+        
+        // Wear. cycleLimit is the number of erases a block is allowed
+        // before the filesystem moves its data elsewhere
+        uint32_t blocks = 0;
+        uint32_t cycleLimit = 0;
+        uint32_t minEraseCount = 0;
+        uint32_t maxEraseCount = 0;
+        uint32_t unerasedBlocks = 0;
+        uint32_t belowHalfLimitBlocks = 0;
+        uint32_t belowLimitBlocks = 0;
+        uint32_t atLimitBlocks = 0;
+    };
+    
+    virtual FlashStats flashStats() const { return FlashStats(); }
+    virtual uint32_t eraseCount(uint32_t /*block*/) const { return 0; }
+    virtual void resetFlashStats() { }
+    
+    // Change notification. A watch on a path sees changes to that path and
+    // the removal or renaming of any directory above it. A prefix watch
+    // also sees changes to everything under the path. Changes are queued
+    // and the functions are called from the main loop, after a
+    // SystemInterface::Event::FSChanged. newPath is only set for Rename.
+    // Modify is sent when a file opened for writing is released
+    enum class Change { Create, Modify, Remove, Rename };
+    using WatchFunction = std::function<void(Change, const String& path, const String& newPath)>;
+    
+    // Returns an id for unwatch(), or -1 if the watch can't be added
+    virtual int16_t watch(const char* path, bool prefix, WatchFunction);
+    virtual void unwatch(int16_t id);
+    
+    // Call the functions for queued changes. Returns true if there were any
+    static bool dispatchChanges();
+    
     bool valid() const { return _error == Error::Code::OK; }
 
     Error lastError() const { return _error; }
@@ -81,7 +170,42 @@ public:
     // m8rscript object methods
     
 protected:
+    // Queue change for the watches that match. Cheap when nothing is watched
+    void notify(Change, const char* path, const char* newPath = nullptr);
+    // True if a Create of path would be seen by a watch
+    bool watched(const char* path) const;
+    
+    // Absolute path with no trailing '/'. The root is "/"
+    static String normalizePath(const char* path);
+
     Error _error;
+
+private:
+    struct Watch
+    {
+        int16_t id = -1;
+        String path;
+        bool prefix = false;
+        WatchFunction func;
+    };
+    
+    struct Notification
+    {
+        const FS* fs = nullptr;
+        int16_t id = -1;
+        WatchFunction func;
+        Change change = Change::Modify;
+        String path;
+        String newPath;
+    };
+    
+    static bool matches(const Watch&, Change, const String& path);
+    
+    Vector<Watch> _watches;
+    int16_t _nextWatchId = 0;
+    
+    // Shared by every filesystem, so one event dispatches them all
+    static Vector<Notification> _notifications;
 };
 
 class Directory : public Shared {
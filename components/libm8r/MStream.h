@@ -17,16 +17,69 @@ namespace m8r {
 //
 //  Class: Stream
 //
-//
+//  Subclasses must implement the single byte read() and write(). The
+//  bulk calls, peek(), span() and skip() have defaults built on those,
+//  but subclasses that can do better should override them.
 //
 //////////////////////////////////////////////////////////////////////////////
 
 class Stream {
 public:
+    virtual ~Stream() { }
+    
     virtual int read() const = 0;
     virtual int write(uint8_t) = 0;
-	
-private:
+    
+    // Returns the number of bytes transferred, which is less than size
+    // at the end of the stream, or -1 on error
+    virtual int32_t read(uint8_t* buf, uint32_t size) const
+    {
+        uint32_t i = 0;
+        for ( ; i < size; ++i) {
+            int c = read();
+            if (c < 0) {
+                break;
+            }
+            buf[i] = static_cast<uint8_t>(c);
+        }
+        return i;
+    }
+    
+    virtual int32_t write(const uint8_t* buf, uint32_t size)
+    {
+        for (uint32_t i = 0; i < size; ++i) {
+            if (write(buf[i]) < 0) {
+                return i ? i : -1;
+            }
+        }
+        return size;
+    }
+    
+    // Next byte without consuming it. Returns -1 at the end of the
+    // stream, or if the stream has no span() and can't look ahead
+    virtual int peek() const
+    {
+        uint32_t size;
+        const uint8_t* data = span(size);
+        return size ? data[0] : -1;
+    }
+    
+    // If the unread bytes are in memory, return a pointer to as many of
+    // them as are contiguous and set size. Otherwise return nullptr
+    // with a size of 0. Use skip() to consume what was used
+    virtual const uint8_t* span(uint32_t& size) const
+    {
+        size = 0;
+        return nullptr;
+    }
+    
+    // Consume up to size bytes. Returns the number skipped
+    virtual uint32_t skip(uint32_t size) const
+    {
+        uint32_t i = 0;
+        for ( ; i < size && read() >= 0; ++i) ;
+        return i;
+    }
 };
 
 }
@@ -245,6 +245,18 @@ static void decompose(double f, int64_t& mantissa, int16_t& exp)
     static constexpr double min = 1e15;
     
     exp = 0;
+    mantissa = 0;
+
+    // Zero and non-finite values would never reach the range below
+    if (f == 0 || f != f || f - f != 0) {
+        return;
+    }
+
+    bool neg = f < 0;
+    if (neg) {
+        f = -f;
+    }
+
     while (f < min) {
         f *= 10;
         --exp;
@@ -253,7 +265,7 @@ static void decompose(double f, int64_t& mantissa, int16_t& exp)
         f /= 10;
         ++exp;
     }
-    mantissa = int64_t(f);
+    mantissa = neg ? -int64_t(f) : int64_t(f);
 }
 
 m8r::String::String(double value, uint8_t decimalDigits)
@@ -304,11 +316,12 @@ bool m8r::String::toFloat(float& f, const char* s, bool allowWhitespace)
     Scanner scanner(&stream);
     bool neg = false;
     Token token = scanner.getToken(allowWhitespace);
-    Scanner::TokenType type = scanner.getTokenValue(allowWhitespace);
-    if (token == Token::Minus || (token == Token::Special && type.str[0] == '-' && type.str[1] == '\0')) {
+    if (token == Token::Minus) {
         neg = true;
+        scanner.retireToken();
         token = scanner.getToken(allowWhitespace);
     }
+    Scanner::TokenType type = scanner.getTokenValue(allowWhitespace);
     if (token == Token::Float || token == Token::Integer) {
         f = (token == Token::Float) ? type.number : float(type.integer);
         if (neg) {
@@ -325,11 +338,12 @@ bool m8r::String::toInt(int32_t& i, const char* s, bool allowWhitespace)
     Scanner scanner(&stream);
     bool neg = false;
     Token token = scanner.getToken(allowWhitespace);
-    Scanner::TokenType type = scanner.getTokenValue(allowWhitespace);
-    if (token == Token::Minus || (token == Token::Special && type.str[0] == '-' && type.str[1] == '\0')) {
+    if (token == Token::Minus) {
         neg = true;
+        scanner.retireToken();
         token = scanner.getToken(allowWhitespace);
     }
+    Scanner::TokenType type = scanner.getTokenValue(allowWhitespace);
     if (token == Token::Integer && type.integer <= std::numeric_limits<int32_t>::max()) {
         i = type.integer;
         if (neg) {
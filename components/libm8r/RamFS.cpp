@@ -0,0 +1,481 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "RamFS.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace m8r;
+
+RamFS::RamFS(uint32_t maxSize)
+    : _maxSize(maxSize)
+{
+    _error = Error::Code::NotMounted;
+}
+
+RamFS::~RamFS()
+{
+    for (auto& it : _nodes) {
+        truncate(it.get(), 0);
+    }
+}
+
+bool RamFS::mount()
+{
+    Lock lock(_mutex);
+    _mounted = true;
+    _error = Error::Code::OK;
+    return true;
+}
+
+bool RamFS::mounted() const
+{
+    return _mounted;
+}
+
+void RamFS::unmount()
+{
+    Lock lock(_mutex);
+    _mounted = false;
+    _error = Error::Code::NotMounted;
+}
+
+bool RamFS::format()
+{
+    Lock lock(_mutex);
+    while (!_nodes.empty()) {
+        erase(_nodes.back());
+    }
+    notify(Change::Remove, "/");
+    return mount();
+}
+
+Mad<File> RamFS::open(const char* name, FileOpenMode mode)
+{
+    Lock lock(_mutex);
+    Mad<RamFile> file = Mad<RamFile>::create(MemoryType::Native);
+    if (!mounted()) {
+        file->_error = Error::Code::NotMounted;
+        return file;
+    }
+
+    String path = normalizePath(name);
+    SharedPtr<Node> node = find(path);
+    if (node && node->directory) {
+        file->_error = Error::Code::NotAFile;
+        return file;
+    }
+
+    if (!node) {
+        if (mode == FileOpenMode::Read || mode == FileOpenMode::ReadUpdate) {
+            file->_error = Error::Code::FileNotFound;
+            return file;
+        }
+        if (!isDirectory(parent(path))) {
+            file->_error = Error::Code::DirectoryNotFound;
+            return file;
+        }
+        node = create(path, false);
+        notify(Change::Create, path.c_str());
+    } else if (mode == FileOpenMode::Write || mode == FileOpenMode::WriteUpdate) {
+        truncate(node.get(), 0);
+    }
+
+    file->_fs = this;
+    file->_node = node;
+    file->_position = 0;
+    file->_mode = mode;
+    file->_type = File::Type::File;
+    file->_error = Error::Code::OK;
+    return file;
+}
+
+Mad<Directory> RamFS::openDirectory(const char* name)
+{
+    Lock lock(_mutex);
+    Mad<RamDirectory> dir = Mad<RamDirectory>::create(MemoryType::Native);
+    String path = normalizePath(name);
+    if (!mounted() || !isDirectory(path)) {
+        dir->_error = mounted() ? Error::Code::DirectoryNotFound : Error::Code::NotMounted;
+        return dir;
+    }
+
+    dir->_fs = this;
+    dir->_path = path;
+    dir->next();
+    return dir;
+}
+
+bool RamFS::makeDirectory(const char* name)
+{
+    Lock lock(_mutex);
+    if (!mounted()) {
+        return false;
+    }
+
+    // Make each missing component of the path
+    String path = normalizePath(name);
+    _error = Error::Code::OK;
+    if (path == "/") {
+        return true;
+    }
+    for (uint16_t i = 1; i <= path.size(); ++i) {
+        if (i < path.size() && path[i] != '/') {
+            continue;
+        }
+        String component = path.slice(0, i);
+        SharedPtr<Node> node = find(component);
+        if (!node) {
+            create(component, true);
+            notify(Change::Create, component.c_str());
+        } else if (!node->directory) {
+            _error = Error::Code::NotADirectory;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RamFS::remove(const char* name)
+{
+    Lock lock(_mutex);
+    if (!mounted()) {
+        return false;
+    }
+
+    String path = normalizePath(name);
+    SharedPtr<Node> node = find(path);
+    if (!node) {
+        return false;
+    }
+    if (node->directory) {
+        String prefix = path + "/";
+        for (const auto& it : _nodes) {
+            if (it->name.size() > prefix.size() && memcmp(it->name.c_str(), prefix.c_str(), prefix.size()) == 0) {
+                return false;
+            }
+        }
+    }
+    erase(node);
+    notify(Change::Remove, path.c_str());
+    return true;
+}
+
+bool RamFS::rename(const char* src, const char* dst)
+{
+    Lock lock(_mutex);
+    if (!mounted()) {
+        return false;
+    }
+
+    String from = normalizePath(src);
+    String to = normalizePath(dst);
+    String prefix = from + "/";
+    
+    // Like lfs, don't move a directory under itself, which would leave it
+    // with no parent
+    _error = Error::Code::OK;
+    if (to == from || (to.size() > prefix.size() && memcmp(to.c_str(), prefix.c_str(), prefix.size()) == 0)) {
+        _error = Error::Code::InvalidArgumentValue;
+        return false;
+    }
+    
+    SharedPtr<Node> node = find(from);
+    if (!node || !isDirectory(parent(to))) {
+        return false;
+    }
+
+    SharedPtr<Node> existing = find(to);
+    if (existing) {
+        if (existing->directory || node->directory) {
+            return false;
+        }
+        erase(existing);
+    }
+
+    // Move everything under a directory along with it
+    for (auto& it : _nodes) {
+        if (it->name == from) {
+            it->name = to;
+        } else if (node->directory && it->name.size() > prefix.size() &&
+                   memcmp(it->name.c_str(), prefix.c_str(), prefix.size()) == 0) {
+            it->name = to + it->name.slice(static_cast<int32_t>(from.size()));
+        }
+    }
+    notify(Change::Rename, from.c_str(), to.c_str());
+    return true;
+}
+
+bool RamFS::exists(const char* name) const
+{
+    Lock lock(_mutex);
+    return mounted() && (isDirectory(normalizePath(name)) || find(normalizePath(name)));
+}
+
+bool RamFS::stat(const char* name, Info& info) const
+{
+    Lock lock(_mutex);
+    info = Info();
+    if (!mounted()) {
+        return false;
+    }
+
+    String path = normalizePath(name);
+    if (path == "/") {
+        info.directory = true;
+        return true;
+    }
+    SharedPtr<Node> node = find(path);
+    if (!node) {
+        return false;
+    }
+    info.directory = node->directory;
+    info.size = node->size;
+    return true;
+}
+
+String RamFS::parent(const String& name)
+{
+    for (int32_t i = static_cast<int32_t>(name.size()) - 1; i > 0; --i) {
+        if (name[i] == '/') {
+            return name.slice(0, i);
+        }
+    }
+    return String("/");
+}
+
+SharedPtr<RamFS::Node> RamFS::find(const String& name) const
+{
+    for (const auto& it : _nodes) {
+        if (it->name == name) {
+            return it;
+        }
+    }
+    return SharedPtr<Node>();
+}
+
+bool RamFS::isDirectory(const String& name) const
+{
+    if (name == "/") {
+        return true;
+    }
+    SharedPtr<Node> node = find(name);
+    return node && node->directory;
+}
+
+SharedPtr<RamFS::Node> RamFS::create(const String& name, bool directory)
+{
+    SharedPtr<Node> node(new Node);
+    node->name = name;
+    node->directory = directory;
+    _nodes.push_back(node);
+    return node;
+}
+
+bool RamFS::addChunk(Node* node)
+{
+    if (_used + ChunkSize > _maxSize) {
+        return false;
+    }
+    Mad<char> chunk = Mallocator::shared()->allocate<char>(MemoryType::Native, ChunkSize);
+    if (!chunk.valid()) {
+        return false;
+    }
+    node->chunks.push_back(chunk);
+    _used += ChunkSize;
+    return true;
+}
+
+void RamFS::truncate(Node* node, uint32_t size)
+{
+    uint32_t chunks = (size + ChunkSize - 1) / ChunkSize;
+    while (node->chunks.size() > chunks) {
+        Mallocator::shared()->deallocate(MemoryType::Native, node->chunks.back());
+        node->chunks.pop_back();
+        _used -= ChunkSize;
+    }
+    if (node->size > size) {
+        node->size = size;
+    }
+}
+
+void RamFS::erase(const SharedPtr<Node>& node)
+{
+    // A file still open on the node sees it empty and can't write to it
+    truncate(node.get(), 0);
+    node->removed = true;
+    for (auto it = _nodes.begin(); it != _nodes.end(); ++it) {
+        if (it->get() == node.get()) {
+            _nodes.erase(it);
+            break;
+        }
+    }
+}
+
+bool RamDirectory::next()
+{
+    if (!_fs) {
+        return false;
+    }
+
+    Lock lock(_fs->_mutex);
+
+    // Return the next node whose parent is this directory
+    while (_index < _fs->_nodes.size()) {
+        const SharedPtr<RamFS::Node>& node = _fs->_nodes[_index++];
+        if (RamFS::parent(node->name) == _path && node->name != _path) {
+            _name = node->name.slice(static_cast<int32_t>((_path == "/") ? 1 : _path.size() + 1));
+            _size = node->size;
+            _error = Error::Code::OK;
+            return true;
+        }
+    }
+    _error = Error::Code::EndOfDirectory;
+    return false;
+}
+
+int32_t RamFile::read(char* buf, uint32_t size)
+{
+    if (!valid()) {
+        return -1;
+    }
+
+    Lock lock(_fs->_mutex);
+    if (_mode == FS::FileOpenMode::Write || _mode == FS::FileOpenMode::Append) {
+        _error = Error::Code::NotReadable;
+        return -1;
+    }
+
+    RamFS::Node* node = _node.get();
+    if (_position >= node->size) {
+        return 0;
+    }
+    if (size > node->size - _position) {
+        size = node->size - _position;
+    }
+
+    uint32_t done = 0;
+    while (done < size) {
+        uint32_t offset = _position % RamFS::ChunkSize;
+        uint32_t n = std::min(size - done, RamFS::ChunkSize - offset);
+        memcpy(buf + done, node->chunks[static_cast<uint16_t>(_position / RamFS::ChunkSize)].get() + offset, n);
+        done += n;
+        _position += n;
+    }
+    return static_cast<int32_t>(done);
+}
+
+int32_t RamFile::write(const char* buf, uint32_t size)
+{
+    if (!valid()) {
+        return -1;
+    }
+
+    Lock lock(_fs->_mutex);
+    if (_mode == FS::FileOpenMode::Read) {
+        _error = Error::Code::NotWritable;
+        return -1;
+    }
+
+    RamFS::Node* node = _node.get();
+    if (node->removed) {
+        _error = Error::Code::FileNotFound;
+        return -1;
+    }
+    if (_mode == FS::FileOpenMode::Append || _mode == FS::FileOpenMode::AppendUpdate) {
+        _position = node->size;
+    }
+
+    // Zero any gap left by seeking past the end
+    while (node->size < _position) {
+        if (node->size % RamFS::ChunkSize == 0 && !_fs->addChunk(node)) {
+            _error = Error::Code::NoSpace;
+            return -1;
+        }
+        uint32_t offset = node->size % RamFS::ChunkSize;
+        uint32_t n = std::min(_position - node->size, RamFS::ChunkSize - offset);
+        memset(node->chunks.back().get() + offset, 0, n);
+        node->size += n;
+    }
+
+    uint32_t done = 0;
+    while (done < size) {
+        uint32_t offset = _position % RamFS::ChunkSize;
+        uint16_t chunk = static_cast<uint16_t>(_position / RamFS::ChunkSize);
+        if (chunk >= node->chunks.size() && !_fs->addChunk(node)) {
+            break;
+        }
+        uint32_t n = std::min(size - done, RamFS::ChunkSize - offset);
+        memcpy(node->chunks[chunk].get() + offset, buf + done, n);
+        done += n;
+        _position += n;
+        if (_position > node->size) {
+            node->size = _position;
+        }
+    }
+
+    if (done == 0 && size) {
+        _error = Error::Code::NoSpace;
+        return -1;
+    }
+    return static_cast<int32_t>(done);
+}
+
+void RamFile::close()
+{
+    if (_node) {
+        Lock lock(_fs->_mutex);
+        if (_mode != FS::FileOpenMode::Read && !_node->removed) {
+            _fs->notify(FS::Change::Modify, _node->name.c_str());
+        }
+        _node.reset();
+    }
+    _error = Error::Code::FileClosed;
+}
+
+bool RamFile::seek(int32_t offset, File::SeekWhence whence)
+{
+    if (!valid()) {
+        return false;
+    }
+
+    Lock lock(_fs->_mutex);
+    if (_mode == FS::FileOpenMode::Append) {
+        _error = Error::Code::SeekNotAllowed;
+        return false;
+    }
+
+    int32_t base = 0;
+    switch (whence) {
+        case SeekWhence::Set: base = 0; break;
+        case SeekWhence::Cur: base = static_cast<int32_t>(_position); break;
+        case SeekWhence::End: base = static_cast<int32_t>(_node->size); break;
+        default: return false;
+    }
+    if (base + offset < 0) {
+        return false;
+    }
+    _position = static_cast<uint32_t>(base + offset);
+    return true;
+}
+
+int32_t RamFile::tell() const
+{
+    return valid() ? static_cast<int32_t>(_position) : -1;
+}
+
+int32_t RamFile::size() const
+{
+    if (!valid()) {
+        return -1;
+    }
+    Lock lock(_fs->_mutex);
+    return static_cast<int32_t>(_node->size);
+}
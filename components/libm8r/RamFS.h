@@ -0,0 +1,123 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Containers.h"
+#include "MFS.h"
+#include "Thread.h"
+
+namespace m8r {
+
+class RamFile;
+class RamDirectory;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: RamFS
+//
+//  Filesystem held in RAM, for scratch files, temporary uploads and caches
+//  that shouldn't wear the flash. File data is kept in ChunkSize pieces and
+//  no more than maxSize bytes of them are allocated. Contents are lost when
+//  the RamFS is destroyed or formatted, but not when it's unmounted.
+//
+//  Files can be read and written from the AsyncIO worker, so like LittleFS
+//  every call that touches the nodes holds a lock.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class RamFS : public FS {
+    friend class RamFile;
+    friend class RamDirectory;
+
+public:
+    static constexpr uint16_t ChunkSize = 256;
+
+    RamFS(uint32_t maxSize);
+    virtual ~RamFS();
+
+    virtual bool mount() override;
+    virtual bool mounted() const override;
+    virtual void unmount() override;
+    virtual bool format() override;
+
+    virtual Mad<File> open(const char* name, FileOpenMode) override;
+    virtual Mad<Directory> openDirectory(const char* name) override;
+    virtual bool makeDirectory(const char* name) override;
+    virtual bool remove(const char* name) override;
+    virtual bool rename(const char* src, const char* dst) override;
+    virtual bool exists(const char* name) const override;
+    virtual bool stat(const char* name, Info&) const override;
+
+    virtual uint32_t totalSize() const override { return _maxSize; }
+    virtual uint32_t totalUsed() const override { return _used; }
+
+private:
+    struct Node : public Shared
+    {
+        String name;
+        bool directory = false;
+        bool removed = false;
+        uint32_t size = 0;
+        Vector<Mad<char>> chunks;
+    };
+
+    static String parent(const String& name);
+
+    SharedPtr<Node> find(const String& name) const;
+    bool isDirectory(const String& name) const;
+    SharedPtr<Node> create(const String& name, bool directory);
+
+    bool addChunk(Node*);
+    void truncate(Node*, uint32_t size);
+    void erase(const SharedPtr<Node>&);
+
+    Vector<SharedPtr<Node>> _nodes;
+    uint32_t _maxSize;
+    uint32_t _used = 0;
+    bool _mounted = false;
+    
+    mutable Mutex _mutex;
+};
+
+class RamDirectory : public Directory {
+    friend class RamFS;
+
+public:
+    virtual ~RamDirectory() { }
+
+    virtual bool next() override;
+
+private:
+    RamFS* _fs = nullptr;
+    String _path;
+    uint16_t _index = 0;
+};
+
+class RamFile : public File {
+    friend class RamFS;
+
+public:
+    virtual ~RamFile() { }
+
+    virtual int32_t read(char* buf, uint32_t size) override;
+    virtual int32_t write(const char* buf, uint32_t size) override;
+    virtual void close() override;
+
+    virtual bool seek(int32_t offset, File::SeekWhence whence) override;
+    virtual int32_t tell() const override;
+    virtual int32_t size() const override;
+
+private:
+    RamFS* _fs = nullptr;
+    SharedPtr<RamFS::Node> _node;
+    uint32_t _position = 0;
+};
+
+}
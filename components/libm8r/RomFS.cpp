@@ -0,0 +1,227 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "RomFS.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace m8r;
+
+const RomFS::Asset* RomFS::find(const char* path) const
+{
+    String name = normalizePath(path);
+    uint16_t index = lowerBound(name.c_str());
+    if (index < _bundle.count && strcmp(_bundle.assets[index].path, name.c_str()) == 0) {
+        return &_bundle.assets[index];
+    }
+    return nullptr;
+}
+
+Mad<File> RomFS::open(const char* name, FileOpenMode mode)
+{
+    Mad<RomFile> file = Mad<RomFile>::create(MemoryType::Native);
+    if (!mounted()) {
+        file->_error = Error::Code::NotMounted;
+        return file;
+    }
+    if (mode != FileOpenMode::Read) {
+        file->_error = Error::Code::NotWritable;
+        return file;
+    }
+
+    file->_asset = find(name);
+    if (!file->_asset) {
+        file->_error = isDirectory(normalizePath(name)) ? Error::Code::NotAFile : Error::Code::FileNotFound;
+        return file;
+    }
+
+    file->_position = 0;
+    file->_mode = mode;
+    file->_type = File::Type::File;
+    file->_error = Error::Code::OK;
+    return file;
+}
+
+Mad<Directory> RomFS::openDirectory(const char* name)
+{
+    Mad<RomDirectory> dir = Mad<RomDirectory>::create(MemoryType::Native);
+    String path = normalizePath(name);
+    if (!mounted() || !isDirectory(path)) {
+        dir->_error = mounted() ? Error::Code::DirectoryNotFound : Error::Code::NotMounted;
+        return dir;
+    }
+
+    dir->_fs = this;
+    dir->_prefix = (path == "/") ? path : path + "/";
+    dir->_index = lowerBound(dir->_prefix.c_str());
+    dir->_error = Error::Code::OK;
+    dir->next();
+    return dir;
+}
+
+bool RomFS::makeDirectory(const char* name)
+{
+    // Directories that are already there are fine, like on other filesystems
+    if (mounted() && isDirectory(normalizePath(name))) {
+        _error = Error::Code::OK;
+        return true;
+    }
+    _error = Error::Code::NotWritable;
+    return false;
+}
+
+bool RomFS::exists(const char* name) const
+{
+    Info info;
+    return stat(name, info);
+}
+
+bool RomFS::stat(const char* name, Info& info) const
+{
+    info = Info();
+    if (!mounted()) {
+        return false;
+    }
+
+    const Asset* asset = find(name);
+    if (asset) {
+        info.size = asset->size;
+        return true;
+    }
+    info.directory = isDirectory(normalizePath(name));
+    return info.directory;
+}
+
+bool RomFS::map(const char* name, Mapping& mapping) const
+{
+    const Asset* asset = mounted() ? find(name) : nullptr;
+    if (!asset) {
+        return false;
+    }
+
+    mapping.data = asset->data;
+    mapping.size = asset->size;
+    mapping.gzipData = asset->gzipData;
+    mapping.gzipSize = asset->gzipSize;
+    mapping.etag = asset->etag;
+    mapping.contentType = asset->contentType;
+    return true;
+}
+
+uint32_t RomFS::totalSize() const
+{
+    uint32_t size = 0;
+    for (uint16_t i = 0; i < _bundle.count; ++i) {
+        size += _bundle.assets[i].size + _bundle.assets[i].gzipSize;
+    }
+    return size;
+}
+
+uint16_t RomFS::lowerBound(const char* path) const
+{
+    const Asset* end = _bundle.assets + _bundle.count;
+    const Asset* it = std::lower_bound(_bundle.assets, end, path, [](const Asset& asset, const char* path) {
+        return strcmp(asset.path, path) < 0;
+    });
+    return static_cast<uint16_t>(it - _bundle.assets);
+}
+
+bool RomFS::isDirectory(const String& path) const
+{
+    if (path == "/") {
+        return true;
+    }
+
+    // Assets under the directory sort right after its name plus '/'
+    String prefix = path + "/";
+    uint16_t index = lowerBound(prefix.c_str());
+    return index < _bundle.count && strncmp(_bundle.assets[index].path, prefix.c_str(), prefix.size()) == 0;
+}
+
+bool RomDirectory::next()
+{
+    if (!_fs) {
+        return false;
+    }
+
+    // Assets in a subdirectory are next to each other, so the subdirectory
+    // is returned for the first and the rest are skipped
+    const RomFS::Bundle& bundle = _fs->_bundle;
+    while (_index < bundle.count) {
+        const RomFS::Asset& asset = bundle.assets[_index];
+        if (strncmp(asset.path, _prefix.c_str(), _prefix.size()) != 0) {
+            break;
+        }
+
+        const char* child = asset.path + _prefix.size();
+        const char* slash = strchr(child, '/');
+        if (!slash) {
+            ++_index;
+            _name = String(child);
+            _size = asset.size;
+            _error = Error::Code::OK;
+            return true;
+        }
+
+        String subdirectory(child, static_cast<int32_t>(slash - child));
+        String subdirectoryPrefix = _prefix + subdirectory + "/";
+        while (_index < bundle.count && strncmp(bundle.assets[_index].path, subdirectoryPrefix.c_str(), subdirectoryPrefix.size()) == 0) {
+            ++_index;
+        }
+        _name = subdirectory;
+        _size = 0;
+        _error = Error::Code::OK;
+        return true;
+    }
+
+    _error = Error::Code::EndOfDirectory;
+    return false;
+}
+
+int32_t RomFile::read(char* buf, uint32_t size)
+{
+    if (!valid()) {
+        return -1;
+    }
+
+    if (_position >= _asset->size) {
+        return 0;
+    }
+    size = std::min(size, _asset->size - _position);
+    memcpy(buf, _asset->data + _position, size);
+    _position += size;
+    return static_cast<int32_t>(size);
+}
+
+int32_t RomFile::write(const char*, uint32_t)
+{
+    _error = Error::Code::NotWritable;
+    return -1;
+}
+
+bool RomFile::seek(int32_t offset, File::SeekWhence whence)
+{
+    if (!valid()) {
+        return false;
+    }
+
+    int32_t base = 0;
+    switch (whence) {
+        case SeekWhence::Set: base = 0; break;
+        case SeekWhence::Cur: base = static_cast<int32_t>(_position); break;
+        case SeekWhence::End: base = static_cast<int32_t>(_asset->size); break;
+        default: return false;
+    }
+    if (base + offset < 0) {
+        return false;
+    }
+    _position = static_cast<uint32_t>(base + offset);
+    return true;
+}
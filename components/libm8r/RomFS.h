@@ -0,0 +1,131 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "MFS.h"
+
+namespace m8r {
+
+class RomFile;
+class RomDirectory;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: RomFS
+//
+//  Read-only filesystem over a bundle of assets compiled into the binary.
+//  Bundles are made from a host directory with the --build-romfs option of
+//  the Mac build, which writes a source file holding every asset, sorted
+//  by path, with its Content-Type and ETag worked out ahead of time. An
+//  asset can also have a gzipped copy, which map() gives along with the
+//  plain bytes so it can be sent to browsers that accept it. Reading an
+//  asset always gives the plain bytes.
+//
+//  Directories aren't stored, they're the paths above the assets.
+//  map() gives an asset's bytes in place, so they can be sent without
+//  copying them or opening a file.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class RomFS : public FS {
+    friend class RomFile;
+    friend class RomDirectory;
+
+public:
+    struct Asset
+    {
+        const char* path;
+        const char* data;
+        uint32_t size;
+        const char* gzipData;       // Null if there's no gzipped copy
+        uint32_t gzipSize;
+        const char* contentType;
+        const char* etag;
+    };
+
+    struct Bundle
+    {
+        const Asset* assets;
+        uint16_t count;
+    };
+
+    RomFS(const Bundle& bundle) : _bundle(bundle) { }
+    virtual ~RomFS() { }
+
+    // Returns null if there's no asset at path
+    const Asset* find(const char* path) const;
+
+    virtual bool mount() override { _mounted = true; _error = Error::Code::OK; return true; }
+    virtual bool mounted() const override { return _mounted; }
+    virtual void unmount() override { _mounted = false; }
+    virtual bool format() override { _error = Error::Code::NotWritable; return false; }
+
+    virtual Mad<File> open(const char* name, FileOpenMode) override;
+    virtual Mad<Directory> openDirectory(const char* name) override;
+    virtual bool makeDirectory(const char* name) override;
+    virtual bool remove(const char*) override { _error = Error::Code::NotWritable; return false; }
+    virtual bool rename(const char*, const char*) override { _error = Error::Code::NotWritable; return false; }
+    virtual bool exists(const char* name) const override;
+    virtual bool stat(const char* name, Info&) const override;
+    virtual bool map(const char* name, Mapping&) const override;
+
+    virtual uint32_t totalSize() const override;
+    virtual uint32_t totalUsed() const override { return totalSize(); }
+
+private:
+    // Index of the first asset whose path is not less than path
+    uint16_t lowerBound(const char* path) const;
+    bool isDirectory(const String& path) const;
+
+    Bundle _bundle;
+    bool _mounted = false;
+};
+
+class RomDirectory : public Directory {
+    friend class RomFS;
+
+public:
+    virtual ~RomDirectory() { }
+
+    virtual bool next() override;
+
+private:
+    const RomFS* _fs = nullptr;
+
+    // Path of the directory with a trailing '/'
+    String _prefix;
+    uint16_t _index = 0;
+};
+
+class RomFile : public File {
+    friend class RomFS;
+
+public:
+    virtual ~RomFile() { }
+
+    virtual int32_t read(char* buf, uint32_t size) override;
+    virtual int32_t write(const char* buf, uint32_t size) override;
+    virtual void close() override { _asset = nullptr; _error = Error::Code::FileClosed; }
+
+    virtual bool seek(int32_t offset, File::SeekWhence whence) override;
+    virtual int32_t tell() const override { return valid() ? static_cast<int32_t>(_position) : -1; }
+    virtual int32_t size() const override { return valid() ? static_cast<int32_t>(_asset->size) : -1; }
+
+private:
+    const RomFS::Asset* _asset = nullptr;
+    uint32_t _position = 0;
+};
+
+// The web UI from web/. WebAssets.cpp is made by "make web_assets", which
+// runs the Mac build's --build-romfs, and "make check_web_assets" fails if
+// it's out of date
+extern const RomFS::Bundle WebAssets;
+
+}
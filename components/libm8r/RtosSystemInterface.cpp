@@ -20,10 +20,13 @@
 
 #include "Defines.h"
 #include "MLittleFS.h"
+#include "RamFS.h"
+#include "RomFS.h"
 #include "RtosGPIOInterface.h"
 #include "RtosTCP.h"
 #include "RtosWifi.h"
 #include "SystemInterface.h"
+#include "VFS.h"
 #include "esp_system.h"
 #include "spi_flash.h"
 
@@ -39,12 +42,21 @@ void IPAddr::lookupHostName(const char* name, std::function<void (const char* na
 class RtosSystemInterface : public SystemInterface
 {
 public:
+    static constexpr uint32_t RamFSSize = 16 * 1024;
+
     RtosSystemInterface()
+        : _ramFS(RamFSSize)
+        , _webAssets(WebAssets)
     {
+        _fileSystem.addMount("/", &_flashFileSystem);
+        _fileSystem.addMount("/tmp", &_ramFS);
+        _fileSystem.addMount("/sys/web", &_webAssets);
     }
     
     ~RtosSystemInterface()
     {
+        // The AsyncIO worker may be using the filesystems, which go first
+        asyncIO()->stop();
     }
     
     virtual void setDeviceName(const char* name) { }
@@ -93,7 +105,10 @@ public:
 
 private:
     RtosGPIOInterface _gpio;
-    LittleFS _fileSystem;
+    LittleFS _flashFileSystem;
+    RamFS _ramFS;
+    RomFS _webAssets;
+    VFS _fileSystem;
     RtosWifi _wifi;
 };
 
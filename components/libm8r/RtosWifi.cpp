@@ -181,12 +181,23 @@ bool RtosWifi::waitForConnect()
 }
 
 void RtosWifi::connectToSTA(const char* ssid, const char* pwd)
+{
+    _staSSID = ssid;
+    _staPassword = pwd;
+    
+    // The config can't be set until the wifi driver is initialized
+    if (_started) {
+        ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
+        setSTAConfig();
+    }
+}
+
+void RtosWifi::setSTAConfig()
 {
     wifi_config_t config;
     memset(&config, 0, sizeof(config));
-    strcpy(reinterpret_cast<char*>(config.sta.ssid), ssid);
-    strcpy(reinterpret_cast<char*>(config.sta.password), pwd);
-    ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
+    strncpy(reinterpret_cast<char*>(config.sta.ssid), _staSSID.c_str(), sizeof(config.sta.ssid));
+    strncpy(reinterpret_cast<char*>(config.sta.password), _staPassword.c_str(), sizeof(config.sta.password));
     ESP_ERROR_CHECK(esp_wifi_set_config(ESP_IF_WIFI_STA, &config));
 }
 
@@ -236,7 +247,11 @@ void RtosWifi::start()
         
     // First try to connect to the existing STA
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
+    if (!_staSSID.empty()) {
+        setSTAConfig();
+    }
     ESP_ERROR_CHECK(esp_wifi_start());
+    _started = true;
 //
 //    // Wait for IP address
 //    printf("** Waiting for WiFi to connect...\n");
@@ -24,6 +24,8 @@ public:
 
     const Vector<String>& scanForNetworks() const;
     String ssid() const;
+    
+    // Before start() the station config is kept and set by start()
     void connectToSTA(const char* ssid, const char* pwd);
     
 private:
@@ -36,12 +38,18 @@ private:
     // a webpage with SSID choices and the ability to enter a
     // password
     bool setupConnection(const char* apName);
+    
+    void setSTAConfig();
 
     State _state = State::InitialTry;
     EventGroupHandle_t _eventGroup;
     
     uint32_t _reconnectTries = 0;
     
+    bool _started = false;
+    String _staSSID;
+    String _staPassword;
+    
     mutable Vector<String> _ssidList;
 };
 
@@ -9,100 +9,331 @@
 
 #include "Scanner.h"
 
+#include <cstring>
+
 using namespace m8r;
 
-Token Scanner::scanString(char terminal)
+namespace {
+
+// Character classes, looked up in a table rather than with comparisons
+enum CharClass : uint8_t {
+    Space   = 0x01,
+    Digit   = 0x02,
+    Hex     = 0x04,
+    IdFirst = 0x08,
+    IdOther = 0x10,
+    Special = 0x20,
+};
+
+struct CharTable
+{
+    constexpr CharTable() : flags()
+    {
+        for (int c = 0; c < 256; ++c) {
+            bool digit = c >= '0' && c <= '9';
+            bool letter = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+            bool idFirst = letter || c == '$' || c == '_';
+            uint8_t f = 0;
+            if (c == ' ' || c == '\n' || c == '\r' || c == '\f' || c == '\t' || c == '\v') {
+                f |= Space;
+            }
+            if (digit) {
+                f |= Digit | Hex | IdOther;
+            }
+            if ((c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F')) {
+                f |= Hex;
+            }
+            if (idFirst) {
+                f |= IdFirst | IdOther;
+            }
+            if ((c >= '!' && c <= '/') || (c >= ':' && c <= '@') || (c >= '[' && c <= '`') || (c >= '{' && c <= '~')) {
+                f |= Special;
+            }
+            flags[c] = f;
+        }
+    }
+    
+    uint8_t flags[256];
+};
+
+static constexpr CharTable charTable;
+
+static inline bool is(uint8_t c, uint8_t charClass) { return (charTable.flags[c] & charClass) != 0; }
+
+// Keywords are found with a perfect hash. (length ^ first char) & 7
+// is different for each one, so there is at most one compare
+struct Keyword
+{
+    const char* name;
+    uint8_t length;
+    Token token;
+};
+
+static const Keyword keywords[8] = {
+    { "true", 4, Token::True },
+    { nullptr, 0, Token::None },
+    { "null", 4, Token::Null },
+    { "false", 5, Token::False },
+    { "undefined", 9, Token::Undefined },
+    { nullptr, 0, Token::None },
+    { nullptr, 0, Token::None },
+    { nullptr, 0, Token::None },
+};
+
+static Token keyword(const char* s, uint16_t length)
+{
+    const Keyword& k = keywords[(length ^ static_cast<uint8_t>(s[0])) & 7];
+    return (k.length == length && memcmp(k.name, s, length) == 0) ? k.token : Token::Identifier;
+}
+
+}
+
+void Scanner::setWindow(const uint8_t* data, uint32_t size, bool isCarry) const
+{
+    _begin = _cur = data;
+    _end = data + size;
+    _windowIsCarry = isCarry;
+}
+
+bool Scanner::refill() const
+{
+    if (!_istream) {
+        // Push mode. Move on from the carried bytes to the chunk, if there is one
+        if (!_chunk) {
+            _starved = !_finished;
+            return false;
+        }
+        if (_tokenStart) {
+            copyToken(_end);
+        }
+        setWindow(_chunk, _chunkSize, false);
+        _chunk = nullptr;
+        if (_tokenStart) {
+            _tokenStart = _cur;
+        }
+        return _cur < _end;
+    }
+    
+    // Save the part of the current token in this window
+    if (_tokenStart) {
+        copyToken(_end);
+    }
+    
+    if (_spanSize) {
+        _istream->skip(_spanSize);
+        _spanSize = 0;
+    }
+    
+    uint32_t size;
+    const uint8_t* data = _istream->span(size);
+    if (data && size) {
+        setWindow(data, size, false);
+        _spanSize = size;
+    } else {
+        int32_t result = _istream->read(_buffer, BufferSize);
+        setWindow(_buffer, (result > 0) ? result : 0, false);
+    }
+    
+    if (_tokenStart) {
+        _tokenStart = _cur;
+    }
+    return _cur < _end;
+}
+
+void Scanner::release()
+{
+    // Give back the part of a span which wasn't used
+    if (_istream && _spanSize) {
+        _istream->skip(static_cast<uint32_t>(_cur - _begin));
+    }
+    _begin = _cur = _end = _tokenStart = nullptr;
+    _spanSize = 0;
+}
+
+void Scanner::feed(const char* data, uint32_t size)
+{
+    if (_currentToken == Token::Incomplete) {
+        _currentToken = Token::None;
+    }
+    
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(data);
+    if (_windowIsCarry && _cur < _end) {
+        _chunk = p;
+        _chunkSize = size;
+    } else {
+        setWindow(p, size, false);
+    }
+}
+
+void Scanner::finish()
+{
+    if (_currentToken == Token::Incomplete) {
+        _currentToken = Token::None;
+    }
+    _finished = true;
+}
+
+// Push mode ran out of input in the middle of a token. Keep its bytes
+// and rewind to scan it again when there is more
+Token Scanner::suspend()
+{
+    String carry;
+    const uint8_t* p = _rawStart;
+    if (_rawInCarry) {
+        const uint8_t* carryEnd = reinterpret_cast<const uint8_t*>(_carry.c_str()) + _carry.size();
+        for ( ; p < carryEnd; ++p) {
+            carry += *p;
+        }
+        p = _windowIsCarry ? _end : _begin;
+    }
+    for ( ; p < _end; ++p) {
+        carry += *p;
+    }
+    
+    _carry = carry;
+    setWindow(reinterpret_cast<const uint8_t*>(_carry.c_str()), _carry.size(), true);
+    _lineno = _rawLineno;
+    _tokenStart = nullptr;
+    _starved = false;
+    return Token::Incomplete;
+}
+
+void Scanner::beginToken(const uint8_t* start) const
+{
+    _tokenStart = start;
+    _tokenCopied = false;
+    _tokenString.clear();
+}
+
+void Scanner::copyToken(const uint8_t* end) const
+{
+    for (const uint8_t* p = _tokenStart; p < end; ++p) {
+        _tokenString += *p;
+    }
+    _tokenStart = end;
+    _tokenCopied = true;
+}
+
+void Scanner::endToken(const uint8_t* end, TokenType& tokenValue) const
+{
+    if (_tokenCopied) {
+        copyToken(end);
+        tokenValue.str = _tokenString.c_str();
+        tokenValue.length = static_cast<uint16_t>(_tokenString.size());
+    } else {
+        tokenValue.str = reinterpret_cast<const char*>(_tokenStart);
+        tokenValue.length = static_cast<uint16_t>(end - _tokenStart);
+    }
+    _tokenStart = nullptr;
+}
+
+Token Scanner::scanString(char terminal, TokenType& tokenValue)
 {    
 	uint8_t c;
-	_tokenString.clear();
+    beginToken(_cur);
 	
 	while ((c = get()) != C_EOF) {
 		if (c == terminal) {
-			break;
+            endToken(_cur - 1, tokenValue);
+            return Token::String;
 		}
-        while (c == '\\') {
-            switch((c = get())) {
-                case 'a': c = 0x07; break;
-                case 'b': c = 0x08; break;
-                case 'f': c = 0x0c; break;
-                case 'n': c = 0x0a; break;
-                case 'r': c = 0x0d; break;
-                case 't': c = 0x09; break;
-                case 'v': c = 0x0b; break;
-                case '\\': c = 0x5c; break;
-                case '\'': c = 0x27; break;
-                case '"': c = 0x22; break;
-                case '?': c = 0x3f; break;
-                case 'u':
-                case 'x': {
-                    if ((c = get()) == C_EOF) {
-                        return Token::String;
-                    }
-                    
-                    if (!isHex(c) && !isdigit(c)) {
-                        c = '?';
-                        break;
-                    }
-                    
-                    uint32_t num = 0;
+        if (c == '\\') {
+            // The escape is decoded into _tokenString, not copied by a refill
+            copyToken(_cur - 1);
+            _tokenStart = nullptr;
+            scanEscape();
+            _tokenStart = _cur;
+        }
+	}
+    
+    // Unterminated
+    endToken(_cur, tokenValue);
+	return Token::String;
+}
+
+// Append the character for the escape sequence after a '\' to _tokenString
+void Scanner::scanEscape()
+{
+    uint8_t c = get();
+    switch(c) {
+        case C_EOF: return;
+        case 'a': c = 0x07; break;
+        case 'b': c = 0x08; break;
+        case 'f': c = 0x0c; break;
+        case 'n': c = 0x0a; break;
+        case 'r': c = 0x0d; break;
+        case 't': c = 0x09; break;
+        case 'v': c = 0x0b; break;
+        case '\\': c = 0x5c; break;
+        case '\'': c = 0x27; break;
+        case '"': c = 0x22; break;
+        case '?': c = 0x3f; break;
+        case 'u':
+        case 'x': {
+            uint32_t num = 0;
+            int32_t numDigits = 0;
+            while ((c = get()) != C_EOF) {
+                if (!is(c, Hex)) {
                     putback(c);
-                    while ((c = get()) != C_EOF) {
-                        if (!isHex(c) && !isdigit(c)) {
-                            break;
-                        }
-                        if (isdigit(c)) {
-                            num = (num << 4) | (c - '0');
-                        } else if (isUpper(c)) {
-                            num = (num << 4) | ((c - 'A') + 0x0a);
-                        } else {
-                            num = (num << 4) | ((c - 'a') + 0x0a);
-                        }
-                    }
-                    if (num > 0xffffff) {
-                        _tokenString += static_cast<uint8_t>(num >> 24);
-                        _tokenString += static_cast<uint8_t>(num >> 16);
-                        _tokenString += static_cast<uint8_t>(num >> 8);
-                        _tokenString += static_cast<uint8_t>(num);
-                    } else if (num > 0xffff) {
-                        _tokenString += static_cast<uint8_t>(num >> 16);
-                        _tokenString += static_cast<uint8_t>(num >> 8);
-                        _tokenString += static_cast<uint8_t>(num);
-                    } else if (num > 0xff) {
-                        _tokenString += static_cast<uint8_t>(num >> 8);
-                        _tokenString += static_cast<uint8_t>(num);
-                    } else {
-                        _tokenString += static_cast<uint8_t>(num);
-                    }
                     break;
                 }
-                default: {
-                    if (!isOctal(c)) {
-                        c = '?';
-                        break;
-                    }
-                    
-                    uint32_t size = 0;
-                    uint32_t num = c - '0';
-                    while ((c = get()) != C_EOF) {
-                        if (!isOctal(c) || ++size >= 3) {
-                            break;
-                        }
-                        num = (num << 3) | (c - '0');
-                    }
-                    _tokenString += static_cast<uint8_t>(num & 0x3f);
+                if (is(c, Digit)) {
+                    num = (num << 4) | (c - '0');
+                } else if (isUpper(c)) {
+                    num = (num << 4) | ((c - 'A') + 0x0a);
+                } else {
+                    num = (num << 4) | ((c - 'a') + 0x0a);
+                }
+                ++numDigits;
+            }
+            if (numDigits == 0) {
+                _tokenString += '?';
+                return;
+            }
+            if (num > 0xffffff) {
+                _tokenString += static_cast<uint8_t>(num >> 24);
+            }
+            if (num > 0xffff) {
+                _tokenString += static_cast<uint8_t>(num >> 16);
+            }
+            if (num > 0xff) {
+                _tokenString += static_cast<uint8_t>(num >> 8);
+            }
+            _tokenString += static_cast<uint8_t>(num);
+            return;
+        }
+        default: {
+            if (!isOctal(c)) {
+                c = '?';
+                break;
+            }
+            
+            // Up to 3 octal digits
+            uint32_t num = c - '0';
+            for (int i = 0; i < 2; ++i) {
+                if ((c = get()) == C_EOF) {
                     break;
                 }
+                if (!isOctal(c)) {
+                    putback(c);
+                    break;
+                }
+                num = (num << 3) | (c - '0');
             }
+            c = static_cast<uint8_t>(num);
+            break;
         }
-		_tokenString += c;
-	}
-	return Token::String;
+    }
+    _tokenString += c;
 }
 
 Token Scanner::scanSpecial()
 {
 	uint8_t c = get();
-    if (!isSpecial(c)) {
+    if (c == C_EOF) {
+        return Token::EndOfFile;
+    }
+    if (!is(c, Special)) {
         putback(c);
         return Token::EndOfFile;
     }
@@ -110,37 +341,26 @@ Token Scanner::scanSpecial()
     return static_cast<Token>(c);
 }
 
-Token Scanner::scanIdentifier()
+Token Scanner::scanIdentifier(TokenType& tokenValue)
 {
-	uint8_t c;
-	_tokenString.clear();
-
-	bool first = true;
+	uint8_t c = get();
+    if (c == C_EOF) {
+        return Token::EndOfFile;
+    }
+    if (!is(c, IdFirst)) {
+        putback(c);
+        return Token::EndOfFile;
+    }
+    
+    beginToken(_cur - 1);
 	while ((c = get()) != C_EOF) {
-		if (!((first && isIdFirst(c)) || (!first && isIdOther(c)))) {
+		if (!is(c, IdOther)) {
 			putback(c);
 			break;
 		}
-		_tokenString += c;
-		first = false;
 	}
-    size_t len = _tokenString.size();
-    if (len) {
-        // Check for keywords
-        if (_tokenString == "false") {
-            return Token::False;
-        } else if (_tokenString == "true") {
-            return Token::True;
-        } else if (_tokenString == "null") {
-            return Token::Null;
-        } else if (_tokenString == "undefined") {
-            return Token::Undefined;
-        }
-        
-        return Token::Identifier;
-    }
-
-    return Token::EndOfFile;
+    endToken(_cur, tokenValue);
+    return keyword(tokenValue.str, tokenValue.length);
 }
 
 // Return the number of digits scanned
@@ -151,7 +371,7 @@ int32_t Scanner::scanDigits(int32_t& number, bool hex)
     int32_t numDigits = 0;
     
 	while ((c = get()) != C_EOF) {
-		if (isdigit(c)) {
+		if (is(c, Digit)) {
             number = number * radix;
             number += static_cast<int32_t>(c - '0');
         } else if (hex && isLCHex(c)) {
@@ -200,7 +420,7 @@ Token Scanner::scanNumber(TokenType& tokenValue)
         return Token::EndOfFile;
     }
     
-	if (!isdigit(c)) {
+	if (!is(c, Digit)) {
 		putback(c);
 		return Token::EndOfFile;
 	}
@@ -218,7 +438,7 @@ Token Scanner::scanNumber(TokenType& tokenValue)
             if ((c = get()) == C_EOF) {
                 return Token::EndOfFile;
             }
-            if (!isdigit(c)) {
+            if (!is(c, Hex)) {
                 putback(c);
                 return Token::Unknown;
             }
@@ -254,7 +474,7 @@ bool Scanner::scanFloat(int32_t& mantissa, int32_t& exp)
     if (c == 'e' || c == 'E') {
         haveFloat = true;
         if ((c = get()) == C_EOF) {
-            return false;
+            return true;
         }
         int32_t neg = 1;
         if (c == '+' || c == '-') {
@@ -287,7 +507,9 @@ Token Scanner::scanComment()
 				if ((c = get()) == '/') {
 					break;
 				}
-				putback(c);
+                if (c != C_EOF) {
+                    putback(c);
+                }
 			}
 		}
 		return Token::Comment;
@@ -306,27 +528,10 @@ Token Scanner::scanComment()
 		return Token::Comment;
 	}
 
-    _tokenString.clear();
-    _tokenString += c;
-	return Token::Slash;
-}
-
-uint8_t Scanner::get() const
-{
-    if (_lastChar != C_EOF) {
-        uint8_t c = _lastChar;
-        _lastChar = C_EOF;
-        return c;
-    }
-    int result = _istream->read();
-    if (result < 0 || result > 0xff) {
-        return C_EOF;
-    }
-    uint8_t c = static_cast<uint8_t>(result);
-    if (c == '\n') {
-        ++_lineno;
+    if (c != C_EOF) {
+        putback(c);
     }
-    return c;
+	return Token::Slash;
 }
 
 Token Scanner::getToken(TokenType& tokenValue, bool ignoreWhitespace)
@@ -334,8 +539,12 @@ Token Scanner::getToken(TokenType& tokenValue, bool ignoreWhitespace)
 	uint8_t c;
 	Token token = Token::EndOfFile;
 	
-	while (token == Token::EndOfFile && (c = get()) != C_EOF) {
-        if (isspace(c)) {
+	while (token == Token::EndOfFile && !_starved) {
+        markToken();
+        if ((c = get()) == C_EOF) {
+            break;
+        }
+        if (is(c, Space)) {
             if (ignoreWhitespace) {
                 continue;
             }
@@ -354,8 +563,7 @@ Token Scanner::getToken(TokenType& tokenValue, bool ignoreWhitespace)
 				
 			case '\"':
 			case '\'':
-				token = scanString(c);
-                tokenValue.str = _tokenString.c_str();
+				token = scanString(c, tokenValue);
 				break;
 
 			default:
@@ -366,10 +574,7 @@ Token Scanner::getToken(TokenType& tokenValue, bool ignoreWhitespace)
 				if ((token = scanSpecial()) != Token::EndOfFile) {                    
 					break;
 				}
-				if ((token = scanIdentifier()) != Token::EndOfFile) {
-                    if (token == Token::Identifier) {
-                        tokenValue.str = _tokenString.c_str();
-                    }
+				if ((token = scanIdentifier(tokenValue)) != Token::EndOfFile) {
 					break;
 				}
 				token = Token::Unknown;
@@ -377,5 +582,8 @@ Token Scanner::getToken(TokenType& tokenValue, bool ignoreWhitespace)
 		}
 	}
     
+    if (_starved) {
+        return suspend();
+    }
 	return token;
 }
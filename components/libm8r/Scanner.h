@@ -20,7 +20,23 @@ namespace m8r {
 //
 //  Class: Scanner
 //
-//  
+//  Tokenizer for JSON and number strings. Input is scanned a buffer at a
+//  time rather than a byte at a time. If the Stream holds its data in
+//  memory (Stream::span) the Scanner works directly on that, otherwise it
+//  reads BufferSize blocks into its own buffer.
+//
+//  String and Identifier tokens are returned as a pointer and length into
+//  the input. They are only copied (into _tokenString) when escapes had to
+//  be rewritten or when the token crosses a buffer refill. Either way the
+//  pointer is valid until the next token is scanned and is not '\0'
+//  terminated, so use the length.
+//
+//  With no Stream the Scanner is in push mode. Input is given to feed()
+//  in chunks as it arrives (e.g. from TCP::Event::ReceivedData). When a
+//  chunk runs out getToken() returns Token::Incomplete. The raw bytes of
+//  the unfinished token are kept and it is scanned again, from its start,
+//  when the next chunk is fed. Call finish() after the last chunk so the
+//  final token can end at the end of input.
 //
 //////////////////////////////////////////////////////////////////////////////
 
@@ -70,31 +86,44 @@ enum class Token : uint8_t {
     Special     = 0x8c,
     Error       = 0x8d,
     EndOfFile   = 0x8e,
+    Incomplete  = 0x8f,
 };
 
 static constexpr uint8_t C_EOF = static_cast<uint8_t>(Token::EndOfFile);
 
 class Scanner  {
 public:
+    static constexpr uint16_t BufferSize = 64;
+    
     typedef struct {
         float   	    number;
         uint32_t        integer;
         uint32_t        argcount;
         const char*     str;
+        uint16_t        length;
     } TokenType;
 
   	Scanner(const Stream* istream = nullptr)
-  	 : _lastChar(C_EOF)
-  	 , _istream(istream)
+  	 : _istream(istream)
      , _lineno(1)
   	{
     }
   	
   	~Scanner()
   	{
+        release();
     }
     
-    void setStream(const Stream* istream) { _istream = istream; }
+    void setStream(const Stream* istream)
+    {
+        release();
+        _istream = istream;
+    }
+  
+    // Push mode input. The chunk must stay valid until getToken() returns
+    // Token::Incomplete. Tokens returned before that point into it
+    void feed(const char* data, uint32_t size);
+    void finish();
   
     uint32_t lineno() const { return _lineno; }
   	
@@ -119,29 +148,91 @@ public:
 private:
   	Token getToken(TokenType& token, bool ignoreWhitespace);
 
-    uint8_t get() const;
+    uint8_t get() const
+    {
+        if (_cur == _end && !refill()) {
+            return C_EOF;
+        }
+        uint8_t c = *_cur++;
+        if (c == '\n') {
+            ++_lineno;
+        }
+        return c;
+    }
     
+    // Only the character just returned by get() can be put back. It is
+    // always still in the buffer
 	void putback(uint8_t c) const
 	{
-  		assert(_lastChar == C_EOF && c != C_EOF);
-  		_lastChar = c;
+  		assert(c != C_EOF && _cur > _begin);
+        --_cur;
+        if (c == '\n') {
+            --_lineno;
+        }
 	}
+    
+    bool refill() const;
+    void release();
+    
+    void setWindow(const uint8_t* data, uint32_t size, bool isCarry) const;
+    
+    // Remember where a token starts, so it can be carried to the next
+    // chunk in push mode
+    void markToken()
+    {
+        _rawStart = _cur;
+        _rawInCarry = _windowIsCarry;
+        _rawLineno = _lineno;
+    }
+    
+    Token suspend();
+    
+    // A token starts as a run of bytes in the buffer. copyToken() moves
+    // the run into _tokenString, after which the rest of the token is
+    // appended there too
+    void beginToken(const uint8_t* start) const;
+    void copyToken(const uint8_t* end) const;
+    void endToken(const uint8_t* end, TokenType&) const;
 
-  	Token scanString(char terminal);
+  	Token scanString(char terminal, TokenType&);
+    void scanEscape();
   	Token scanSpecial();
-  	Token scanIdentifier();
+  	Token scanIdentifier(TokenType&);
   	Token scanNumber(TokenType& tokenValue);
   	Token scanComment();
   	int32_t scanDigits(int32_t& number, bool hex);
   	bool scanFloat(int32_t& mantissa, int32_t& exp);
     
-  	mutable uint8_t _lastChar;
-  	String _tokenString;
+  	mutable String _tokenString;
   	const Stream* _istream;
     mutable uint32_t _lineno;
+    
+    // Current window of input, either _buffer or the Stream's span. If it
+    // is a span, _spanSize bytes are skipped in the Stream when it is used up
+    mutable const uint8_t* _begin = nullptr;
+    mutable const uint8_t* _cur = nullptr;
+    mutable const uint8_t* _end = nullptr;
+    mutable uint32_t _spanSize = 0;
+    
+    // Start of the token being scanned, or null
+    mutable const uint8_t* _tokenStart = nullptr;
+    mutable bool _tokenCopied = false;
+    
+    mutable uint8_t _buffer[BufferSize];
+    
+    // Push mode state. _carry holds the bytes of an unfinished token. The
+    // chunk is scanned after it
+    String _carry;
+    mutable const uint8_t* _chunk = nullptr;
+    mutable uint32_t _chunkSize = 0;
+    mutable bool _windowIsCarry = false;
+    mutable bool _starved = false;
+    bool _finished = false;
+    const uint8_t* _rawStart = nullptr;
+    bool _rawInCarry = false;
+    uint32_t _rawLineno = 1;
 
     Token _currentToken = Token::None;
     Scanner::TokenType _currentTokenValue;
 };
-
 }
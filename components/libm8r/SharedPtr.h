@@ -11,6 +11,7 @@
 
 #include <cassert>
 #include <cstdint>
+#include <utility>
 
 namespace m8r {
 
@@ -44,21 +45,20 @@ namespace m8r {
         ~SharedPtr() { reset(); }
         
         SharedPtr& operator=(const SharedPtr& other) { reset(other._ptr); return *this; }
-        SharedPtr& operator=(SharedPtr&& other) { _ptr = other._ptr; other._ptr = nullptr; return *this; }
+        SharedPtr& operator=(SharedPtr&& other) { std::swap(_ptr, other._ptr); return *this; }
 
         void reset(T* p = nullptr)
         {
+            if (p) {
+                count(p)++;
+            }
             if (_ptr) {
                 assert(count(_ptr) > 0);
                 if (--count(_ptr) == 0) {
                     delete _ptr;
-                    _ptr = nullptr;
                 }
             }
-            if (p) {
-                count(p)++;
-                _ptr = p;
-            }
+            _ptr = p;
         }
 
         void reset(SharedPtr<T>& p) { reset(p.get()); }
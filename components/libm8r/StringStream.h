@@ -11,6 +11,7 @@
 
 #include "MStream.h"
 #include "Containers.h"
+#include "MString.h"
 
 namespace m8r {
 
@@ -27,22 +28,20 @@ class StringStream : public m8r::Stream {
 public:
     StringStream() : _s(nullptr), _isString(false) { }
 	StringStream(const String& s) : _string(s), _isString(true) { }
-	StringStream(const char* s) : _s(s), _isString(false) { }
+	StringStream(const char* s) : _s(s), _isString(false), _size(s ? static_cast<uint32_t>(strlen(s)) : 0) { }
     
-    virtual ~StringStream() { }
+    virtual ~StringStream()
+    {
+        if (_isString) {
+            _string.~String();
+        }
+    }
 	
     bool loaded() { return true; }
     
     virtual int read() const override
     {
-        if (_isString) {
-            return (_index < _string.size()) ? _string[_index++] : -1;
-        } else {
-            if (!_s) {
-                return -1;
-            }
-            return (_s[_index] == '\0') ? -1 : _s[_index++];
-        }
+        return (_index < size()) ? static_cast<uint8_t>(data()[_index++]) : -1;
     }
     
     virtual int write(uint8_t c) override
@@ -59,13 +58,62 @@ public:
         _index++;
         return c;
     }
+    
+    virtual int32_t read(uint8_t* buf, uint32_t size) const override
+    {
+        uint32_t available = this->size() - _index;
+        if (size > available) {
+            size = available;
+        }
+        memcpy(buf, data() + _index, size);
+        _index += size;
+        return size;
+    }
+    
+    virtual int32_t write(const uint8_t* buf, uint32_t size) override
+    {
+        if (!_isString || _index != _string.size()) {
+            return -1;
+        }
+        _string.reserve(_string.size() + size + 1);
+        for (uint32_t i = 0; i < size; ++i) {
+            _string += buf[i];
+        }
+        _index += size;
+        return size;
+    }
+    
+    virtual int peek() const override
+    {
+        return (_index < size()) ? static_cast<uint8_t>(data()[_index]) : -1;
+    }
+    
+    virtual const uint8_t* span(uint32_t& size) const override
+    {
+        size = this->size() - _index;
+        return size ? reinterpret_cast<const uint8_t*>(data() + _index) : nullptr;
+    }
+    
+    virtual uint32_t skip(uint32_t size) const override
+    {
+        uint32_t available = this->size() - _index;
+        if (size > available) {
+            size = available;
+        }
+        _index += size;
+        return size;
+    }
 	
 private:
+    const char* data() const { return _isString ? _string.c_str() : _s; }
+    uint32_t size() const { return _isString ? _string.size() : _size; }
+    
     union {
         String _string;
         const char* _s;
     };
     bool _isString = false;
+    uint32_t _size = 0;
     mutable uint32_t _index = 0;
 };
 
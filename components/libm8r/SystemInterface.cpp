@@ -35,7 +35,9 @@ SystemInterface::SystemInterface()
 
 bool SystemInterface::runOneIteration()
 {
-    return taskManager()->runOneIteration();
+    // Completions wake the tasks waiting on them, so run them first
+    bool didWork = _asyncIO.dispatchCompletions();
+    return taskManager()->runOneIteration() || didWork;
 }
 
 void SystemInterface::startHeartbeat()
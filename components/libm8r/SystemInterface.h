@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "AsyncIO.h"
 #include "Containers.h"
 #include "IPAddr.h"
 #include "ScriptingLanguage.h"
@@ -42,7 +43,7 @@ using ConsoleCB = std::function<void(const char*)>;
 
 class SystemInterface  {
 public:
-    enum class Event { None, NetworkStarted };
+    enum class Event { None, NetworkStarted, FSChanged };
     
     static SystemInterface* create();
 
@@ -74,6 +75,7 @@ public:
     virtual void setSSID(const String& ssid, const String& password) = 0;
     
     TaskManager* taskManager() { return &_taskManager; };
+    AsyncIO* asyncIO() { return &_asyncIO; }
 
     virtual void setDeviceName(const char*) = 0;
         
@@ -124,6 +126,7 @@ private:
     
     std::function<void(const char*)> _listenerFunc;
     TaskManager _taskManager;
+    AsyncIO _asyncIO;
     
     Timer _heartbeatTimer;
     Duration _heartrate;
@@ -13,6 +13,7 @@
 
 #include "FileStream.h"
 #include "ScriptingLanguage.h"
+#include "StringStream.h"
 #include "SystemInterface.h"
 
 #include <cassert>
@@ -63,10 +64,65 @@ bool Task::load(const char* filename)
         print(Error::formatError(file->error().code(), "Error reading '%s'", filename).c_str());
     }
         
-    file.destroy(MemoryType::Native);
+    system()->fileSystem()->release(file);
     return ret;
 }
 
+bool Task::loadAsync(const char* filename)
+{
+    Vector<String> parts = String(filename).split(".");
+    if (parts.size() < 2) {
+        system()->printf("***** Missing suffix for '%s'\n\n", filename);
+        return false;
+    }
+    
+    if (!system()->fileSystem()) {
+        print(Error::formatError(Error::Code::NoFS, "Unable to open '%s' for execution", filename).c_str());
+        _error = Error::Code::NoFS;
+        return false;
+    }
+    
+    Mad<File> file = system()->fileSystem()->open(filename, FS::FileOpenMode::Read);
+    Error error = file->error();
+    int32_t size = error ? -1 : file->size();
+    
+    // Read it all in one request, '\0' terminated for the StringStream
+    Mad<char> buffer;
+    if (!error) {
+        buffer = Mallocator::shared()->allocate<char>(MemoryType::Native, size + 1);
+        if (!buffer.valid()) {
+            error = Error::Code::OutOfMemory;
+        }
+    }
+    
+    if (error) {
+        print(Error::formatError(error.code(), "Unable to open '%s' for execution", filename).c_str());
+        _error = error;
+        system()->fileSystem()->release(file);
+        return false;
+    }
+    
+    String name = filename;
+    String type = parts.back();
+    
+    // The request holds a reference to this task until the completion has run
+    system()->asyncIO()->read(file, buffer.get(), size, [this, file, buffer, size, name, type](int32_t result)
+    {
+        if (result == size) {
+            buffer.get()[size] = '\0';
+            load(StringStream(buffer.get()), type);
+        } else {
+            _error = file->error() ? file->error() : Error(Error::Code::ReadError);
+            print(Error::formatError(_error.code(), "Error reading '%s'", name.c_str()).c_str());
+        }
+        Mallocator::shared()->deallocate(MemoryType::Native, buffer);
+        system()->fileSystem()->release(file);
+    }, SharedPtr<Task>(this));
+    
+    setState(State::WaitingForEvent);
+    return true;
+}
+
 bool Task::load(const Stream& stream, const String& type)
 {
 #ifndef NDEBUG
@@ -81,6 +137,9 @@ bool Task::load(const Stream& stream, const String& type)
         
         if (String(lang->suffix()) == type) {
             _executable = lang->create();
+            if (_consolePrintFunction) {
+                _executable->setConsolePrintFunction(_consolePrintFunction);
+            }
             _executable->load(stream);
             
             // FIXME: Check for errors
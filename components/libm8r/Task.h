@@ -37,18 +37,38 @@ public:
 
     bool load(const Stream&, const String& type);
     bool load(const char* filename);
+    
+    // Reads filename with AsyncIO and loads it on the main loop when the
+    // read completes. The task is suspended until then, so it can be run
+    // straight away and waits WaitingForEvent. If the file can't be read
+    // the task finishes without running anything. Returns false if the
+    // read couldn't be started
+    bool loadAsync(const char* filename);
 
     Error error() const { return _error; }
     
-    bool readyToRun() const { return state() == State::Ready || _executable->readyToRun(); }
+    bool readyToRun() const
+    {
+        if (_suspendCount) {
+            return false;
+        }
+        return state() == State::Ready || _executable->readyToRun();
+    }
     void requestYield() const { if (_executable) _executable->requestYield(); }
     
-    void receivedData(const String& data, KeyAction action) { _executable->receivedData(data, action); }
+    void receivedData(const String& data, KeyAction action)
+    {
+        if (_executable) {
+            _executable->receivedData(data, action);
+        }
+    }
     
     void print(const char* s) const;
     
+    // Kept for the executable if it hasn't been loaded yet
     void setConsolePrintFunction(const std::function<void(const String&)>& f)
     {
+        _consolePrintFunction = f;
         if (_executable) {
             _executable->setConsolePrintFunction(f);
         }
@@ -78,8 +98,12 @@ private:
     void finish() { if (_finishCB) _finishCB(this); }
 
     TaskManager::FinishCallback _finishCB;
+    std::function<void(const String&)> _consolePrintFunction;
         
     State _state = State::Ready;
+    
+    // Outstanding TaskManager::suspend() calls
+    uint8_t _suspendCount = 0;
 };
 
 }
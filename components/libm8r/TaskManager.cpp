@@ -59,7 +59,10 @@ void TaskManager::run(const SharedPtr<Task>& newTask, FinishCallback cb)
     {
         newTask->_finishCB = cb;
         _list.push_back(newTask);
-        newTask->setState(Task::State::Ready);
+        
+        // A task still waiting on something, like a script being read, is
+        // made Ready by the wake() that ends its suspension
+        newTask->setState(newTask->_suspendCount ? Task::State::WaitingForEvent : Task::State::Ready);
     }
     readyToExecuteNextTask();
 }
@@ -72,6 +75,20 @@ void TaskManager::terminate(const SharedPtr<Task>& task)
     }
 }
 
+void TaskManager::suspend(const SharedPtr<Task>& task)
+{
+    ++task->_suspendCount;
+}
+
+void TaskManager::wake(const SharedPtr<Task>& task)
+{
+    assert(task->_suspendCount);
+    if (--task->_suspendCount == 0 && task->state() == Task::State::WaitingForEvent) {
+        task->setState(Task::State::Ready);
+        readyToExecuteNextTask();
+    }
+}
+
 bool TaskManager::runOneIteration()
 {
     if (_list.empty()) {
@@ -30,6 +30,11 @@ public:
 
     void run(const SharedPtr<Task>&, FinishCallback);
     void terminate(const SharedPtr<Task>&);
+    
+    // A suspended task doesn't run until each suspend() has been matched by
+    // a wake(). The last wake() makes it Ready if it was WaitingForEvent
+    void suspend(const SharedPtr<Task>&);
+    void wake(const SharedPtr<Task>&);
 
     void readyToExecuteNextTask();
 
@@ -146,7 +146,7 @@ public:
         other._thread = tmp;
     }
         
-    void join() { pthread_join(_thread, nullptr); }
+    void join() { pthread_join(_thread, nullptr); _thread = pthread_t(); }
     void detach() { pthread_detach(_thread); _thread = pthread_t(); }
     void terminate() { pthread_cancel(_thread); }
     bool joinable() { return _thread != pthread_t(); }
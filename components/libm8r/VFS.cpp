@@ -0,0 +1,362 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "VFS.h"
+
+#include <cstring>
+#include <limits>
+
+using namespace m8r;
+
+// Length of the directory part of the path, not counting the last '/'
+static uint32_t directoryLength(const char* path)
+{
+    const char* slash = strrchr(path, '/');
+    return slash ? static_cast<uint32_t>(slash - path) : 0;
+}
+
+static bool prefixMatches(const String& prefix, const char* path)
+{
+    if (prefix == "/") {
+        return true;
+    }
+    return strncmp(path, prefix.c_str(), prefix.size()) == 0 && (path[prefix.size()] == '\0' || path[prefix.size()] == '/');
+}
+
+bool VFS::addMount(const char* prefix, FS* fs)
+{
+    if (!prefix || prefix[0] != '/' || !fs) {
+        return false;
+    }
+
+    String path(prefix);
+    while (path.size() > 1 && path[path.size() - 1] == '/') {
+        path = path.slice(0, static_cast<int32_t>(path.size()) - 1);
+    }
+    if (mountedAt(path.c_str())) {
+        return false;
+    }
+
+    Mount mount;
+    mount.prefix = path;
+    mount.fs = fs;
+    _mounts.push_back(mount);
+    _resolveCache.clear();
+    return true;
+}
+
+bool VFS::removeMount(const char* prefix)
+{
+    for (auto it = _mounts.begin(); it != _mounts.end(); ++it) {
+        if (it->prefix == prefix) {
+            _mounts.erase(it);
+            _resolveCache.clear();
+            return true;
+        }
+    }
+    return false;
+}
+
+FS* VFS::mountedAt(const char* prefix) const
+{
+    for (const auto& it : _mounts) {
+        if (it.prefix == prefix) {
+            return it.fs;
+        }
+    }
+    return nullptr;
+}
+
+bool VFS::mount()
+{
+    for (const auto& it : _mounts) {
+        it.fs->mount();
+    }
+    FS* fs = root();
+    _error = fs ? fs->lastError() : Error(Error::Code::NoFS);
+    return fs && fs->mounted();
+}
+
+bool VFS::mounted() const
+{
+    FS* fs = root();
+    return fs && fs->mounted();
+}
+
+void VFS::unmount()
+{
+    for (const auto& it : _mounts) {
+        it.fs->unmount();
+    }
+    _error = Error::Code::NotMounted;
+}
+
+bool VFS::format()
+{
+    FS* fs = root();
+    if (!fs) {
+        return false;
+    }
+    bool result = fs->format();
+    _error = fs->lastError();
+    return result;
+}
+
+Mad<File> VFS::open(const char* name, FileOpenMode mode)
+{
+    const char* rest;
+    FS* fs = resolve(name, rest);
+    if (!fs) {
+        return Mad<File>();
+    }
+
+    Mad<File> file = fs->open(rest, mode);
+    if (file.valid()) {
+        OpenFile openFile;
+        openFile.file = file.get();
+        openFile.fs = fs;
+        _openFiles.push_back(openFile);
+    }
+    return file;
+}
+
+void VFS::release(Mad<File> file)
+{
+    if (!file.valid()) {
+        return;
+    }
+
+    for (auto it = _openFiles.begin(); it != _openFiles.end(); ++it) {
+        if (it->file == file.get()) {
+            FS* fs = it->fs;
+            _openFiles.erase(it);
+            fs->release(file);
+            return;
+        }
+    }
+    FS::release(file);
+}
+
+Mad<Directory> VFS::openDirectory(const char* name)
+{
+    const char* rest;
+    FS* fs = resolve(name, rest);
+    return fs ? fs->openDirectory(rest) : Mad<Directory>();
+}
+
+bool VFS::makeDirectory(const char* name)
+{
+    const char* rest;
+    FS* fs = resolve(name, rest);
+    if (!fs) {
+        return false;
+    }
+    bool result = fs->makeDirectory(rest);
+    _error = fs->lastError();
+    return result;
+}
+
+bool VFS::remove(const char* name)
+{
+    const char* rest;
+    FS* fs = resolve(name, rest);
+    return fs && fs->remove(rest);
+}
+
+bool VFS::rename(const char* src, const char* dst)
+{
+    const char* srcRest;
+    const char* dstRest;
+    FS* srcFS = resolve(src, srcRest);
+    FS* dstFS = resolve(dst, dstRest);
+    if (!srcFS || srcFS != dstFS) {
+        // Moving between filesystems would be a copy
+        _error = Error::Code::Unimplemented;
+        return false;
+    }
+    return srcFS->rename(srcRest, dstRest);
+}
+
+bool VFS::exists(const char* name) const
+{
+    const char* rest;
+    FS* fs = resolve(name, rest);
+    return fs && fs->exists(rest);
+}
+
+bool VFS::stat(const char* name, Info& info) const
+{
+    const char* rest;
+    FS* fs = resolve(name, rest);
+    if (!fs) {
+        info = Info();
+        return false;
+    }
+    return fs->stat(rest, info);
+}
+
+bool VFS::map(const char* name, Mapping& mapping) const
+{
+    const char* rest;
+    FS* fs = resolve(name, rest);
+    return fs && fs->map(rest, mapping);
+}
+
+uint32_t VFS::totalSize() const
+{
+    FS* fs = root();
+    return fs ? fs->totalSize() : 0;
+}
+
+uint32_t VFS::totalUsed() const
+{
+    FS* fs = root();
+    return fs ? fs->totalUsed() : 0;
+}
+
+FS::FlashStats VFS::flashStats() const
+{
+    FS* fs = root();
+    return fs ? fs->flashStats() : FlashStats();
+}
+
+uint32_t VFS::eraseCount(uint32_t block) const
+{
+    FS* fs = root();
+    return fs ? fs->eraseCount(block) : 0;
+}
+
+void VFS::resetFlashStats()
+{
+    FS* fs = root();
+    if (fs) {
+        fs->resetFlashStats();
+    }
+}
+
+int16_t VFS::watch(const char* path, bool prefix, WatchFunction func)
+{
+    const char* rest;
+    const Mount* mount = resolveMount(path, rest);
+    if (!mount || !func) {
+        return -1;
+    }
+    
+    int16_t id = _nextMountWatchId;
+    addWatch(id, *mount, rest, prefix, func);
+    if (prefix) {
+        String dir = normalizePath(path);
+        for (const auto& it : _mounts) {
+            if (&it != mount && prefixMatches(dir, it.prefix.c_str())) {
+                addWatch(id, it, "/", true, func);
+            }
+        }
+    }
+    
+    _nextMountWatchId = (_nextMountWatchId == std::numeric_limits<int16_t>::max()) ? 0 : _nextMountWatchId + 1;
+    return id;
+}
+
+void VFS::unwatch(int16_t id)
+{
+    for (auto it = _mountWatches.begin(); it != _mountWatches.end(); ) {
+        if (it->id == id) {
+            it->fs->unwatch(it->fsId);
+            it = _mountWatches.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void VFS::addWatch(int16_t id, const Mount& mount, const char* path, bool prefix, const WatchFunction& func)
+{
+    // Put the mount prefix back on the paths the filesystem reports
+    String mountPrefix = (mount.prefix == "/") ? String() : mount.prefix;
+    auto fullPath = [mountPrefix](const String& path) -> String {
+        if (path.empty() || mountPrefix.empty()) {
+            return path;
+        }
+        return (path == "/") ? mountPrefix : mountPrefix + path;
+    };
+    
+    MountWatch watch;
+    watch.id = id;
+    watch.fs = mount.fs;
+    watch.fsId = mount.fs->watch(path, prefix, [fullPath, func](Change change, const String& path, const String& newPath) {
+        func(change, fullPath(path), fullPath(newPath));
+    });
+    if (watch.fsId >= 0) {
+        _mountWatches.push_back(watch);
+    }
+}
+
+FS* VFS::resolve(const char* path, const char*& rest) const
+{
+    const Mount* mount = resolveMount(path, rest);
+    return mount ? mount->fs : nullptr;
+}
+
+const VFS::Mount* VFS::resolveMount(const char* path, const char*& rest) const
+{
+    uint32_t dirLength = directoryLength(path);
+    int16_t index = -1;
+
+    for (auto it = _resolveCache.begin(); it != _resolveCache.end(); ++it) {
+        if (it->directory.size() == dirLength && strncmp(it->directory.c_str(), path, dirLength) == 0) {
+            index = it->mount;
+
+            // Most recently used at the back
+            CacheEntry entry = *it;
+            _resolveCache.erase(it);
+            _resolveCache.push_back(entry);
+            break;
+        }
+    }
+
+    if (index < 0) {
+        // Every path in a directory resolves the same way, unless a mount
+        // point is in the directory. Those aren't cached
+        bool cacheable = true;
+        for (uint16_t i = 0; i < _mounts.size(); ++i) {
+            const String& prefix = _mounts[i].prefix;
+            if (prefixMatches(prefix, path) && (index < 0 || prefix.size() > _mounts[index].prefix.size())) {
+                index = i;
+            }
+            if (prefix != "/" && directoryLength(prefix.c_str()) == dirLength && strncmp(prefix.c_str(), path, dirLength) == 0) {
+                cacheable = false;
+            }
+        }
+        if (index < 0) {
+            return nullptr;
+        }
+
+        if (cacheable) {
+            if (_resolveCache.size() >= ResolveCacheSize) {
+                _resolveCache.pop_front();
+            }
+            CacheEntry entry;
+            entry.directory = String(path, static_cast<int32_t>(dirLength));
+            entry.mount = static_cast<uint8_t>(index);
+            _resolveCache.push_back(entry);
+        }
+    }
+
+    const Mount& mount = _mounts[index];
+    rest = (mount.prefix == "/") ? path : path + mount.prefix.size();
+    if (rest[0] == '\0') {
+        rest = "/";
+    }
+    return &mount;
+}
+
+FS* VFS::root() const
+{
+    return mountedAt("/");
+}
@@ -0,0 +1,117 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Containers.h"
+#include "MFS.h"
+
+namespace m8r {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: VFS
+//
+//  Puts several filesystems into one tree by mounting each at a path
+//  prefix, like "/" for flash and "/tmp" for a RamFS. A path goes to the
+//  filesystem with the longest prefix that matches whole components, with
+//  the prefix taken off. "/tmp/a" is "/a" on the "/tmp" filesystem.
+//
+//  The directories of recently used paths are cached with the filesystem
+//  they resolved to. FS calls that aren't about a path (totalSize(),
+//  flashStats(), ...) go to the filesystem mounted at "/".
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class VFS : public FS {
+public:
+    static constexpr uint8_t ResolveCacheSize = 4;
+
+    VFS() { }
+    virtual ~VFS() { }
+
+    // The filesystem isn't owned. mount() and unmount() apply to every
+    // filesystem in the table
+    bool addMount(const char* prefix, FS*);
+    bool removeMount(const char* prefix);
+    FS* mountedAt(const char* prefix) const;
+
+    virtual bool mount() override;
+    virtual bool mounted() const override;
+    virtual void unmount() override;
+    virtual bool format() override;
+
+    virtual Mad<File> open(const char* name, FileOpenMode) override;
+    virtual void release(Mad<File>) override;
+    virtual Mad<Directory> openDirectory(const char* name) override;
+    virtual bool makeDirectory(const char* name) override;
+    virtual bool remove(const char* name) override;
+    virtual bool rename(const char* src, const char* dst) override;
+    virtual bool exists(const char* name) const override;
+    virtual bool stat(const char* name, Info&) const override;
+    virtual bool map(const char* name, Mapping&) const override;
+
+    virtual uint32_t totalSize() const override;
+    virtual uint32_t totalUsed() const override;
+
+    virtual FlashStats flashStats() const override;
+    virtual uint32_t eraseCount(uint32_t block) const override;
+    virtual void resetFlashStats() override;
+    
+    // Watches are added to the filesystems the path is on, and report
+    // paths in this tree. A prefix watch also covers filesystems mounted
+    // below the path
+    virtual int16_t watch(const char* path, bool prefix, WatchFunction) override;
+    virtual void unwatch(int16_t id) override;
+
+private:
+    struct Mount
+    {
+        String prefix;
+        FS* fs = nullptr;
+    };
+
+    struct CacheEntry
+    {
+        String directory;
+        uint8_t mount = 0;
+    };
+    
+    struct OpenFile
+    {
+        File* file = nullptr;
+        FS* fs = nullptr;
+    };
+    
+    struct MountWatch
+    {
+        int16_t id = -1;
+        FS* fs = nullptr;
+        int16_t fsId = -1;
+    };
+
+    // Returns the filesystem for the path, with rest set to the path within
+    // it. Returns null if nothing is mounted there
+    FS* resolve(const char* path, const char*& rest) const;
+    const Mount* resolveMount(const char* path, const char*& rest) const;
+    FS* root() const;
+    
+    void addWatch(int16_t id, const Mount&, const char* path, bool prefix, const WatchFunction&);
+
+    Vector<Mount> _mounts;
+    mutable Vector<CacheEntry> _resolveCache;
+
+    // Which filesystem each open file came from, so release() can give it back
+    Vector<OpenFile> _openFiles;
+    
+    Vector<MountWatch> _mountWatches;
+    int16_t _nextMountWatchId = 0;
+};
+
+}
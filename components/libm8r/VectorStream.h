@@ -44,6 +44,46 @@ public:
         return c;
     }
     
+    virtual int32_t read(uint8_t* buf, uint32_t size) const override
+    {
+        uint32_t available = _vector.size() - _index;
+        if (size > available) {
+            size = available;
+        }
+        if (size) {
+            memcpy(buf, &_vector[_index], size);
+        }
+        _index += size;
+        return size;
+    }
+    virtual int32_t write(const uint8_t* buf, uint32_t size) override
+    {
+        if (_index != _vector.size()) {
+            return -1;
+        }
+        _vector.insert(_vector.end(), buf, buf + size);
+        _index += size;
+        return size;
+    }
+    virtual int peek() const override
+    {
+        return (_index < _vector.size()) ? _vector[_index] : -1;
+    }
+    virtual const uint8_t* span(uint32_t& size) const override
+    {
+        size = _vector.size() - _index;
+        return size ? &_vector[_index] : nullptr;
+    }
+    virtual uint32_t skip(uint32_t size) const override
+    {
+        uint32_t available = _vector.size() - _index;
+        if (size > available) {
+            size = available;
+        }
+        _index += size;
+        return size;
+    }
+    
     void swap(Vector<uint8_t>& vector) { std::swap(vector, _vector); }
 	
 private:
@@ -0,0 +1,1809 @@
+// Generated by --build-romfs. Do not edit
+
+#include "RomFS.h"
+
+// /favicon.ico
+static const char _asset0[] = {
+    '\x00', '\x00', '\x01', '\x00', '\x03', '\x00', '\x10', '\x10', '\x00', '\x00', '\x01', '\x00', '\x20', '\x00', '\x68', '\x04',
+    '\x00', '\x00', '\x36', '\x00', '\x00', '\x00', '\x20', '\x20', '\x00', '\x00', '\x01', '\x00', '\x20', '\x00', '\x28', '\x11',
+    '\x00', '\x00', '\x9e', '\x04', '\x00', '\x00', '\x30', '\x30', '\x00', '\x00', '\x01', '\x00', '\x20', '\x00', '\x68', '\x26',
+    '\x00', '\x00', '\xc6', '\x15', '\x00', '\x00', '\x28', '\x00', '\x00', '\x00', '\x10', '\x00', '\x00', '\x00', '\x20', '\x00',
+    '\x00', '\x00', '\x01', '\x00', '\x20', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x87',
+    '\x00', '\x31', '\xff', '\x87', '\x00', '\x97', '\xff', '\x88', '\x00', '\xd9', '\xff', '\x88', '\x00', '\xf9', '\xff', '\x88',
+    '\x00', '\xf9', '\xff', '\x88', '\x00', '\xd9', '\xff', '\x87', '\x00', '\x97', '\xff', '\x87', '\x00', '\x31', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x8e', '\x00', '\x09', '\xff', '\x88', '\x00', '\x9a', '\xff', '\x88',
+    '\x00', '\xfe', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x88',
+    '\x00', '\x9a', '\xff', '\x8e', '\x00', '\x09', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x8e', '\x00', '\x09', '\xff', '\x87', '\x00', '\xc2', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x87', '\x00', '\xc2', '\xff', '\x8e', '\x00', '\x09', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x88', '\x00', '\x9a', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\x9a', '\x00', '\x00', '\x00', '\x00', '\xff', '\x87',
+    '\x00', '\x31', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x8a', '\x04', '\xff', '\xff', '\xc0', '\x7a', '\xff', '\xff', '\xe2',
+    '\xc1', '\xff', '\xff', '\xd1', '\x9d', '\xff', '\xff', '\x94', '\x19', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xa0', '\x34', '\xff', '\xff', '\xe0', '\xbe', '\xff', '\xff', '\xeb', '\xd5', '\xff', '\xff', '\xbf',
+    '\x77', '\xff', '\xff', '\x89', '\x01', '\xff', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x87', '\x00', '\x31', '\xff', '\x87',
+    '\x00', '\x97', '\xff', '\x88', '\x00', '\xff', '\xff', '\xce', '\x97', '\xff', '\xff', '\xf5', '\xea', '\xff', '\xff', '\xc2',
+    '\x7d', '\xff', '\xff', '\xd3', '\xa1', '\xff', '\xff', '\xee', '\xda', '\xff', '\xff', '\x8f', '\x10', '\xff', '\xff', '\xa2',
+    '\x38', '\xff', '\xff', '\xfa', '\xf4', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf4', '\xe8', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xc4', '\x81', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x87', '\x00', '\x97', '\xff', '\x88',
+    '\x00', '\xd9', '\xff', '\x95', '\x1d', '\xff', '\xff', '\xfe', '\xfd', '\xff', '\xff', '\xa7', '\x42', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xc4', '\x80', '\xff', '\xff', '\xd4', '\xa3', '\xff', '\xff', '\xf2',
+    '\xe3', '\xff', '\xff', '\xfd', '\xfb', '\xff', '\xff', '\xb1', '\x59', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xc7',
+    '\x88', '\xff', '\xff', '\xfc', '\xf8', '\xff', '\xff', '\x90', '\x12', '\xff', '\xff', '\x88', '\x00', '\xd9', '\xff', '\x88',
+    '\x00', '\xf9', '\xff', '\xab', '\x4c', '\xff', '\xff', '\xfd', '\xfc', '\xff', '\xff', '\x89', '\x02', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89', '\x03', '\xff', '\xff', '\xf4', '\xe7', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xbb', '\x6d', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x90',
+    '\x11', '\xff', '\xff', '\xfe', '\xfe', '\xff', '\xff', '\xaa', '\x49', '\xff', '\xff', '\x88', '\x00', '\xf9', '\xff', '\x88',
+    '\x00', '\xf9', '\xff', '\xa8', '\x45', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\x91', '\x15', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xb8', '\x68', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf5',
+    '\xea', '\xff', '\xff', '\x8a', '\x05', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x01', '\xff', '\xff', '\xfc', '\xf9', '\xff', '\xff', '\xad', '\x50', '\xff', '\xff', '\x88', '\x00', '\xf9', '\xff', '\x88',
+    '\x00', '\xd9', '\xff', '\x8f', '\x0f', '\xff', '\xff', '\xfb', '\xf6', '\xff', '\xff', '\xcb', '\x8f', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xaa', '\x4a', '\xff', '\xff', '\xfc', '\xf9', '\xff', '\xff', '\xf2', '\xe3', '\xff', '\xff', '\xd2',
+    '\x9f', '\xff', '\xff', '\xc6', '\x86', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xa6',
+    '\x40', '\xff', '\xff', '\xfe', '\xfe', '\xff', '\xff', '\x96', '\x20', '\xff', '\xff', '\x88', '\x00', '\xd9', '\xff', '\x87',
+    '\x00', '\x97', '\xff', '\x88', '\x00', '\xff', '\xff', '\xc1', '\x7b', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf5',
+    '\xea', '\xff', '\xff', '\xfe', '\xfe', '\xff', '\xff', '\xfa', '\xf4', '\xff', '\xff', '\xa2', '\x37', '\xff', '\xff', '\x8f',
+    '\x0e', '\xff', '\xff', '\xed', '\xd8', '\xff', '\xff', '\xd5', '\xa5', '\xff', '\xff', '\xc3', '\x7e', '\xff', '\xff', '\xf5',
+    '\xe9', '\xff', '\xff', '\xd0', '\x9a', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x87', '\x00', '\x97', '\xff', '\x87',
+    '\x00', '\x31', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x88', '\x01', '\xff', '\xff', '\xbd', '\x72', '\xff', '\xff', '\xe9',
+    '\xd1', '\xff', '\xff', '\xdf', '\xbc', '\xff', '\xff', '\x9f', '\x32', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x93', '\x17', '\xff', '\xff', '\xcf', '\x99', '\xff', '\xff', '\xe1', '\xbf', '\xff', '\xff', '\xc1',
+    '\x7a', '\xff', '\xff', '\x8a', '\x04', '\xff', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x87', '\x00', '\x31', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x88', '\x00', '\x9a', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\x9a', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x8e', '\x00', '\x09', '\xff', '\x87', '\x00', '\xc2', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x87', '\x00', '\xc2', '\xff', '\x8e', '\x00', '\x09', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x8e', '\x00', '\x09', '\xff', '\x88', '\x00', '\x9a', '\xff', '\x88',
+    '\x00', '\xfe', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x88',
+    '\x00', '\x9a', '\xff', '\x8e', '\x00', '\x09', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x87',
+    '\x00', '\x31', '\xff', '\x87', '\x00', '\x97', '\xff', '\x88', '\x00', '\xd9', '\xff', '\x88', '\x00', '\xf9', '\xff', '\x88',
+    '\x00', '\xf9', '\xff', '\x88', '\x00', '\xd9', '\xff', '\x87', '\x00', '\x97', '\xff', '\x87', '\x00', '\x31', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x28', '\x00',
+    '\x00', '\x00', '\x20', '\x00', '\x00', '\x00', '\x40', '\x00', '\x00', '\x00', '\x01', '\x00', '\x20', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x88',
+    '\x00', '\x0f', '\xff', '\x87', '\x00', '\x59', '\xff', '\x89', '\x00', '\x9b', '\xff', '\x88', '\x00', '\xcc', '\xff', '\x88',
+    '\x00', '\xec', '\xff', '\x88', '\x00', '\xfc', '\xff', '\x88', '\x00', '\xfc', '\xff', '\x88', '\x00', '\xec', '\xff', '\x88',
+    '\x00', '\xcc', '\xff', '\x89', '\x00', '\x9b', '\xff', '\x87', '\x00', '\x59', '\xff', '\x88', '\x00', '\x0f', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x86', '\x00', '\x26', '\xff', '\x88', '\x00', '\x9d', '\xff', '\x88',
+    '\x00', '\xf6', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xf6', '\xff', '\x88',
+    '\x00', '\x9d', '\xff', '\x86', '\x00', '\x26', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x8e',
+    '\x00', '\x09', '\xff', '\x89', '\x00', '\x8c', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x89', '\x00', '\x8c', '\xff', '\x8e', '\x00', '\x09', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x83', '\x00', '\x25', '\xff', '\x88',
+    '\x00', '\xd4', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xd4', '\xff', '\x83',
+    '\x00', '\x25', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x85', '\x00', '\x32', '\xff', '\x88', '\x00', '\xeb', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xeb', '\xff', '\x85', '\x00', '\x32', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x83', '\x00', '\x25', '\xff', '\x88', '\x00', '\xeb', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xeb', '\xff', '\x83', '\x00', '\x25', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x8e',
+    '\x00', '\x09', '\xff', '\x88', '\x00', '\xd4', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xd4', '\xff', '\x8e', '\x00', '\x09', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x89',
+    '\x00', '\x8c', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89', '\x00', '\x8c', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x86', '\x00', '\x26', '\xff', '\x88',
+    '\x00', '\xfa', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xa1', '\x37', '\xff', '\xff', '\xc1', '\x7b', '\xff', '\xff', '\xc9', '\x8c', '\xff', '\xff', '\xba',
+    '\x6b', '\xff', '\xff', '\x92', '\x16', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x01', '\xff', '\xff', '\xae', '\x53', '\xff', '\xff', '\xd6', '\xa8', '\xff', '\xff', '\xdf',
+    '\xbc', '\xff', '\xff', '\xcf', '\x99', '\xff', '\xff', '\xa5', '\x3e', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x86',
+    '\x00', '\x26', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x88', '\x00', '\x9d', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8f', '\x10', '\xff', '\xff', '\xda',
+    '\xb1', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xfa', '\xf4', '\xff', '\xff', '\xb7', '\x65', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x91',
+    '\x13', '\xff', '\xff', '\xdf', '\xbb', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xd2', '\x9f', '\xff', '\xff', '\x8b',
+    '\x06', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\x9d', '\x00', '\x00', '\x00', '\x00', '\xff', '\x88', '\x00', '\x0f', '\xff', '\x88', '\x00', '\xf6', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8c', '\x09', '\xff', '\xff', '\xe6', '\xca', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfd', '\xfc', '\xff', '\xff', '\xf0', '\xe0', '\xff', '\xff', '\xfb',
+    '\xf6', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xbd', '\x72', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x92', '\x15', '\xff', '\xff', '\xeb',
+    '\xd4', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xd6',
+    '\xa7', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xf6', '\xff', '\x88', '\x00', '\x0f', '\xff', '\x87', '\x00', '\x59', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xc9', '\x8b', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xd7', '\xab', '\xff', '\xff', '\x93', '\x17', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8d',
+    '\x0b', '\xff', '\xff', '\xc5', '\x84', '\xff', '\xff', '\xfe', '\xfd', '\xff', '\xff', '\xfe', '\xfc', '\xff', '\xff', '\xa6',
+    '\x41', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8b', '\x06', '\xff', '\xff', '\xe4', '\xc6', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe', '\xff', '\xff', '\xe6',
+    '\xca', '\xff', '\xff', '\xee', '\xda', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xb4', '\x5f', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x87', '\x00', '\x59', '\xff', '\x89', '\x00', '\x9b', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x91', '\x14', '\xff', '\xff', '\xfb', '\xf7', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xe3',
+    '\xc3', '\xff', '\xff', '\x89', '\x03', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xb8', '\x68', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xef',
+    '\xdc', '\xff', '\xff', '\x8b', '\x07', '\xff', '\xff', '\xcb', '\x8f', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf7', '\xed', '\xff', '\xff', '\xa8', '\x46', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x01', '\xff', '\xff', '\xbe', '\x75', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xf2', '\xe2', '\xff', '\xff', '\x8a', '\x04', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x89', '\x00', '\x9b', '\xff', '\x88', '\x00', '\xcc', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xb4', '\x5f', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xa8',
+    '\x44', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xd0', '\x9b', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xd7', '\xaa', '\xff', '\xff', '\xfe', '\xfe', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xf8', '\xef', '\xff', '\xff', '\x9f', '\x31', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xd9', '\xae', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xa8', '\x45', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xcc', '\xff', '\x88', '\x00', '\xec', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xcb', '\x8f', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe', '\xfd', '\xff', '\xff', '\x8b',
+    '\x08', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8e', '\x0e', '\xff', '\xff', '\xf3',
+    '\xe4', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfd',
+    '\xfb', '\xff', '\xff', '\xa8', '\x44', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xa4', '\x3d', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xc4', '\x82', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xec', '\xff', '\x88', '\x00', '\xfc', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xd3', '\xa2', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfa', '\xf5', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xdf',
+    '\xba', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xbe',
+    '\x76', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8b', '\x06', '\xff', '\xff', '\xfd',
+    '\xfb', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xd4', '\xa3', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xfc', '\xff', '\x88', '\x00', '\xfc', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xd0', '\x9b', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe', '\xff', '\xff', '\x8d',
+    '\x0c', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xbb', '\x6d', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xe2', '\xc1', '\xff', '\xff', '\x88',
+    '\x01', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xf7',
+    '\xed', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xd7', '\xaa', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xfc', '\xff', '\x88', '\x00', '\xec', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xc0', '\x79', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xa9',
+    '\x48', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xa3', '\x3a', '\xff', '\xff', '\xfc', '\xf9', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf5', '\xea', '\xff', '\xff', '\x90',
+    '\x12', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8a', '\x04', '\xff', '\xff', '\xfc',
+    '\xf9', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xce', '\x97', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xec', '\xff', '\x88', '\x00', '\xcc', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xa4', '\x3c', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xdf',
+    '\xba', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x97', '\x20', '\xff', '\xff', '\xf4', '\xe7', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xfe', '\xfe', '\xff', '\xff', '\xd4', '\xa4', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xd5',
+    '\xa5', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xa5', '\x3e', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xb7', '\x66', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xcc', '\xff', '\x89', '\x00', '\x9b', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x89', '\x02', '\xff', '\xff', '\xee', '\xdb', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xc5', '\x84', '\xff', '\xff', '\x89', '\x02', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x9c',
+    '\x2b', '\xff', '\xff', '\xef', '\xdd', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xcb', '\x90', '\xff', '\xff', '\x8a', '\x05', '\xff', '\xff', '\xeb', '\xd5', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xbd', '\x73', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89', '\x03', '\xff', '\xff', '\xe1', '\xbf', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xfc', '\xfa', '\xff', '\xff', '\x93', '\x19', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x89', '\x00', '\x9b', '\xff', '\x87', '\x00', '\x59', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xaf', '\x53', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf1', '\xe2', '\xff', '\xff', '\xe6', '\xca', '\xff', '\xff', '\xfd',
+    '\xfb', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xe4',
+    '\xc4', '\xff', '\xff', '\x8b', '\x06', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xa3', '\x3a', '\xff', '\xff', '\xfd',
+    '\xfb', '\xff', '\xff', '\xff', '\xfe', '\xff', '\xff', '\xc9', '\x8d', '\xff', '\xff', '\x8f', '\x0f', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x93', '\x18', '\xff', '\xff', '\xd7', '\xa9', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xcc', '\x91', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x87', '\x00', '\x59', '\xff', '\x88', '\x00', '\x0f', '\xff', '\x88', '\x00', '\xf6', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xd0', '\x9b', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xea', '\xd2', '\xff', '\xff', '\x91',
+    '\x14', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xb9',
+    '\x6a', '\xff', '\xff', '\xff', '\xfe', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfc', '\xf9', '\xff', '\xff', '\xf3',
+    '\xe5', '\xff', '\xff', '\xfe', '\xfd', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xe8',
+    '\xcd', '\xff', '\xff', '\x8d', '\x0a', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xf6', '\xff', '\x88', '\x00', '\x0f', '\x00', '\x00', '\x00', '\x00', '\xff', '\x88', '\x00', '\x9d', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89', '\x03', '\xff', '\xff', '\xcd',
+    '\x94', '\xff', '\xff', '\xfe', '\xfe', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xdd', '\xb7', '\xff', '\xff', '\x90', '\x11', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xb3', '\x5d', '\xff', '\xff', '\xf8', '\xf0', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xdb', '\xb3', '\xff', '\xff', '\x90',
+    '\x12', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\x9d', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x86', '\x00', '\x26', '\xff', '\x88',
+    '\x00', '\xfa', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xa1', '\x35', '\xff', '\xff', '\xcb', '\x91', '\xff', '\xff', '\xdd', '\xb6', '\xff', '\xff', '\xd4',
+    '\xa4', '\xff', '\xff', '\xac', '\x4f', '\xff', '\xff', '\x88', '\x01', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x90', '\x12', '\xff', '\xff', '\xb6', '\x64', '\xff', '\xff', '\xc7',
+    '\x87', '\xff', '\xff', '\xc0', '\x78', '\xff', '\xff', '\xa1', '\x35', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x86',
+    '\x00', '\x26', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x89',
+    '\x00', '\x8c', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89', '\x00', '\x8c', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x8e',
+    '\x00', '\x09', '\xff', '\x88', '\x00', '\xd4', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xd4', '\xff', '\x8e', '\x00', '\x09', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x83', '\x00', '\x25', '\xff', '\x88', '\x00', '\xeb', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xeb', '\xff', '\x83', '\x00', '\x25', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x85', '\x00', '\x32', '\xff', '\x88', '\x00', '\xeb', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xeb', '\xff', '\x85', '\x00', '\x32', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x83', '\x00', '\x25', '\xff', '\x88',
+    '\x00', '\xd4', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xd4', '\xff', '\x83',
+    '\x00', '\x25', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x8e',
+    '\x00', '\x09', '\xff', '\x89', '\x00', '\x8c', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x89', '\x00', '\x8c', '\xff', '\x8e', '\x00', '\x09', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x86', '\x00', '\x26', '\xff', '\x88', '\x00', '\x9d', '\xff', '\x88',
+    '\x00', '\xf6', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xf6', '\xff', '\x88',
+    '\x00', '\x9d', '\xff', '\x86', '\x00', '\x26', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x88',
+    '\x00', '\x0f', '\xff', '\x87', '\x00', '\x59', '\xff', '\x89', '\x00', '\x9b', '\xff', '\x88', '\x00', '\xcc', '\xff', '\x88',
+    '\x00', '\xec', '\xff', '\x88', '\x00', '\xfc', '\xff', '\x88', '\x00', '\xfc', '\xff', '\x88', '\x00', '\xec', '\xff', '\x88',
+    '\x00', '\xcc', '\xff', '\x89', '\x00', '\x9b', '\xff', '\x87', '\x00', '\x59', '\xff', '\x88', '\x00', '\x0f', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x28', '\x00', '\x00', '\x00', '\x30', '\x00', '\x00', '\x00', '\x60', '\x00',
+    '\x00', '\x00', '\x01', '\x00', '\x20', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x80', '\x00', '\x02', '\xff', '\x87',
+    '\x00', '\x11', '\xff', '\x87', '\x00', '\x22', '\xff', '\x88', '\x00', '\x49', '\xff', '\x88', '\x00', '\x85', '\xff', '\x87',
+    '\x00', '\xb5', '\xff', '\x88', '\x00', '\xd9', '\xff', '\x88', '\x00', '\xf0', '\xff', '\x89', '\x00', '\xfc', '\xff', '\x89',
+    '\x00', '\xfc', '\xff', '\x88', '\x00', '\xf0', '\xff', '\x88', '\x00', '\xd9', '\xff', '\x87', '\x00', '\xb5', '\xff', '\x88',
+    '\x00', '\x85', '\xff', '\x88', '\x00', '\x49', '\xff', '\x87', '\x00', '\x22', '\xff', '\x87', '\x00', '\x11', '\xff', '\x80',
+    '\x00', '\x02', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x80', '\x00', '\x04', '\xff', '\x85', '\x00', '\x32', '\xff', '\x87', '\x00', '\x75', '\xff', '\x87',
+    '\x00', '\xb1', '\xff', '\x88', '\x00', '\xe5', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xe5', '\xff', '\x87', '\x00', '\xb1', '\xff', '\x87',
+    '\x00', '\x75', '\xff', '\x85', '\x00', '\x32', '\xff', '\x80', '\x00', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x88',
+    '\x00', '\x1e', '\xff', '\x88', '\x00', '\x9d', '\xff', '\x88', '\x00', '\xe3', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xfa', '\xff', '\x88', '\x00', '\xe3', '\xff', '\x88', '\x00', '\x9d', '\xff', '\x88', '\x00', '\x1e', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\xff', '\x00', '\x01', '\xff', '\x86', '\x00', '\x15', '\xff', '\x87', '\x00', '\x73', '\xff', '\x88',
+    '\x00', '\xf2', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xf2', '\xff', '\x87',
+    '\x00', '\x73', '\xff', '\x86', '\x00', '\x15', '\xff', '\xff', '\x00', '\x01', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x86', '\x00', '\x3f', '\xff', '\x88', '\x00', '\xb8', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xfa', '\xff', '\x88', '\x00', '\xb8', '\xff', '\x86', '\x00', '\x3f', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x00', '\x00', '\x01', '\xff', '\x86',
+    '\x00', '\x65', '\xff', '\x88', '\x00', '\xe8', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x88', '\x00', '\xe8', '\xff', '\x86', '\x00', '\x65', '\xff', '\x00',
+    '\x00', '\x01', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x92', '\x00', '\x07', '\xff', '\x87', '\x00', '\x71', '\xff', '\x88',
+    '\x00', '\xf4', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xf4', '\xff', '\x87',
+    '\x00', '\x71', '\xff', '\x92', '\x00', '\x07', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x00', '\x00', '\x01', '\xff', '\x87', '\x00', '\x71', '\xff', '\x88', '\x00', '\xed', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xed', '\xff', '\x87', '\x00', '\x71', '\xff', '\x00', '\x00', '\x01', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x86', '\x00', '\x65', '\xff', '\x88', '\x00', '\xf4', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xf4', '\xff', '\x86', '\x00', '\x65', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\xff', '\x00', '\x01', '\xff', '\x86',
+    '\x00', '\x3f', '\xff', '\x88', '\x00', '\xe8', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xe8', '\xff', '\x86', '\x00', '\x3f', '\xff', '\xff',
+    '\x00', '\x01', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x86', '\x00', '\x15', '\xff', '\x88',
+    '\x00', '\xb8', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x88', '\x00', '\xb8', '\xff', '\x86',
+    '\x00', '\x15', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x87', '\x00', '\x73', '\xff', '\x88',
+    '\x00', '\xfa', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x87',
+    '\x00', '\x73', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x88', '\x00', '\x1e', '\xff', '\x88', '\x00', '\xf2', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8a', '\x05', '\xff', '\xff', '\x93', '\x18', '\xff', '\xff', '\x9b',
+    '\x28', '\xff', '\xff', '\xa3', '\x3c', '\xff', '\xff', '\xa5', '\x3f', '\xff', '\xff', '\x9b', '\x28', '\xff', '\xff', '\x92',
+    '\x17', '\xff', '\xff', '\x89', '\x03', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x01', '\xff', '\xff', '\x92', '\x15', '\xff', '\xff', '\xa6', '\x40', '\xff', '\xff', '\xc2',
+    '\x7d', '\xff', '\xff', '\xcc', '\x92', '\xff', '\xff', '\xc2', '\x7c', '\xff', '\xff', '\xa8', '\x45', '\xff', '\xff', '\x95',
+    '\x1c', '\xff', '\xff', '\x8a', '\x05', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xf2', '\xff', '\x88', '\x00', '\x1e', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x80', '\x00', '\x04', '\xff', '\x88', '\x00', '\x9d', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x95', '\x1d', '\xff', '\xff', '\xc2', '\x7d', '\xff', '\xff', '\xe4', '\xc6', '\xff', '\xff', '\xf9',
+    '\xf3', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfa', '\xf4', '\xff', '\xff', '\xe3',
+    '\xc3', '\xff', '\xff', '\xbf', '\x76', '\xff', '\xff', '\x92', '\x16', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8d',
+    '\x0b', '\xff', '\xff', '\xb2', '\x5b', '\xff', '\xff', '\xe1', '\xbe', '\xff', '\xff', '\xfb', '\xf7', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe', '\xff', '\xff', '\xea',
+    '\xd2', '\xff', '\xff', '\xc0', '\x78', '\xff', '\xff', '\x91', '\x13', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\x9d', '\xff', '\x80', '\x00', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x85', '\x00', '\x32', '\xff', '\x88', '\x00', '\xe3', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x9d',
+    '\x2e', '\xff', '\xff', '\xea', '\xd2', '\xff', '\xff', '\xfc', '\xf9', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xfc', '\xf9', '\xff', '\xff', '\xe2', '\xc3', '\xff', '\xff', '\x9c', '\x2a', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8d', '\x0b', '\xff', '\xff', '\xc8',
+    '\x89', '\xff', '\xff', '\xf8', '\xf1', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xfb', '\xf7', '\xff', '\xff', '\xdf', '\xba', '\xff', '\xff', '\x90', '\x10', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xe3', '\xff', '\x85', '\x00', '\x32', '\x00', '\x00', '\x00', '\x00', '\xff', '\x80',
+    '\x00', '\x02', '\xff', '\x87', '\x00', '\x75', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x01', '\xff', '\xff', '\x9f', '\x33', '\xff', '\xff', '\xf0',
+    '\xdf', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xfc', '\xf9', '\xff', '\xff', '\xfa', '\xf4', '\xff', '\xff', '\xfd', '\xfa', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xe3', '\xc4', '\xff', '\xff', '\x99',
+    '\x24', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8e', '\x0c', '\xff', '\xff', '\xca', '\x8d', '\xff', '\xff', '\xfe',
+    '\xfd', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xe1', '\xbe', '\xff', '\xff', '\x92',
+    '\x17', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x87', '\x00', '\x75', '\xff', '\x80', '\x00', '\x02', '\xff', '\x87',
+    '\x00', '\x11', '\xff', '\x87', '\x00', '\xb1', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x91', '\x14', '\xff', '\xff', '\xdc', '\xb6', '\xff', '\xff', '\xfe',
+    '\xfe', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf8', '\xf1', '\xff', '\xff', '\xd4',
+    '\xa3', '\xff', '\xff', '\xbc', '\x6f', '\xff', '\xff', '\xb4', '\x5f', '\xff', '\xff', '\xbf', '\x75', '\xff', '\xff', '\xdd',
+    '\xb6', '\xff', '\xff', '\xfc', '\xf8', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xdd',
+    '\xb6', '\xff', '\xff', '\x91', '\x13', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x8f', '\x0e', '\xff', '\xff', '\xcb', '\x90', '\xff', '\xff', '\xff', '\xfe', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfc', '\xf9', '\xff', '\xff', '\xc8',
+    '\x89', '\xff', '\xff', '\x8c', '\x09', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x87', '\x00', '\xb1', '\xff', '\x87', '\x00', '\x11', '\xff', '\x87',
+    '\x00', '\x22', '\xff', '\x88', '\x00', '\xe5', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xbc', '\x6f', '\xff', '\xff', '\xfd', '\xfa', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf2', '\xe4', '\xff', '\xff', '\xab', '\x4b', '\xff', '\xff', '\x8e',
+    '\x0c', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89', '\x01', '\xff', '\xff', '\x91',
+    '\x12', '\xff', '\xff', '\xba', '\x6c', '\xff', '\xff', '\xfd', '\xfb', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe',
+    '\xfe', '\xff', '\xff', '\xce', '\x98', '\xff', '\xff', '\x89', '\x02', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8a',
+    '\x03', '\xff', '\xff', '\xbc', '\x6f', '\xff', '\xff', '\xfa', '\xf5', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe',
+    '\xfd', '\xff', '\xff', '\xdd', '\xb6', '\xff', '\xff', '\xd0', '\x9a', '\xff', '\xff', '\xed', '\xd7', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf7',
+    '\xee', '\xff', '\xff', '\xa1', '\x37', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xe5', '\xff', '\x87', '\x00', '\x22', '\xff', '\x88',
+    '\x00', '\x49', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x8e', '\x0e', '\xff', '\xff', '\xf5', '\xea', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xfa', '\xf4', '\xff', '\xff', '\xb6', '\x64', '\xff', '\xff', '\x89', '\x02', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xb2', '\x59', '\xff', '\xff', '\xf7', '\xef', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xf6', '\xec', '\xff', '\xff', '\xab', '\x4b', '\xff', '\xff', '\x88', '\x01', '\xff', '\xff', '\xa0',
+    '\x35', '\xff', '\xff', '\xf2', '\xe5', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe', '\xfd', '\xff', '\xff', '\xeb', '\xd4', '\xff', '\xff', '\xa7',
+    '\x42', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89', '\x02', '\xff', '\xff', '\xbf',
+    '\x76', '\xff', '\xff', '\xf8', '\xf1', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xdd', '\xb5', '\xff', '\xff', '\x89', '\x03', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\x49', '\xff', '\x88',
+    '\x00', '\x85', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xb5', '\x62', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xde', '\xba', '\xff', '\xff', '\x8e', '\x0e', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8b', '\x08', '\xff', '\xff', '\xc1', '\x7a', '\xff', '\xff', '\xfb',
+    '\xf6', '\xff', '\xff', '\xff', '\xfe', '\xff', '\xff', '\xd9', '\xad', '\xff', '\xff', '\x99', '\x25', '\xff', '\xff', '\xe4',
+    '\xc6', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xe4', '\xc5', '\xff', '\xff', '\xa0', '\x33', '\xff', '\xff', '\x88',
+    '\x01', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8c',
+    '\x08', '\xff', '\xff', '\xc4', '\x82', '\xff', '\xff', '\xfb', '\xf7', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xfd', '\xfb', '\xff', '\xff', '\x9f', '\x31', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\x85', '\xff', '\x87',
+    '\x00', '\xb5', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xd9', '\xb0', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xb1', '\x59', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8f', '\x0f', '\xff', '\xff', '\xdf',
+    '\xbc', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfb', '\xf6', '\xff', '\xff', '\xe4', '\xc5', '\xff', '\xff', '\xff',
+    '\xfe', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xeb', '\xd4', '\xff', '\xff', '\x97', '\x20', '\xff', '\xff', '\x88', '\x01', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x94', '\x19', '\xff', '\xff', '\xed', '\xd8', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xc7', '\x88', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x87', '\x00', '\xb5', '\xff', '\x88',
+    '\x00', '\xd9', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8d',
+    '\x0b', '\xff', '\xff', '\xed', '\xd7', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe',
+    '\xfe', '\xff', '\xff', '\x92', '\x16', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x99',
+    '\x26', '\xff', '\xff', '\xf8', '\xee', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xee',
+    '\xdc', '\xff', '\xff', '\x9c', '\x2b', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xc2', '\x7c', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xe5', '\xc8', '\xff', '\xff', '\x89', '\x02', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xd9', '\xff', '\x88',
+    '\x00', '\xf0', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x95',
+    '\x1d', '\xff', '\xff', '\xef', '\xde', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf9',
+    '\xf3', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xc3', '\x7e', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf7', '\xee', '\xff', '\xff', '\xb1',
+    '\x5a', '\xff', '\xff', '\x89', '\x03', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x9c', '\x2d', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xee', '\xdc', '\xff', '\xff', '\x92', '\x17', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xf0', '\xff', '\x89',
+    '\x00', '\xfc', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x98',
+    '\x23', '\xff', '\xff', '\xf0', '\xe0', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf8',
+    '\xf0', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89',
+    '\x01', '\xff', '\xff', '\xdb', '\xb3', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xc6', '\x85', '\xff', '\xff', '\x8b',
+    '\x07', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89', '\x03', '\xff', '\xff', '\xfa', '\xf5', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf1', '\xe1', '\xff', '\xff', '\x9a', '\x27', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89', '\x00', '\xfc', '\xff', '\x89',
+    '\x00', '\xfc', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x96',
+    '\x1f', '\xff', '\xff', '\xf0', '\xdf', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe',
+    '\xfe', '\xff', '\xff', '\x8c', '\x0a', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8a', '\x05', '\xff', '\xff', '\xc1',
+    '\x79', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xe0', '\xbd', '\xff', '\xff', '\x89', '\x03', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xf1', '\xe2', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf2', '\xe3', '\xff', '\xff', '\x9c', '\x2b', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89', '\x00', '\xfc', '\xff', '\x88',
+    '\x00', '\xf0', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8f',
+    '\x0e', '\xff', '\xff', '\xed', '\xd9', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xa4', '\x3c', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89', '\x02', '\xff', '\xff', '\xad', '\x50', '\xff', '\xff', '\xf6',
+    '\xeb', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xca', '\x8d', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xf4', '\xe7', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf1', '\xe0', '\xff', '\xff', '\x99', '\x25', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xf0', '\xff', '\x88',
+    '\x00', '\xd9', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x01', '\xff', '\xff', '\xdf', '\xbb', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xca', '\x8e', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x97', '\x21', '\xff', '\xff', '\xea', '\xd2', '\xff', '\xff', '\xff',
+    '\xfe', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfa', '\xf4', '\xff', '\xff', '\x9f', '\x33', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8d', '\x0c', '\xff', '\xff', '\xfe', '\xfb', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xee', '\xda', '\xff', '\xff', '\x90', '\x12', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xd9', '\xff', '\x87',
+    '\x00', '\xb5', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\xc0', '\x78', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xf0', '\xdf', '\xff', '\xff', '\x99', '\x23', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x90', '\x12', '\xff', '\xff', '\xe0', '\xbc', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe', '\xff', '\xff', '\xe3',
+    '\xc3', '\xff', '\xff', '\xf9', '\xf2', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xe4', '\xc6', '\xff', '\xff', '\x91',
+    '\x14', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\xad', '\x4e', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xdf', '\xbb', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x87', '\x00', '\xb5', '\xff', '\x88',
+    '\x00', '\x85', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x99', '\x25', '\xff', '\xff', '\xfb', '\xf7', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xfc', '\xfa', '\xff', '\xff', '\xcb', '\x90', '\xff', '\xff', '\x8d', '\x0b', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x96',
+    '\x1e', '\xff', '\xff', '\xd7', '\xa9', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xe5', '\xc8', '\xff', '\xff', '\x99',
+    '\x24', '\xff', '\xff', '\xd4', '\xa3', '\xff', '\xff', '\xfe', '\xfe', '\xff', '\xff', '\xfb', '\xf7', '\xff', '\xff', '\xc6',
+    '\x85', '\xff', '\xff', '\x8c', '\x09', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x8d', '\x0c', '\xff', '\xff', '\xdc', '\xb3', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xbb', '\x6d', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\x85', '\xff', '\x88',
+    '\x00', '\x49', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x01', '\xff', '\xff', '\xd5', '\xa5', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfa', '\xf4', '\xff', '\xff', '\xc9', '\x8a', '\xff', '\xff', '\x8b',
+    '\x06', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x98', '\x21', '\xff', '\xff', '\xdc',
+    '\xb5', '\xff', '\xff', '\xfd', '\xfb', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf2', '\xe5', '\xff', '\xff', '\xa1', '\x36', '\xff', '\xff', '\x88',
+    '\x01', '\xff', '\xff', '\xa6', '\x41', '\xff', '\xff', '\xf5', '\xe9', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf9',
+    '\xf2', '\xff', '\xff', '\xb8', '\x68', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89',
+    '\x02', '\xff', '\xff', '\xb4', '\x60', '\xff', '\xff', '\xf9', '\xf2', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xf8', '\xf0', '\xff', '\xff', '\x91', '\x13', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\x49', '\xff', '\x87',
+    '\x00', '\x22', '\xff', '\x88', '\x00', '\xe5', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x9d', '\x2d', '\xff', '\xff', '\xf4', '\xe7', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf2',
+    '\xe3', '\xff', '\xff', '\xd5', '\xa5', '\xff', '\xff', '\xd9', '\xaf', '\xff', '\xff', '\xfa', '\xf5', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xfa', '\xf4', '\xff', '\xff', '\xbb', '\x6e', '\xff', '\xff', '\x89', '\x03', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x01', '\xff', '\xff', '\xc9', '\x8c', '\xff', '\xff', '\xfe', '\xfd', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xfe', '\xfe', '\xff', '\xff', '\xc0', '\x7a', '\xff', '\xff', '\x92', '\x16', '\xff', '\xff', '\x89',
+    '\x02', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x01', '\xff', '\xff', '\x8e', '\x0d', '\xff', '\xff', '\xaa',
+    '\x4a', '\xff', '\xff', '\xf2', '\xe3', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfd',
+    '\xfb', '\xff', '\xff', '\xc0', '\x78', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xe5', '\xff', '\x87', '\x00', '\x22', '\xff', '\x87',
+    '\x00', '\x11', '\xff', '\x87', '\x00', '\xb1', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8b', '\x07', '\xff', '\xff', '\xc2', '\x7d', '\xff', '\xff', '\xfb',
+    '\xf7', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe',
+    '\xfd', '\xff', '\xff', '\xc9', '\x8c', '\xff', '\xff', '\x8e', '\x0e', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8f', '\x0e', '\xff', '\xff', '\xd9', '\xad', '\xff', '\xff', '\xfe',
+    '\xfe', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfc', '\xfa', '\xff', '\xff', '\xe1', '\xbe', '\xff', '\xff', '\xc2',
+    '\x7c', '\xff', '\xff', '\xb7', '\x65', '\xff', '\xff', '\xbe', '\x73', '\xff', '\xff', '\xd5', '\xa5', '\xff', '\xff', '\xf8',
+    '\xf1', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe', '\xfe', '\xff', '\xff', '\xdf',
+    '\xbb', '\xff', '\xff', '\x93', '\x17', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x87', '\x00', '\xb1', '\xff', '\x87', '\x00', '\x11', '\xff', '\x80',
+    '\x00', '\x02', '\xff', '\x87', '\x00', '\x75', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x90', '\x11', '\xff', '\xff', '\xda',
+    '\xb0', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe', '\xfc', '\xff', '\xff', '\xc7',
+    '\x88', '\xff', '\xff', '\x8d', '\x0b', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x97', '\x1f', '\xff', '\xff', '\xe0',
+    '\xbc', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe',
+    '\xfc', '\xff', '\xff', '\xfb', '\xf6', '\xff', '\xff', '\xfd', '\xfa', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf1', '\xe1', '\xff', '\xff', '\xa2',
+    '\x37', '\xff', '\xff', '\x88', '\x01', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x87', '\x00', '\x75', '\xff', '\x80', '\x00', '\x02', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x85', '\x00', '\x32', '\xff', '\x88', '\x00', '\xe3', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8c',
+    '\x09', '\xff', '\xff', '\xd8', '\xac', '\xff', '\xff', '\xfa', '\xf5', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xf7', '\xef', '\xff', '\xff', '\xc5', '\x84', '\xff', '\xff', '\x8c',
+    '\x0a', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x99',
+    '\x24', '\xff', '\xff', '\xdf', '\xbb', '\xff', '\xff', '\xfb', '\xf7', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+    '\xff', '\xff', '\xff', '\xfc', '\xf9', '\xff', '\xff', '\xeb', '\xd5', '\xff', '\xff', '\x9f', '\x32', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xe3', '\xff', '\x85', '\x00', '\x32', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x80', '\x00', '\x04', '\xff', '\x88', '\x00', '\x9d', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x8f', '\x0e', '\xff', '\xff', '\xbb', '\x6d', '\xff', '\xff', '\xe5', '\xc9', '\xff', '\xff', '\xfd',
+    '\xfc', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfa',
+    '\xf5', '\xff', '\xff', '\xdf', '\xba', '\xff', '\xff', '\xb0', '\x58', '\xff', '\xff', '\x8c', '\x09', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x90', '\x11', '\xff', '\xff', '\xbb', '\x6e', '\xff', '\xff', '\xdf', '\xbb', '\xff', '\xff', '\xf7',
+    '\xee', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe', '\xff', '\xff', '\xf8', '\xf0', '\xff', '\xff', '\xe3',
+    '\xc4', '\xff', '\xff', '\xc2', '\x7d', '\xff', '\xff', '\x96', '\x1e', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\x9d', '\xff', '\x80', '\x00', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x88', '\x00', '\x1e', '\xff', '\x88', '\x00', '\xf2', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x8a', '\x04', '\xff', '\xff', '\x93', '\x19', '\xff', '\xff', '\xa3',
+    '\x3b', '\xff', '\xff', '\xbd', '\x72', '\xff', '\xff', '\xc8', '\x89', '\xff', '\xff', '\xbf', '\x76', '\xff', '\xff', '\xa4',
+    '\x3c', '\xff', '\xff', '\x91', '\x14', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x89', '\x02', '\xff', '\xff', '\x91', '\x14', '\xff', '\xff', '\x99',
+    '\x25', '\xff', '\xff', '\xa1', '\x36', '\xff', '\xff', '\xa1', '\x35', '\xff', '\xff', '\x9a', '\x27', '\xff', '\xff', '\x93',
+    '\x17', '\xff', '\xff', '\x8a', '\x05', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xf2', '\xff', '\x88', '\x00', '\x1e', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x87', '\x00', '\x73', '\xff', '\x88',
+    '\x00', '\xfa', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x87',
+    '\x00', '\x73', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x86', '\x00', '\x15', '\xff', '\x88',
+    '\x00', '\xb8', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x88', '\x00', '\xb8', '\xff', '\x86',
+    '\x00', '\x15', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\xff', '\x00', '\x01', '\xff', '\x86',
+    '\x00', '\x3f', '\xff', '\x88', '\x00', '\xe8', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xe8', '\xff', '\x86', '\x00', '\x3f', '\xff', '\xff',
+    '\x00', '\x01', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x86', '\x00', '\x65', '\xff', '\x88', '\x00', '\xf4', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xf4', '\xff', '\x86', '\x00', '\x65', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x00', '\x00', '\x01', '\xff', '\x87', '\x00', '\x71', '\xff', '\x88', '\x00', '\xed', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xed', '\xff', '\x87', '\x00', '\x71', '\xff', '\x00', '\x00', '\x01', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x92', '\x00', '\x07', '\xff', '\x87', '\x00', '\x71', '\xff', '\x88',
+    '\x00', '\xf4', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xf4', '\xff', '\x87',
+    '\x00', '\x71', '\xff', '\x92', '\x00', '\x07', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x00', '\x00', '\x01', '\xff', '\x86',
+    '\x00', '\x65', '\xff', '\x88', '\x00', '\xe8', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xfe', '\xff', '\x88', '\x00', '\xe8', '\xff', '\x86', '\x00', '\x65', '\xff', '\x00',
+    '\x00', '\x01', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x86', '\x00', '\x3f', '\xff', '\x88', '\x00', '\xb8', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xfa', '\xff', '\x88', '\x00', '\xb8', '\xff', '\x86', '\x00', '\x3f', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\xff', '\x00', '\x01', '\xff', '\x86', '\x00', '\x15', '\xff', '\x87', '\x00', '\x73', '\xff', '\x88',
+    '\x00', '\xf2', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xf2', '\xff', '\x87',
+    '\x00', '\x73', '\xff', '\x86', '\x00', '\x15', '\xff', '\xff', '\x00', '\x01', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x88',
+    '\x00', '\x1e', '\xff', '\x88', '\x00', '\x9d', '\xff', '\x88', '\x00', '\xe3', '\xff', '\x88', '\x00', '\xfa', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xfa', '\xff', '\x88', '\x00', '\xe3', '\xff', '\x88', '\x00', '\x9d', '\xff', '\x88', '\x00', '\x1e', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\xff', '\x80', '\x00', '\x04', '\xff', '\x85', '\x00', '\x32', '\xff', '\x87', '\x00', '\x75', '\xff', '\x87',
+    '\x00', '\xb1', '\xff', '\x88', '\x00', '\xe5', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88',
+    '\x00', '\xff', '\xff', '\x88', '\x00', '\xff', '\xff', '\x88', '\x00', '\xe5', '\xff', '\x87', '\x00', '\xb1', '\xff', '\x87',
+    '\x00', '\x75', '\xff', '\x85', '\x00', '\x32', '\xff', '\x80', '\x00', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xff', '\x80', '\x00', '\x02', '\xff', '\x87',
+    '\x00', '\x11', '\xff', '\x87', '\x00', '\x22', '\xff', '\x88', '\x00', '\x49', '\xff', '\x88', '\x00', '\x85', '\xff', '\x87',
+    '\x00', '\xb5', '\xff', '\x88', '\x00', '\xd9', '\xff', '\x88', '\x00', '\xf0', '\xff', '\x89', '\x00', '\xfc', '\xff', '\x89',
+    '\x00', '\xfc', '\xff', '\x88', '\x00', '\xf0', '\xff', '\x88', '\x00', '\xd9', '\xff', '\x87', '\x00', '\xb5', '\xff', '\x88',
+    '\x00', '\x85', '\xff', '\x88', '\x00', '\x49', '\xff', '\x87', '\x00', '\x22', '\xff', '\x87', '\x00', '\x11', '\xff', '\x80',
+    '\x00', '\x02', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+};
+
+static const char _asset0Gzip[] = {
+    '\x1f', '\x8b', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\xed', '\x5a', '\x7b', '\x70', '\x56', '\xc5',
+    '\x15', '\xdf', '\x10', '\x5a', '\x1f', '\xb5', '\x25', '\x58', '\x29', '\x75', '\xa6', '\xc5', '\xb4', '\x56', '\xca', '\xb4',
+    '\x63', '\x07', '\xb5', '\x6a', '\xa7', '\xb5', '\xc5', '\x76', '\x6a', '\xa7', '\x54', '\xa7', '\xed', '\x8c', '\xff', '\x94',
+    '\x76', '\x3a', '\x75', '\x3a', '\xb5', '\xe3', '\xf4', '\x39', '\x2d', '\x13', '\x5b', '\xfb', '\x1a', '\xfb', '\x40', '\x12',
+    '\x08', '\xaf', '\xa8', '\xbc', '\x53', '\xe4', '\xa5', '\x08', '\xa2', '\x44', '\x0d', '\x50', '\xc0', '\x20', '\x1a', '\x53',
+    '\x83', '\x68', '\x7d', '\xc4', '\x47', '\x30', '\x48', '\x20', '\xa4', '\x45', '\x43', '\x9e', '\x84', '\x00', '\xf1', '\xe3',
+    '\x3b', '\x3d', '\xbf', '\x7b', '\xee', '\x7e', '\xbb', '\xf7', '\xde', '\xbd', '\xdf', '\x23', '\x09', '\xe1', '\x23', '\xe3',
+    '\xce', '\xec', '\xe4', '\xcb', '\xde', '\xdd', '\x3d', '\x67', '\xf7', '\xbc', '\xcf', '\x59', '\xa5', '\x0a', '\x54', '\xa1',
+    '\x2a', '\x2a', '\x52', '\xfc', '\xb7', '\x58', '\xdd', '\x36', '\x5a', '\xa9', '\x6b', '\x94', '\x52', '\xc5', '\xc5', '\xf2',
+    '\xff', '\xa4', '\xb1', '\x4a', '\xfd', '\x93', '\xc7', '\x26', '\x4f', '\xf6', '\xbf', '\x4f', '\x54', '\xaa', '\x6e', '\x9c',
+    '\x52', '\x93', '\x78', '\x4e', '\x11', '\xe6', '\x29', '\x19', '\xcf', '\xb6', '\xd1', '\x4c', '\x75', '\x05', '\xf7', '\x45',
+    '\x54', '\xaa', '\x1a', '\xb9', '\x9f', '\xf4', '\x7b', '\xa3', '\x37', '\xc6', '\xdf', '\x62', '\xd7', '\xcd', '\x55', '\xe7',
+    '\xf1', '\xbc', '\xa5', '\xdc', '\x93', '\xdc', '\x29', '\xa6', '\x27', '\xbd', '\x39', '\x3c', '\x37', '\xb2', '\x76', '\xa6',
+    '\x7a', '\x2a', '\xcd', '\xba', '\x60', '\xc7', '\x5c', '\x6b', '\x0f', '\x1f', '\x2e', '\xe5', '\xd8', '\x97', '\xa6', '\xce',
+    '\x0b', '\xbc', '\x66', '\x8d', '\x26', '\x7a', '\xf2', '\x0f', '\x44', '\x07', '\x77', '\x11', '\xbd', '\x54', '\x49', '\x74',
+    '\xcf', '\xc5', '\x66', '\xee', '\x7d', '\x9f', '\x27', '\x6a', '\xae', '\x21', '\x6a', '\x7b', '\x95', '\x68', '\xe7', '\xef',
+    '\x88', '\xca', '\x0a', '\xe4', '\x2c', '\xe6', '\xae', '\x88', '\x5e', '\x58', '\x44', '\x74', '\xec', '\x1d', '\xa2', '\xa7',
+    '\xfe', '\x4c', '\xf4', '\xca', '\x4a', '\xa2', '\x8e', '\xbd', '\x44', '\xf3', '\x8a', '\x88', '\x56', '\x7d', '\x81', '\xa8',
+    '\xbf', '\x97', '\xbc', '\xd6', '\x7b', '\x58', '\xfe', '\xd6', '\xfe', '\x55', '\x9f', '\x43', '\xee', '\xf9', '\xde', '\x8f',
+    '\x13', '\x25', '\x4f', '\x11', '\x3d', '\xf0', '\x35', '\x03', '\xb3', '\xf6', '\x4e', '\xa2', '\x86', '\xd5', '\x44', '\x3d',
+    '\x2d', '\x44', '\xa7', '\xde', '\x25', '\xaa', '\x9a', '\x26', '\xe3', '\xff', '\x2e', '\x25', '\x4a', '\x9c', '\x20', '\x9a',
+    '\x7f', '\x21', '\xa5', '\x68', '\xb4', '\xe1', '\x26', '\x9e', '\x93', '\x60', '\xbc', '\x46', '\x99', '\xf5', '\x65', '\x85',
+    '\x0c', '\xef', '\x7f', '\x02', '\x6f', '\xfb', '\x2f', '\xcd', '\xf8', '\xfc', '\xb1', '\x0c', '\x2b', '\x49', '\xb4', '\x7e',
+    '\x2a', '\xa5', '\xe8', '\xbb', '\xee', '\x06', '\x99', '\xb7', '\x60', '\x9c', '\x99', '\xb7', '\xf5', '\x36', '\x19', '\xc3',
+    '\x99', '\x66', '\xbd', '\xcf', '\xba', '\x37', '\x3e', '\x7b', '\xe2', '\x24', '\xd1', '\xc6', '\xef', '\x52', '\x8a', '\x37',
+    '\xe6', '\x8d', '\x21', '\x7a', '\xb7', '\x8f', '\xe8', '\xb9', '\x79', '\x32', '\x67', '\xfd', '\xb7', '\x64', '\x0e', '\x70',
+    '\x7f', '\x79', '\x05', '\x51', '\xdd', '\x5d', '\x66', '\xfd', '\xfd', '\xd7', '\x0b', '\xfc', '\x85', '\xc5', '\x94', '\xe2',
+    '\x2b', '\x8c', '\xef', '\xfa', '\xa3', '\x81', '\x87', '\xef', '\xb8', '\xb3', '\x55', '\xd7', '\xf2', '\x1d', '\x7e', '\x88',
+    '\xa8', '\xfd', '\x0d', '\xa2', '\x57', '\xd7', '\x12', '\x3d', '\xfd', '\x17', '\xfe', '\xfe', '\x36', '\xd1', '\x8b', '\x4b',
+    '\xcd', '\xfd', '\x69', '\xfa', '\x01', '\xaf', '\x27', '\x7e', '\x4b', '\xf4', '\xf6', '\x4b', '\x44', '\xfb', '\x77', '\x10',
+    '\xad', '\xb8', '\xd2', '\xc0', '\xbc', '\x7b', '\x3c', '\xd1', '\x7f', '\x96', '\x10', '\x1d', '\xd8', '\xc9', '\x70', '\x98',
+    '\xc6', '\xa0', '\xb5', '\x4f', '\xbf', '\xc1', '\xf2', '\xcf', '\x50', '\xf0', '\xef', '\x60', '\xe5', '\x67', '\x28', '\xe4',
+    '\x77', '\xa0', '\x6d', '\x92', '\xaf', '\x63', '\xae', '\xcf', '\x51', '\xcf', '\xc4', '\xe2', '\x5f', '\xaa', '\xc6', '\x30',
+    '\x9e', '\xd3', '\xa8', '\x4c', '\x2d', '\xe3', '\xdf', '\x7b', '\xb8', '\x1f', '\xe1', '\x9e', '\xf0', '\xfb', '\x11', '\x6f',
+    '\x0c', '\xdf', '\x30', '\x87', '\xe7', '\x0e', '\xd5', '\x39', '\xe8', '\x2e', '\x35', '\x91', '\xf7', '\xab', '\xe4', '\xde',
+    '\x97', '\x03', '\x0f', '\xf4', '\x79', '\x6b', '\x78', '\xed', '\x80', '\xe1', '\x82', '\xee', '\x65', '\xaa', '\x9c', '\xf7',
+    '\xe9', '\x1f', '\x00', '\x0f', '\xea', '\xde', '\xef', '\xed', '\x91', '\x86', '\x2f', '\x9c', '\xb0', '\xff', '\xae', '\x2e',
+    '\xe3', '\xb5', '\x0d', '\x83', '\x80', '\x1b', '\xee', '\x0d', '\xd8', '\x33', '\x2b', '\xd8', '\x33', '\xd4', '\x95', '\x3c',
+    '\xbf', '\x6d', '\x08', '\x61', '\xeb', '\xde', '\x86', '\xbd', '\xb3', '\x38', '\xf7', '\xe9', '\x80', '\x6d', '\x70', '\x88',
+    '\xb9', '\x07', '\x5f', '\xce', '\x1b', '\x4e', '\x23', '\x6c', '\x43', '\x0b', '\x07', '\x3f', '\xf8', '\xbc', '\x46', '\xc3',
+    '\xd2', '\x19', '\x96', '\x43', '\xc6', '\xa2', '\x7c', '\xbe', '\xf2', '\x5a', '\xd1', '\xff', '\xf5', '\xe5', '\x44', '\xdb',
+    '\x7e', '\x4e', '\x54', '\xf1', '\x91', '\x0c', '\x7b', '\xb3', '\xae', '\x7f', '\xf8', '\x66', '\xa2', '\xd7', '\xd6', '\x89',
+    '\xae', '\x87', '\x6e', '\x5f', '\xfb', '\x15', '\xb7', '\x5c', '\x58', '\xb2', '\xe9', '\xcb', '\xb7', '\xf9', '\x0e', '\xfb',
+    '\xbc', '\xb7', '\x8a', '\x22', '\x0d', '\xb6', '\x67', '\xcb', '\xad', '\x6e', '\xd8', '\x0b', '\x3e', '\xcc', '\x30', '\xb7',
+    '\x93', '\xb3', '\xc1', '\xd6', '\xcd', '\x7e', '\x7f', '\x78', '\x4d', '\x65', '\x4a', '\xaf', '\xd9', '\xba', '\xa5', '\xfc',
+    '\x3c', '\xa2', '\xff', '\xee', '\x36', '\x6b', '\x61', '\xbf', '\xbb', '\x9a', '\xc5', '\x8e', '\xea', '\x06', '\x7b', '\x66',
+    '\xef', '\x55', '\xc1', '\xf6', '\xb9', '\xad', '\x81', '\xd2', '\xb6', '\xd7', '\x1e', '\x70', '\xe9', '\xa8', '\x31', '\xbe',
+    '\xbe', '\x34', '\xe3', '\xf5', '\xb3', '\xcd', '\x9a', '\xd7', '\x37', '\x88', '\x8d', '\xc4', '\xf8', '\x9c', '\x0f', '\x10',
+    '\x3d', '\xf3', '\x0f', '\xf1', '\x47', '\x92', '\x8c', '\xd3', '\xfd', '\x5f', '\x95', '\x71', '\x9c', '\xeb', '\x50', '\x5d',
+    '\x08', '\x58', '\x52', '\xce', '\x00', '\x5f', '\xc7', '\x6e', '\x8f', '\xff', '\x28', '\x6c', '\xef', '\xb4', '\x3e', '\xf7',
+    '\xef', '\xf0', '\x22', '\x3e', '\xe7', '\x71', '\x99', '\xdb', '\xf2', '\xb4', '\xf8', '\x2a', '\xe1', '\x7b', '\xd6', '\xfe',
+    '\x47', '\x67', '\x13', '\xc3', '\x3e', '\x47', '\x7c', '\x0b', '\xbb', '\x1d', '\x6f', '\x27', '\x5a', '\xf7', '\x0d', '\xc3',
+    '\x0f', '\x35', '\x25', '\xe6', '\x5b', '\xcf', '\x41', '\x6d', '\xe3', '\x35', '\x1f', '\x6a', '\x5b', '\x22', '\xff', '\x03',
+    '\x3f', '\xdd', '\xd6', '\x7d', '\x3d', '\x9e', '\xcf', '\x5e', '\x5c', '\xe6', '\xdf', '\xcf', '\x7a', '\xf1', '\x49', '\x74',
+    '\x3b', '\xd1', '\xc9', '\xfe', '\xc5', '\x15', '\xd1', '\xf9', '\x8d', '\x0f', '\x5b', '\xfb', '\xde', '\x60', '\x7f', '\xd3',
+    '\x76', '\x4c', '\xfe', '\xd7', '\x67', '\xc1', '\x1d', '\xcf', '\x3e', '\x37', '\x1e', '\xfe', '\x5c', '\xf6', '\x7d', '\x8e',
+    '\x1e', '\x0a', '\x9e', '\x1b', '\xbe', '\x60', '\x1c', '\xce', '\x6b', '\xbe', '\x6c', '\xe6', '\xd5', '\xfe', '\xcd', '\xfe',
+    '\xa6', '\x6d', '\xa8', '\xfc', '\xff', '\xca', '\x2a', '\x9f', '\xcf', '\x8f', '\x65', '\x96', '\xe1', '\xfd', '\xdb', '\x82',
+    '\xf0', '\x6b', '\x6e', '\x8f', '\x9f', '\x0b', '\x1e', '\x01', '\x7e', '\x68', '\xf0', '\x5d', '\xcd', '\xb7', '\x44', '\x00',
+    '\xbe', '\xbe', '\x57', '\xf0', '\xcf', '\x9c', '\x0b', '\xe2', '\xf7', '\x83', '\xdf', '\x6a', '\x37', '\xf8', '\xe6', '\xa5',
+    '\x05', '\xe9', '\xf1', '\x05', '\x5f', '\x68', '\x9a', '\x05', '\xe1', '\x9b', '\xfb', '\x7f', '\xf2', '\x0e', '\xb3', '\xe7',
+    '\x83', '\xdf', '\x74', '\xef', '\xb3', '\xfa', '\x8b', '\xe2', '\xc3', '\xda', '\x0d', '\xbe', '\xa9', '\xf8', '\xdd', '\xee',
+    '\x0e', '\x9e', '\xd3', '\x6b', '\x10', '\x0f', '\x04', '\xef', '\xdf', '\xf0', '\xdf', '\x9a', '\xeb', '\xcc', '\x9e', '\xb8',
+    '\xdf', '\xf0', '\x3e', '\x8b', '\x8a', '\x8d', '\xef', '\xee', '\x5d', '\x13', '\xdf', '\x53', '\xc3', '\x1a', '\xf9', '\x0d',
+    '\x3f', '\x38', '\x0e', '\x3e', '\x74', '\xa0', '\x6e', '\x5b', '\x7e', '\x1a', '\xe4', '\x3f', '\x5b', '\xfe', '\x10', '\x27',
+    '\x74', '\xbc', '\x69', '\xe6', '\x42', '\xde', '\x75', '\xec', '\xb0', '\xfc', '\xb3', '\x2c', '\x73', '\xfb', '\x82', '\xe7',
+    '\x7e', '\x6e', '\xbe', '\xc4', '\x00', '\x88', '\x7f', '\x3c', '\xbd', '\x34', '\xdd', '\xa1', '\xeb', '\x0b', '\xc5', '\xbf',
+    '\x46', '\x4b', '\xf4', '\xb3', '\x3e', '\xb9', '\x38', '\x28', '\x7f', '\x61', '\xfd', '\xf3', '\xc8', '\xcd', '\x41', '\x18',
+    '\xdd', '\x07', '\x45', '\x97', '\x68', '\xfe', '\xd1', '\xed', '\x50', '\xad', '\xd1', '\xa9', '\xa0', '\x89', '\xf7', '\x9d',
+    '\xef', '\xa3', '\x7e', '\x0e', '\x79', '\x71', '\x87', '\xe7', '\xdf', '\x7f', '\x94', '\xe9', '\xfd', '\xa0', '\x59', '\xb3',
+    '\x67', '\x41', '\x54', '\xff', '\x84', '\xf5', '\x6f', '\x80', '\x0f', '\x63', '\xda', '\x3b', '\x2f', '\x8b', '\xae', '\xb2',
+    '\xd7', '\xfc', '\xeb', '\x67', '\x02', '\xdf', '\x3b', '\x27', '\xd3', '\xfa', '\x68', '\xab', '\xc8', '\xb1', '\x6e', '\x87',
+    '\x9f', '\x67', '\x9e', '\x3e', '\x3f', '\xa2', '\x7f', '\x9d', '\xf6', '\x07', '\x77', '\xf6', '\xfc', '\x3d', '\x41', '\xdd',
+    '\xa2', '\xdb', '\xbe', '\x2d', '\x12', '\xab', '\xb9', '\xe8', '\xfc', '\xd8', '\x0f', '\x59', '\x07', '\x75', '\x45', '\xd7',
+    '\xbc', '\xf9', '\x98', '\x8b', '\x3f', '\x2b', '\x33', '\xdb', '\xdf', '\xab', '\x99', '\xc6', '\x7c', '\x67', '\xfb', '\x36',
+    '\x0b', '\x9f', '\x3d', '\xf4', '\x9d', '\xcc', '\x72', '\x06', '\x38', '\x9b', '\x7f', '\xc2', '\xf1', '\xe8', '\x4c', '\x96',
+    '\xa7', '\xdf', '\xcb', '\x1e', '\x19', '\xec', '\xef', '\x99', '\xf6', '\x3f', '\xf2', '\xc1', '\xff', '\x3a', '\xd3', '\xfe',
+    '\x67', '\x3e', '\xf8', '\xdf', '\xf9', '\x10', '\x7f', '\xe4', '\x43', '\xfc', '\x95', '\x0f', '\xf1', '\x67', '\xbe', '\xc4',
+    '\xdf', '\x23', '\xbd', '\x21', '\x4f', '\x32', '\x99', '\xfb', '\x2d', '\x43', '\x94', '\x27', '\x71', '\xd2', '\xee', '\x4e',
+    '\x35', '\x8a', '\xe9', '\x32', '\x96', '\xfb', '\x27', '\x99', '\x36', '\x53', '\xb9', '\xcf', '\xe0', '\xdf', '\xd5', '\x7e',
+    '\x2e', '\xa8', '\x8b', '\xe9', '\x96', '\xf0', '\x3a', '\x7e', '\x4b', '\x4e', '\xa8', '\xda', '\x9b', '\x83', '\xb9', '\x58',
+    '\x83', '\xb5', '\xbc', '\xc7', '\x70', '\xdf', '\x0d', '\xc3', '\x1c', '\xed', '\xe9', '\xa3', '\x99', '\xaa', '\x84', '\x7b',
+    '\x15', '\xe3', '\xd3', '\x3a', '\x00', '\x19', '\x6c', '\xf5', '\xd6', '\x62', '\x0f', '\xec', '\xc5', '\x7b', '\x0e', '\x0b',
+    '\xee', '\xa5', '\x6a', '\x82', '\x2f', '\xb7', '\x2d', '\x83', '\xd4', '\x21', '\x46', '\x97', '\xc8', '\x5e', '\xd8', '\x73',
+    '\xc2', '\x69', '\xc1', '\x99', '\x54', '\x01', '\xeb', '\x8c', '\x71', '\x7c', '\x57', '\xd3', '\x19', '\x46', '\xcf', '\x69',
+    '\xb4', '\x43', '\x3d', '\x1e', '\x0c', '\xc0', '\x62', '\x98', '\x43', '\x98', '\xab', '\x9b', '\xc2', '\x7b', '\x6f', '\x1d',
+    '\xa2', '\xfb', '\xce', '\x86', '\x1e', '\x5b', '\x01', '\x73', '\xd0', '\x78', '\x2b', '\xef', '\xde', '\x6f', '\xe5', '\xfd',
+    '\x0e', '\x67', '\xc8', '\xf3', '\x0e', '\x75', '\x4f', '\x7a', '\x30', '\x01', '\x5b', '\x0d', '\x8c', '\x0e', '\x54', '\xa1',
+    '\xce', '\x61', '\x5a', '\xfe', '\x86', '\xf7', '\xe9', '\x1d', '\x46', '\xbc', '\xc3', '\xbd', '\xd7', '\xc3', '\x81', '\x71',
+    '\xc9', '\xf9', '\xde', '\x05', '\xf7', '\xf6', '\x33', '\x88', '\xbb', '\xee', '\xed', '\x1e', '\x2e', '\x39', '\xd0', '\xc1',
+    '\xe7', '\x99', '\xde', '\x3c', '\xc0', '\xdd', '\xd0', '\x81', '\x71', '\xca', '\x52', '\xcf', '\x4c', '\xf1', '\xf9', '\x9d',
+    '\xf2', '\xac', '\x1f', '\xf6', '\x70', '\x4b', '\xa3', '\x97', '\x3c', '\xbd', '\x25', '\x7a', '\x26', '\x99', '\x87', '\xf8',
+    '\x27', '\x7d', '\xbd', '\x34', '\x2e', '\x4d', '\x2d', '\x68', '\xfa', '\x30', '\xe9', '\xc8', '\x81', '\xeb', '\x56', '\xc6',
+    '\x31', '\x8d', '\x5d', '\x8d', '\xb7', '\x4d', '\xc8', '\x47', '\x20', '\xee', '\x5f', '\x36', '\x89', '\x68', '\xf5', '\x75',
+    '\x44', '\x6b', '\xa7', '\xc8', '\xef', '\x8a', '\xf1', '\xee', '\x7c', '\x62', '\xa6', '\x7c', '\x32', '\x72', '\xab', '\xa8',
+    '\x4d', '\xa2', '\x7e', '\xbb', '\xa7', '\x82', '\xff', '\xfe', '\x49', '\x72', '\x78', '\xf7', '\x7e', '\x2c', '\x54', '\xff',
+    '\x74', '\xd8', '\xb8', '\x90', '\x9d', '\xf6', '\xfc', '\x99', '\x70', '\xac', '\x6f', '\x77', '\xd4', '\x7b', '\x01', '\x07',
+    '\xf9', '\xd4', '\x93', '\x47', '\x83', '\x79', '\x67', '\xe4', '\x43', '\x77', '\xde', '\x9e', '\x45', '\x0e', '\x5c', '\x99',
+    '\x7c', '\xed', '\xa3', '\x3f', '\x20', '\x3a', '\x50', '\x63', '\x72', '\xaa', '\x76', '\x7e', '\x16', '\x39', '\x0c', '\xc4',
+    '\xe7', '\xc8', '\x5b', '\xc7', '\xef', '\x53', '\x69', '\xfb', '\x4b', '\x7e', '\x6c', '\xd8', '\xe2', '\x9c', '\x5b', '\xf9',
+    '\x39', '\xd9', '\x33', '\x9c', '\x1b', '\xb3', '\x1b', '\xbe', '\x1d', '\xe4', '\x73', '\x2c', '\xff', '\x4c', '\x66', '\xdc',
+    '\x9f', '\x2d', '\x23', '\x3a', '\xd1', '\x9d', '\x3e', '\x0f', '\x83', '\x73', '\x21', '\x4f', '\x36', '\xbf', '\x28', '\x6e',
+    '\xaf', '\x16', '\x1d', '\x73', '\xfa', '\x3e', '\x70', '\x49', '\x94', '\xef', '\x99', '\xc6', '\x2b', '\xae', '\x22', '\xea',
+    '\xda', '\xef', '\xc6', '\x17', '\x77', '\x7f', '\xaa', '\x3f', '\x38', '\xde', '\x52', '\x4b', '\xb4', '\xe4', '\x53', '\x31',
+    '\xb9', '\xd9', '\x0b', '\x88', '\x76', '\xcf', '\x09', '\xe6', '\x7e', '\x32', '\x35', '\xd0', '\xa8', '\x62', '\x7c', '\x9c',
+    '\x1c', '\x94', '\x58', '\xfe', '\x7b', '\x55', '\xb4', '\xee', '\x70', '\x11', '\x51', '\xd3', '\xe6', '\x50', '\x1e', '\xba',
+    '\x5b', '\xf2', '\xac', '\x3b', '\x7e', '\x2d', '\x39', '\xed', '\x9d', '\x25', '\x92', '\xc3', '\xc1', '\xfb', '\x80', '\x54',
+    '\x1e', '\x69', '\x73', '\x94', '\xf6', '\xa8', '\xa9', '\x23', '\xa7', '\x47', '\x49', '\xca', '\xa9', '\xe1', '\x9e', '\x40',
+    '\x2f', '\xd4', '\x2e', '\xa2', '\x35', '\xed', '\x2a', '\x2b', '\xf6', '\x88', '\xfa', '\xef', '\xc0', '\xd1', '\xbe', '\xdf',
+    '\x9e', '\x43', '\x44', '\x1b', '\x6e', '\x94', '\x7b', '\x4c', '\xe5', '\x6b', '\x98', '\x46', '\x0b', '\x2e', '\x24', '\xda',
+    '\xf6', '\x0b', '\x93', '\x07', '\xc4', '\x79', '\x5f', '\x58', '\x6c', '\xf2', '\x93', '\xb3', '\x0a', '\x65', '\x2f', '\xe4',
+    '\xae', '\x5d', '\x0d', '\xf4', '\xc0', '\x99', '\xf1', '\x46', '\xa0', '\xfd', '\xf5', '\xe8', '\xf7', '\xe3', '\x1d', '\x52',
+    '\x6f', '\x72', '\xc7', '\x0f', '\x3a', '\x6e', '\x8a', '\xe6', '\xe1', '\x91', '\xfb', '\xb5', '\xe5', '\x14', '\xb9', '\x2f',
+    '\xfb', '\xbd', '\x45', '\xb8', '\x3f', '\x3a', '\x8d', '\x61', '\x75', '\xca', '\xfc', '\xbe', '\x23', '\x72', '\x56', '\xf0',
+    '\xe0', '\x7d', '\x57', '\xf3', '\xd9', '\x5b', '\xdd', '\x78', '\xa3', '\xb6', '\x63', '\xbf', '\x01', '\xc1', '\xfe', '\xd0',
+    '\x05', '\x61', '\xf9', '\xd8', '\x57', '\x1d', '\xa7', '\xe3', '\xa6', '\xfa', '\xf1', '\x5c', '\x70', '\xbc', '\xfa', '\xc7',
+    '\xc1', '\xf5', '\x6f', '\x6d', '\x93', '\x33', '\xa5', '\x93', '\x4d', '\xd4', '\x25', '\xf0', '\x56', '\xc2', '\xab', '\x47',
+    '\x31', '\x0d', '\x1a', '\x37', '\xb2', '\x2c', '\x5c', '\xe6', '\xa8', '\x01', '\xe9', '\x3c', '\xed', '\x33', '\x7c', '\xb6',
+    '\xab', '\xa2', '\x79', '\xc3', '\xf2', '\x73', '\xa5', '\x16', '\x61', '\xeb', '\x26', '\xd0', '\xd6', '\x55', '\x3f', '\x31',
+    '\xf1', '\x6a', '\xa8', '\xae', '\xb2', '\x29', '\x08', '\x4b', '\xbf', '\x85', '\xc9', '\xd4', '\x91', '\x1f', '\x46', '\x7d',
+    '\xd0', '\xd3', '\x21', '\x7d', '\x82', '\xa3', '\x8b', '\xe7', '\x71', '\xef', '\xc8', '\xb9', '\xc7', '\xe5', '\x3c', '\xf1',
+    '\x16', '\x08', '\x6f', '\x50', '\xec', '\x86', '\x77', '\x38', '\x51', '\x19', '\xd0', '\xb1', '\x76', '\x50', '\xc7', '\xd9',
+    '\x7c', '\x08', '\x7e', '\xce', '\x56', '\xb7', '\xa3', '\x2f', '\x99', '\xc8', '\xf4', '\xef', '\x88', '\x97', '\xc9', '\x8e',
+    '\x26', '\xc9', '\xd9', '\x67', '\xda', '\x07', '\xf6', '\xcc', '\x6e', '\xad', '\xcf', '\xba', '\xf8', '\xb7', '\xd1', '\xcf',
+    '\x0d', '\x04', '\x6d', '\x55', '\xe7', '\x5b', '\x66', '\x1d', '\xec', '\x55', '\xae', '\x76', '\x1e', '\xef', '\x76', '\x5c',
+    '\x0d', '\xb2', '\x58', '\xf5', '\xfd', '\xec', '\xec', '\xf5', '\xf2', '\xcb', '\xa3', '\xe7', '\x8e', '\xea', '\xd2', '\x2e',
+    '\x3f', '\xbf', '\x61', '\xc6', '\x16', '\x5f', '\x2a', '\x75', '\xd5', '\x94', '\xce', '\xec', '\xca', '\x31', '\x87', '\x5c',
+    '\x20', '\x79', '\x75', '\x57', '\xab', '\x9b', '\x21', '\xb5', '\xc9', '\xac', '\xf6', '\x29', '\x0c', '\xea', '\xac', '\xee',
+    '\x03', '\x44', '\x4b', '\x3f', '\x1d', '\xce', '\x57', '\x27', '\x22', '\xf8', '\x2f', '\xbc', '\x24', '\x68', '\xb3', '\xc0',
+    '\x3f', '\xe5', '\xe7', '\x67', '\x07', '\x13', '\x7e', '\xcb', '\xae', '\x3b', '\xdc', '\xb8', '\x37', '\x3f', '\x91', '\xbb',
+    '\x9f', '\x84', '\x1a', '\x4d', '\x4a', '\x7f', '\xb7', '\x44', '\xf9', '\xce', '\xe4', '\x96', '\x82', '\xb6', '\xa6', '\xbd',
+    '\x31', '\x08', '\x1b', '\xf5', '\xaf', '\x8c', '\xf7', '\x35', '\x4a', '\xde', '\x98', '\xf5', '\xb5', '\xb9', '\xf1', '\x87',
+    '\xed', '\xcd', '\x95', '\x0f', '\xed', '\x9a', '\x5a', '\x77', '\xb3', '\xe8', '\xb3', '\x30', '\xff', '\x84', '\xe5', '\x17',
+    '\x3a', '\x21', '\x5c', '\xef', '\xdf', '\x3d', '\x37', '\x33', '\xac', '\x45', '\x9f', '\x10', '\x3f', '\x29', '\xce', '\xc6',
+    '\xc2', '\x86', '\xc0', '\x1f', '\xc9', '\x16', '\x77', '\xd4', '\x49', '\x93', '\x56', '\x6d', '\x0c', '\x35', '\xf7', '\x68',
+    '\xad', '\xa7', '\xd1', '\xa9', '\x3f', '\xe1', '\xff', '\xd9', '\x0d', '\xfc', '\xb4', '\xe4', '\xd2', '\xf4', '\xb5', '\x9d',
+    '\xe6', '\x1d', '\x2e', '\xe3', '\x2a', '\xfe', '\xe9', '\xc9', '\x1e', '\x5f', '\xe7', '\xd7', '\x45', '\xeb', '\x63', '\x71',
+    '\x7d', '\xe3', '\xb7', '\x83', '\x5b', '\xe1', '\x4e', '\xdd', '\xfa', '\x33', '\x6a', '\xbf', '\x40', '\x27', '\xdb', '\x7e',
+    '\xa0', '\xbe', '\x08', '\xff', '\x05', '\xba', '\x35', '\x3c', '\x77', '\xe1', '\x84', '\x60', '\x2d', '\x30', '\xac', '\xf3',
+    '\xe0', '\xcf', '\xc1', '\x67', '\x82', '\x1c', '\x61', '\x4f', '\xc8', '\xb0', '\xcb', '\x9f', '\x09', '\xdf', '\x7d', '\x53',
+    '\x48', '\x07', '\xd8', '\x6f', '\x2a', '\x6d', '\xfb', '\xe5', '\xf2', '\x1f', '\xc0', '\x43', '\xa8', '\xdb', '\x86', '\xe9',
+    '\x5f', '\x3f', '\x2b', '\xf8', '\x5e', '\x64', '\x31', '\xf3', '\x4c', '\x53', '\x75', '\xb4', '\x06', '\xea', '\xc9', '\x1b',
+    '\xfb', '\x0c', '\x2b', '\xaf', '\x91', '\xbd', '\xf0', '\x26', '\x03', '\xef', '\x20', '\x3d', '\x7d', '\xdc', '\x23', '\x6f',
+    '\x25', '\xd2', '\xc9', '\xd1', '\xe3', '\xb7', '\x18', '\x9a', '\x69', '\x1d', '\xe8', '\x8e', '\x07', '\xa6', '\xc6', '\xfa',
+    '\x6f', '\x95', '\x97', '\x07', '\xe5', '\xc7', '\xd6', '\x03', '\x38', '\x5b', '\xe3', '\x23', '\xf1', '\x3e', '\x19', '\xce',
+    '\xba', '\xfd', '\x57', '\x96', '\xbe', '\x29', '\x90', '\xb7', '\x3e', '\xda', '\x77', '\x06', '\x2d', '\xf0', '\xf6', '\x16',
+    '\x76', '\x31', '\x65', '\x93', '\x78', '\xce', '\xdc', '\x0f', '\xca', '\x5b', '\x52', '\xc0', '\xb0', '\x7d', '\x07', '\xf0',
+    '\x73', '\x9c', '\xff', '\x16', '\xe7', '\x3f', '\x43', '\x4f', '\x23', '\xe6', '\x8a', '\xc4', '\x48', '\x19', '\x1a', '\x70',
+    '\x04', '\xae', '\x61', '\x7f', '\x09', '\x7a', '\x0d', '\x3e', '\x91', '\xf6', '\xc7', '\xc1', '\x93', '\xf0', '\xef', '\x61',
+    '\x67', '\xf1', '\x76', '\xa8', '\x66', '\xba', '\xdc', '\x8b', '\xed', '\xbb', '\x61', '\x2e', '\xf8', '\xfe', '\xee', '\xf1',
+    '\xf1', '\xfe', '\x73', '\x6c', '\xfc', '\xe2', '\xbf', '\xdd', '\xdd', '\xbb', '\x29', '\x07', '\xdc', '\x13', '\xe2', '\xa7',
+    '\xb8', '\xe4', '\xc4', '\xd3', '\x51', '\x97', '\x44', '\xe5', '\x1c', '\x6b', '\xe0', '\x2b', '\x85', '\x63', '\x21', '\x6d',
+    '\xb3', '\xf0', '\x26', '\x37', '\xea', '\x27', '\xa5', '\xe2', '\x97', '\x8c', '\xf1', '\x23', '\x64', '\xed', '\x8d', '\x87',
+    '\xe2', '\x79', '\x25', '\xe5', '\x1b', '\x74', '\xca', '\xbb', '\x84', '\x4c', '\xb6', '\x0e', '\xf2', '\x8c', '\x3b', '\x4d',
+    '\x47', '\x57', '\xc4', '\x2d', '\x78', '\xbb', '\x60', '\xbf', '\x09', '\x8e', '\x89', '\x1f', '\xb3', '\x8a', '\xdf', '\x41',
+    '\x7b', '\xc8', '\x7f', '\x6b', '\xbd', '\xbc', '\xdb', '\x0a', '\xf0', '\xfa', '\x31', '\x89', '\x55', '\x37', '\x7d', '\x2f',
+    '\xb3', '\x5e', '\xb1', '\xe9', '\x0a', '\xf9', '\xc0', '\x39', '\x8e', '\x77', '\x18', '\x5d', '\x0b', '\x39', '\x45', '\x0c',
+    '\x0a', '\xbe', '\x85', '\x5e', '\xcb', '\x32', '\x7e', '\xcf', '\x2e', '\x7f', '\x32', '\x5a', '\xde', '\x68', '\xac', '\xfe',
+    '\x92', '\xbc', '\x33', '\x43', '\x5c', '\x87', '\x58', '\x03', '\xb6', '\x39', '\x5b', '\x9d', '\x1e', '\xd6', '\x33', '\x58',
+    '\x07', '\x5d', '\x0d', '\x3d', '\x85', '\xf7', '\x00', '\xf0', '\x6f', '\xc0', '\xeb', '\x39', '\xe6', '\x4f', '\x46', '\x42',
+    '\xfe', '\x6a', '\x44', '\xe4', '\x0f', '\xcf', '\xf2', '\xfc', '\xed', '\xd9', '\x9e', '\x3f', '\x1f', '\x29', '\xf5', '\x8b',
+    '\xb3', '\xbd', '\x7e', '\x34', '\x12', '\xea', '\x77', '\x23', '\xa1', '\x7e', '\x3a', '\x52', '\xea', '\xd7', '\x67', '\xfb',
+    '\xfb', '\x81', '\x91', '\xf4', '\x7e', '\x63', '\x24', '\xbc', '\x9f', '\x79', '\xaf', '\xbd', '\xd7', '\x74', '\xfb', '\x3f',
+    '\x02', '\x7c', '\xef', '\xa3', '\x2e', '\x3c', '\x00', '\x00',
+};
+
+// /index.html
+static const char _asset1[] = {
+    '\x3c', '\x21', '\x44', '\x4f', '\x43', '\x54', '\x59', '\x50', '\x45', '\x20', '\x68', '\x74', '\x6d', '\x6c', '\x3e', '\x0a',
+    '\x3c', '\x68', '\x74', '\x6d', '\x6c', '\x3e', '\x0a', '\x0a', '\x3c', '\x68', '\x65', '\x61', '\x64', '\x3e', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x3c', '\x6d', '\x65', '\x74', '\x61', '\x20', '\x63', '\x68', '\x61', '\x72', '\x73', '\x65', '\x74',
+    '\x3d', '\x22', '\x75', '\x74', '\x66', '\x2d', '\x38', '\x22', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x74',
+    '\x69', '\x74', '\x6c', '\x65', '\x3e', '\x57', '\x65', '\x6c', '\x63', '\x6f', '\x6d', '\x65', '\x20', '\x74', '\x6f', '\x20',
+    '\x6d', '\x38', '\x72', '\x73', '\x63', '\x72', '\x69', '\x70', '\x74', '\x3c', '\x2f', '\x74', '\x69', '\x74', '\x6c', '\x65',
+    '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x6d', '\x65', '\x74', '\x61', '\x20', '\x6e', '\x61', '\x6d', '\x65',
+    '\x3d', '\x22', '\x67', '\x65', '\x6e', '\x65', '\x72', '\x61', '\x74', '\x6f', '\x72', '\x22', '\x20', '\x63', '\x6f', '\x6e',
+    '\x74', '\x65', '\x6e', '\x74', '\x3d', '\x22', '\x47', '\x6f', '\x6f', '\x67', '\x6c', '\x65', '\x20', '\x57', '\x65', '\x62',
+    '\x20', '\x44', '\x65', '\x73', '\x69', '\x67', '\x6e', '\x65', '\x72', '\x20', '\x38', '\x2e', '\x30', '\x2e', '\x33', '\x2e',
+    '\x30', '\x36', '\x30', '\x33', '\x22', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x73', '\x74', '\x79', '\x6c',
+    '\x65', '\x20', '\x74', '\x79', '\x70', '\x65', '\x3d', '\x22', '\x74', '\x65', '\x78', '\x74', '\x2f', '\x63', '\x73', '\x73',
+    '\x22', '\x20', '\x69', '\x64', '\x3d', '\x22', '\x67', '\x77', '\x64', '\x2d', '\x74', '\x65', '\x78', '\x74', '\x2d', '\x73',
+    '\x74', '\x79', '\x6c', '\x65', '\x22', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x70',
+    '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6d',
+    '\x61', '\x72', '\x67', '\x69', '\x6e', '\x3a', '\x20', '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x68', '\x31',
+    '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6d',
+    '\x61', '\x72', '\x67', '\x69', '\x6e', '\x3a', '\x20', '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x68', '\x32',
+    '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6d',
+    '\x61', '\x72', '\x67', '\x69', '\x6e', '\x3a', '\x20', '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x68', '\x33',
+    '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6d',
+    '\x61', '\x72', '\x67', '\x69', '\x6e', '\x3a', '\x20', '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x2f', '\x73', '\x74', '\x79', '\x6c',
+    '\x65', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x73', '\x74', '\x79', '\x6c', '\x65', '\x20', '\x74', '\x79',
+    '\x70', '\x65', '\x3d', '\x22', '\x74', '\x65', '\x78', '\x74', '\x2f', '\x63', '\x73', '\x73', '\x22', '\x3e', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x68', '\x74', '\x6d', '\x6c', '\x2c', '\x20', '\x62', '\x6f', '\x64',
+    '\x79', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x77', '\x69', '\x64', '\x74', '\x68', '\x3a', '\x20', '\x31', '\x30', '\x30', '\x25', '\x3b', '\x0a', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x68', '\x65', '\x69', '\x67', '\x68', '\x74', '\x3a',
+    '\x20', '\x31', '\x30', '\x30', '\x25', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x6d', '\x61', '\x72', '\x67', '\x69', '\x6e', '\x3a', '\x20', '\x30', '\x70', '\x78', '\x3b', '\x0a',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x62', '\x6f', '\x64', '\x79', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x62', '\x61', '\x63', '\x6b', '\x67', '\x72', '\x6f', '\x75', '\x6e', '\x64', '\x2d',
+    '\x63', '\x6f', '\x6c', '\x6f', '\x72', '\x3a', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x70', '\x61', '\x72', '\x65',
+    '\x6e', '\x74', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x3a', '\x20', '\x70', '\x65', '\x72', '\x73', '\x70',
+    '\x65', '\x63', '\x74', '\x69', '\x76', '\x65', '\x28', '\x31', '\x34', '\x30', '\x30', '\x70', '\x78', '\x29', '\x20', '\x6d',
+    '\x61', '\x74', '\x72', '\x69', '\x78', '\x33', '\x64', '\x28', '\x31', '\x2c', '\x20', '\x30', '\x2c', '\x20', '\x30', '\x2c',
+    '\x20', '\x30', '\x2c', '\x20', '\x30', '\x2c', '\x20', '\x31', '\x2c', '\x20', '\x30', '\x2c', '\x20', '\x30', '\x2c', '\x20',
+    '\x30', '\x2c', '\x20', '\x30', '\x2c', '\x20', '\x31', '\x2c', '\x20', '\x30', '\x2c', '\x20', '\x30', '\x2c', '\x20', '\x30',
+    '\x2c', '\x20', '\x30', '\x2c', '\x20', '\x31', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x2d', '\x73',
+    '\x74', '\x79', '\x6c', '\x65', '\x3a', '\x20', '\x70', '\x72', '\x65', '\x73', '\x65', '\x72', '\x76', '\x65', '\x2d', '\x33',
+    '\x64', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x75', '\x6c', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6c', '\x69', '\x73', '\x74', '\x2d', '\x73', '\x74', '\x79', '\x6c', '\x65',
+    '\x2d', '\x74', '\x79', '\x70', '\x65', '\x3a', '\x20', '\x6e', '\x6f', '\x6e', '\x65', '\x3b', '\x0a', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x70', '\x61', '\x64', '\x64', '\x69', '\x6e', '\x67',
+    '\x3a', '\x20', '\x31', '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x6d', '\x61', '\x72', '\x67', '\x69', '\x6e', '\x3a', '\x20', '\x30', '\x70', '\x78', '\x3b',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x6c', '\x69', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x70', '\x61', '\x64', '\x64', '\x69', '\x6e', '\x67', '\x3a', '\x20', '\x35', '\x70', '\x78',
+    '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6f', '\x76',
+    '\x65', '\x72', '\x66', '\x6c', '\x6f', '\x77', '\x3a', '\x20', '\x61', '\x75', '\x74', '\x6f', '\x3b', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x6c', '\x69', '\x3a', '\x68', '\x6f', '\x76', '\x65', '\x72', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x62', '\x61', '\x63', '\x6b', '\x67', '\x72', '\x6f', '\x75', '\x6e',
+    '\x64', '\x3a', '\x20', '\x72', '\x67', '\x62', '\x28', '\x32', '\x33', '\x38', '\x2c', '\x20', '\x32', '\x33', '\x38', '\x2c',
+    '\x20', '\x32', '\x33', '\x38', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x63', '\x75', '\x72', '\x73', '\x6f', '\x72', '\x3a', '\x20', '\x70', '\x6f', '\x69', '\x6e', '\x74',
+    '\x65', '\x72', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6c', '\x69', '\x2e', '\x73', '\x65', '\x6c', '\x65', '\x63', '\x74', '\x65',
+    '\x64', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x62', '\x61', '\x63', '\x6b', '\x67', '\x72', '\x6f', '\x75', '\x6e', '\x64', '\x3a', '\x20', '\x72', '\x67', '\x62', '\x28',
+    '\x32', '\x30', '\x30', '\x2c', '\x20', '\x32', '\x30', '\x30', '\x2c', '\x20', '\x32', '\x30', '\x30', '\x29', '\x3b', '\x0a',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x70', '\x61', '\x64', '\x64',
+    '\x69', '\x6e', '\x67', '\x3a', '\x20', '\x34', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x62', '\x6f', '\x72', '\x64', '\x65', '\x72', '\x3a', '\x20', '\x31', '\x70',
+    '\x78', '\x20', '\x73', '\x6f', '\x6c', '\x69', '\x64', '\x20', '\x62', '\x6c', '\x61', '\x63', '\x6b', '\x3b', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x63', '\x75', '\x72', '\x73', '\x6f',
+    '\x72', '\x3a', '\x20', '\x70', '\x6f', '\x69', '\x6e', '\x74', '\x65', '\x72', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2e', '\x67',
+    '\x77', '\x64', '\x2d', '\x64', '\x69', '\x76', '\x2d', '\x61', '\x34', '\x61', '\x73', '\x20', '\x7b', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x70', '\x6f', '\x73', '\x69', '\x74', '\x69',
+    '\x6f', '\x6e', '\x3a', '\x20', '\x61', '\x62', '\x73', '\x6f', '\x6c', '\x75', '\x74', '\x65', '\x3b', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x77', '\x69', '\x64', '\x74', '\x68', '\x3a',
+    '\x20', '\x31', '\x30', '\x30', '\x25', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x68', '\x65', '\x69', '\x67', '\x68', '\x74', '\x3a', '\x20', '\x31', '\x30', '\x30', '\x25', '\x3b',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6c', '\x65', '\x66',
+    '\x74', '\x3a', '\x20', '\x30', '\x25', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x74', '\x6f', '\x70', '\x3a', '\x20', '\x30', '\x25', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2e', '\x67',
+    '\x77', '\x64', '\x2d', '\x73', '\x70', '\x61', '\x6e', '\x2d', '\x6d', '\x67', '\x64', '\x70', '\x20', '\x7b', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x70', '\x6f', '\x73', '\x69', '\x74',
+    '\x69', '\x6f', '\x6e', '\x3a', '\x20', '\x61', '\x62', '\x73', '\x6f', '\x6c', '\x75', '\x74', '\x65', '\x3b', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x6f', '\x70', '\x3a', '\x20',
+    '\x37', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x6c', '\x65', '\x66', '\x74', '\x3a', '\x20', '\x35', '\x30', '\x25', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72',
+    '\x6d', '\x2d', '\x73', '\x74', '\x79', '\x6c', '\x65', '\x3a', '\x20', '\x70', '\x72', '\x65', '\x73', '\x65', '\x72', '\x76',
+    '\x65', '\x2d', '\x33', '\x64', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x66', '\x6f', '\x6e', '\x74', '\x2d', '\x73', '\x69', '\x7a', '\x65', '\x3a', '\x20', '\x33', '\x30', '\x70',
+    '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x77',
+    '\x69', '\x64', '\x74', '\x68', '\x3a', '\x20', '\x33', '\x35', '\x36', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x68', '\x65', '\x69', '\x67', '\x68', '\x74', '\x3a',
+    '\x20', '\x33', '\x36', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x2d', '\x6f', '\x72', '\x69',
+    '\x67', '\x69', '\x6e', '\x3a', '\x20', '\x31', '\x37', '\x38', '\x70', '\x78', '\x20', '\x31', '\x38', '\x70', '\x78', '\x20',
+    '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x3a', '\x20', '\x74', '\x72', '\x61', '\x6e',
+    '\x73', '\x6c', '\x61', '\x74', '\x65', '\x33', '\x64', '\x28', '\x2d', '\x31', '\x37', '\x38', '\x70', '\x78', '\x2c', '\x20',
+    '\x30', '\x70', '\x78', '\x2c', '\x20', '\x30', '\x70', '\x78', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x65', '\x78', '\x74', '\x2d', '\x61', '\x6c', '\x69', '\x67',
+    '\x6e', '\x3a', '\x20', '\x63', '\x65', '\x6e', '\x74', '\x65', '\x72', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2e', '\x67', '\x77',
+    '\x64', '\x2d', '\x64', '\x69', '\x76', '\x2d', '\x31', '\x7a', '\x32', '\x67', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x70', '\x6f', '\x73', '\x69', '\x74', '\x69', '\x6f',
+    '\x6e', '\x3a', '\x20', '\x61', '\x62', '\x73', '\x6f', '\x6c', '\x75', '\x74', '\x65', '\x3b', '\x0a', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x6f', '\x70', '\x3a', '\x20', '\x31', '\x35',
+    '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x6c', '\x65', '\x66', '\x74', '\x3a', '\x20', '\x35', '\x30', '\x25', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72',
+    '\x6d', '\x2d', '\x73', '\x74', '\x79', '\x6c', '\x65', '\x3a', '\x20', '\x70', '\x72', '\x65', '\x73', '\x65', '\x72', '\x76',
+    '\x65', '\x2d', '\x33', '\x64', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x68', '\x65', '\x69', '\x67', '\x68', '\x74', '\x3a', '\x20', '\x32', '\x31', '\x39', '\x70', '\x78', '\x3b',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x77', '\x69', '\x64',
+    '\x74', '\x68', '\x3a', '\x20', '\x33', '\x32', '\x32', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d',
+    '\x2d', '\x6f', '\x72', '\x69', '\x67', '\x69', '\x6e', '\x3a', '\x20', '\x31', '\x36', '\x31', '\x70', '\x78', '\x20', '\x31',
+    '\x30', '\x39', '\x2e', '\x35', '\x70', '\x78', '\x20', '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72',
+    '\x6d', '\x3a', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x6c', '\x61', '\x74', '\x65', '\x33', '\x64', '\x28', '\x2d',
+    '\x31', '\x36', '\x31', '\x70', '\x78', '\x2c', '\x20', '\x2d', '\x34', '\x30', '\x70', '\x78', '\x2c', '\x20', '\x30', '\x70',
+    '\x78', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2e', '\x67', '\x77', '\x64', '\x2d', '\x73', '\x70', '\x61', '\x6e', '\x2d',
+    '\x6b', '\x63', '\x63', '\x36', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x70', '\x6f', '\x73', '\x69', '\x74', '\x69', '\x6f', '\x6e', '\x3a', '\x20', '\x61', '\x62', '\x73',
+    '\x6f', '\x6c', '\x75', '\x74', '\x65', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x74', '\x6f', '\x70', '\x3a', '\x20', '\x32', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6c', '\x65', '\x66', '\x74', '\x3a', '\x20', '\x33',
+    '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2e', '\x67', '\x77', '\x64', '\x2d', '\x64', '\x69', '\x76', '\x2d', '\x6b',
+    '\x36', '\x62', '\x6e', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x70', '\x6f', '\x73', '\x69', '\x74', '\x69', '\x6f', '\x6e', '\x3a', '\x20', '\x61', '\x62', '\x73', '\x6f',
+    '\x6c', '\x75', '\x74', '\x65', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x6f', '\x76', '\x65', '\x72', '\x66', '\x6c', '\x6f', '\x77', '\x3a', '\x20', '\x73', '\x63', '\x72', '\x6f',
+    '\x6c', '\x6c', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x62', '\x6f', '\x72', '\x64', '\x65', '\x72', '\x2d', '\x73', '\x74', '\x79', '\x6c', '\x65', '\x3a', '\x20', '\x73', '\x6f',
+    '\x6c', '\x69', '\x64', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x62', '\x6f', '\x72', '\x64', '\x65', '\x72', '\x2d', '\x77', '\x69', '\x64', '\x74', '\x68', '\x3a', '\x20', '\x31',
+    '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x62', '\x6f', '\x72', '\x64', '\x65', '\x72', '\x2d', '\x72', '\x61', '\x64', '\x69', '\x75', '\x73', '\x3a', '\x20', '\x34',
+    '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x74', '\x6f', '\x70', '\x3a', '\x20', '\x32', '\x35', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6c', '\x65', '\x66', '\x74', '\x3a', '\x20', '\x35', '\x30', '\x25',
+    '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72',
+    '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x2d', '\x73', '\x74', '\x79', '\x6c', '\x65', '\x3a', '\x20', '\x70',
+    '\x72', '\x65', '\x73', '\x65', '\x72', '\x76', '\x65', '\x2d', '\x33', '\x64', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x68', '\x65', '\x69', '\x67', '\x68', '\x74', '\x3a', '\x20',
+    '\x31', '\x38', '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x77', '\x69', '\x64', '\x74', '\x68', '\x3a', '\x20', '\x32', '\x39', '\x34', '\x70', '\x78', '\x3b',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61',
+    '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x2d', '\x6f', '\x72', '\x69', '\x67', '\x69', '\x6e', '\x3a', '\x20', '\x31',
+    '\x34', '\x37', '\x2e', '\x37', '\x31', '\x32', '\x70', '\x78', '\x20', '\x39', '\x30', '\x2e', '\x30', '\x38', '\x35', '\x36',
+    '\x70', '\x78', '\x20', '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x3a', '\x20', '\x74',
+    '\x72', '\x61', '\x6e', '\x73', '\x6c', '\x61', '\x74', '\x65', '\x33', '\x64', '\x28', '\x2d', '\x31', '\x34', '\x38', '\x70',
+    '\x78', '\x2c', '\x20', '\x31', '\x31', '\x70', '\x78', '\x2c', '\x20', '\x30', '\x70', '\x78', '\x29', '\x3b', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x2e', '\x67', '\x77', '\x64', '\x2d', '\x64', '\x69', '\x76', '\x2d', '\x76', '\x36', '\x31', '\x32', '\x20', '\x7b',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x70', '\x6f', '\x73',
+    '\x69', '\x74', '\x69', '\x6f', '\x6e', '\x3a', '\x20', '\x61', '\x62', '\x73', '\x6f', '\x6c', '\x75', '\x74', '\x65', '\x3b',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x68', '\x65', '\x69',
+    '\x67', '\x68', '\x74', '\x3a', '\x20', '\x33', '\x37', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x6f', '\x70', '\x3a', '\x20', '\x36', '\x31', '\x70', '\x78',
+    '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6c', '\x65',
+    '\x66', '\x74', '\x3a', '\x20', '\x35', '\x30', '\x25', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x2d', '\x73',
+    '\x74', '\x79', '\x6c', '\x65', '\x3a', '\x20', '\x70', '\x72', '\x65', '\x73', '\x65', '\x72', '\x76', '\x65', '\x2d', '\x33',
+    '\x64', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x77',
+    '\x69', '\x64', '\x74', '\x68', '\x3a', '\x20', '\x33', '\x33', '\x32', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f',
+    '\x72', '\x6d', '\x2d', '\x6f', '\x72', '\x69', '\x67', '\x69', '\x6e', '\x3a', '\x20', '\x31', '\x36', '\x36', '\x70', '\x78',
+    '\x20', '\x31', '\x38', '\x2e', '\x35', '\x70', '\x78', '\x20', '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f',
+    '\x72', '\x6d', '\x3a', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x6c', '\x61', '\x74', '\x65', '\x33', '\x64', '\x28',
+    '\x2d', '\x31', '\x36', '\x36', '\x70', '\x78', '\x2c', '\x20', '\x2d', '\x31', '\x33', '\x70', '\x78', '\x2c', '\x20', '\x30',
+    '\x70', '\x78', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2e', '\x67', '\x77', '\x64', '\x2d', '\x73', '\x70', '\x61', '\x6e',
+    '\x2d', '\x31', '\x63', '\x70', '\x77', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x70', '\x6f', '\x73', '\x69', '\x74', '\x69', '\x6f', '\x6e', '\x3a', '\x20', '\x61', '\x62',
+    '\x73', '\x6f', '\x6c', '\x75', '\x74', '\x65', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x6c', '\x65', '\x66', '\x74', '\x3a', '\x20', '\x37', '\x70', '\x78', '\x3b', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x6f', '\x70', '\x3a', '\x20',
+    '\x39', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x66', '\x6f', '\x6e', '\x74', '\x2d', '\x77', '\x65', '\x69', '\x67', '\x68', '\x74', '\x3a', '\x20', '\x62', '\x6f',
+    '\x6c', '\x64', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2e', '\x67', '\x77', '\x64', '\x2d', '\x73', '\x70', '\x61', '\x6e', '\x2d',
+    '\x31', '\x34', '\x6c', '\x39', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x70', '\x6f', '\x73', '\x69', '\x74', '\x69', '\x6f', '\x6e', '\x3a', '\x20', '\x61', '\x62', '\x73',
+    '\x6f', '\x6c', '\x75', '\x74', '\x65', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x6c', '\x65', '\x66', '\x74', '\x3a', '\x20', '\x34', '\x33', '\x36', '\x70', '\x78', '\x3b', '\x0a',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x6f', '\x70', '\x3a',
+    '\x20', '\x38', '\x31', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2e', '\x67', '\x77', '\x64', '\x2d', '\x73', '\x70',
+    '\x61', '\x6e', '\x2d', '\x74', '\x79', '\x7a', '\x35', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x70', '\x6f', '\x73', '\x69', '\x74', '\x69', '\x6f', '\x6e', '\x3a', '\x20',
+    '\x61', '\x62', '\x73', '\x6f', '\x6c', '\x75', '\x74', '\x65', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6c', '\x65', '\x66', '\x74', '\x3a', '\x20', '\x31', '\x33', '\x34', '\x70',
+    '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74',
+    '\x6f', '\x70', '\x3a', '\x20', '\x39', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2e', '\x67', '\x77', '\x64', '\x2d',
+    '\x64', '\x69', '\x76', '\x2d', '\x31', '\x31', '\x36', '\x65', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x70', '\x6f', '\x73', '\x69', '\x74', '\x69', '\x6f', '\x6e', '\x3a',
+    '\x20', '\x61', '\x62', '\x73', '\x6f', '\x6c', '\x75', '\x74', '\x65', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x6f', '\x70', '\x3a', '\x20', '\x34', '\x37', '\x30', '\x70',
+    '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6c',
+    '\x65', '\x66', '\x74', '\x3a', '\x20', '\x35', '\x30', '\x25', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x2d',
+    '\x73', '\x74', '\x79', '\x6c', '\x65', '\x3a', '\x20', '\x70', '\x72', '\x65', '\x73', '\x65', '\x72', '\x76', '\x65', '\x2d',
+    '\x33', '\x64', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x77', '\x69', '\x64', '\x74', '\x68', '\x3a', '\x20', '\x33', '\x32', '\x32', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x68', '\x65', '\x69', '\x67', '\x68', '\x74',
+    '\x3a', '\x20', '\x33', '\x37', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x2d', '\x6f', '\x72',
+    '\x69', '\x67', '\x69', '\x6e', '\x3a', '\x20', '\x31', '\x36', '\x31', '\x70', '\x78', '\x20', '\x31', '\x38', '\x2e', '\x35',
+    '\x70', '\x78', '\x20', '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x3a', '\x20', '\x74',
+    '\x72', '\x61', '\x6e', '\x73', '\x6c', '\x61', '\x74', '\x65', '\x33', '\x64', '\x28', '\x2d', '\x31', '\x36', '\x31', '\x70',
+    '\x78', '\x2c', '\x20', '\x2d', '\x31', '\x33', '\x30', '\x70', '\x78', '\x2c', '\x20', '\x30', '\x70', '\x78', '\x29', '\x3b',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x2e', '\x67', '\x77', '\x64', '\x2d', '\x73', '\x70', '\x61', '\x6e', '\x2d', '\x31', '\x63', '\x36',
+    '\x7a', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x70', '\x6f', '\x73', '\x69', '\x74', '\x69', '\x6f', '\x6e', '\x3a', '\x20', '\x61', '\x62', '\x73', '\x6f', '\x6c', '\x75',
+    '\x74', '\x65', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x6c', '\x65', '\x66', '\x74', '\x3a', '\x20', '\x34', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x6f', '\x70', '\x3a', '\x20', '\x35', '\x30', '\x25', '\x3b',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61',
+    '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x3a', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x6c', '\x61', '\x74',
+    '\x65', '\x33', '\x64', '\x28', '\x30', '\x70', '\x78', '\x2c', '\x20', '\x2d', '\x39', '\x70', '\x78', '\x2c', '\x20', '\x30',
+    '\x70', '\x78', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x2d', '\x73', '\x74', '\x79', '\x6c', '\x65',
+    '\x3a', '\x20', '\x70', '\x72', '\x65', '\x73', '\x65', '\x72', '\x76', '\x65', '\x2d', '\x33', '\x64', '\x3b', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x2e', '\x67', '\x77', '\x64', '\x2d', '\x69', '\x6e', '\x70', '\x75', '\x74', '\x2d', '\x64', '\x7a', '\x77', '\x64',
+    '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x70',
+    '\x6f', '\x73', '\x69', '\x74', '\x69', '\x6f', '\x6e', '\x3a', '\x20', '\x61', '\x62', '\x73', '\x6f', '\x6c', '\x75', '\x74',
+    '\x65', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x68',
+    '\x65', '\x69', '\x67', '\x68', '\x74', '\x3a', '\x20', '\x32', '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x77', '\x69', '\x64', '\x74', '\x68', '\x3a', '\x20',
+    '\x32', '\x32', '\x39', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x2d', '\x6f', '\x72', '\x69',
+    '\x67', '\x69', '\x6e', '\x3a', '\x20', '\x31', '\x31', '\x37', '\x2e', '\x35', '\x70', '\x78', '\x20', '\x31', '\x33', '\x70',
+    '\x78', '\x20', '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x6c', '\x65', '\x66', '\x74', '\x3a', '\x20', '\x37', '\x35', '\x70', '\x78', '\x3b', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x6f', '\x70', '\x3a', '\x20',
+    '\x35', '\x30', '\x25', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x3a', '\x20', '\x74', '\x72', '\x61', '\x6e',
+    '\x73', '\x6c', '\x61', '\x74', '\x65', '\x33', '\x64', '\x28', '\x30', '\x70', '\x78', '\x2c', '\x20', '\x2d', '\x31', '\x33',
+    '\x70', '\x78', '\x2c', '\x20', '\x30', '\x70', '\x78', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f', '\x72', '\x6d', '\x2d',
+    '\x73', '\x74', '\x79', '\x6c', '\x65', '\x3a', '\x20', '\x70', '\x72', '\x65', '\x73', '\x65', '\x72', '\x76', '\x65', '\x2d',
+    '\x33', '\x64', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2e', '\x67', '\x77', '\x64', '\x2d', '\x62', '\x75', '\x74', '\x74', '\x6f',
+    '\x6e', '\x2d', '\x6d', '\x36', '\x38', '\x69', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x70', '\x6f', '\x73', '\x69', '\x74', '\x69', '\x6f', '\x6e', '\x3a', '\x20', '\x61',
+    '\x62', '\x73', '\x6f', '\x6c', '\x75', '\x74', '\x65', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x68', '\x65', '\x69', '\x67', '\x68', '\x74', '\x3a', '\x20', '\x32', '\x33', '\x70',
+    '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x77',
+    '\x69', '\x64', '\x74', '\x68', '\x3a', '\x20', '\x31', '\x32', '\x31', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x72', '\x61', '\x6e', '\x73', '\x66', '\x6f',
+    '\x72', '\x6d', '\x2d', '\x6f', '\x72', '\x69', '\x67', '\x69', '\x6e', '\x3a', '\x20', '\x35', '\x30', '\x25', '\x20', '\x35',
+    '\x30', '\x25', '\x20', '\x30', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x6c', '\x65', '\x66', '\x74', '\x3a', '\x20', '\x31', '\x38', '\x38', '\x70', '\x78', '\x3b',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x74', '\x6f', '\x70',
+    '\x3a', '\x20', '\x32', '\x70', '\x78', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x2f', '\x73', '\x74', '\x79', '\x6c', '\x65', '\x3e', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x3c', '\x73', '\x63', '\x72', '\x69', '\x70', '\x74', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x66', '\x75', '\x6e', '\x63', '\x74', '\x69', '\x6f', '\x6e', '\x20', '\x6c', '\x6f', '\x61', '\x64',
+    '\x43', '\x6f', '\x6d', '\x70', '\x6c', '\x65', '\x74', '\x65', '\x28', '\x29', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x72', '\x65', '\x66', '\x72', '\x65', '\x73', '\x68', '\x4e', '\x65', '\x74', '\x77', '\x6f', '\x72', '\x6b', '\x73',
+    '\x28', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x66',
+    '\x75', '\x6e', '\x63', '\x74', '\x69', '\x6f', '\x6e', '\x20', '\x67', '\x65', '\x74', '\x52', '\x45', '\x53', '\x54', '\x28',
+    '\x66', '\x75', '\x6e', '\x63', '\x74', '\x69', '\x6f', '\x6e', '\x4e', '\x61', '\x6d', '\x65', '\x2c', '\x20', '\x66', '\x75',
+    '\x6e', '\x63', '\x2c', '\x20', '\x70', '\x61', '\x72', '\x61', '\x6d', '\x29', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x63', '\x6f', '\x6e', '\x73', '\x6f', '\x6c', '\x65', '\x2e', '\x6c', '\x6f', '\x67', '\x28', '\x22', '\x2a', '\x2a',
+    '\x2a', '\x2a', '\x2a', '\x2a', '\x2a', '\x2a', '\x20', '\x55', '\x52', '\x4c', '\x3d', '\x27', '\x22', '\x20', '\x2b', '\x20',
+    '\x64', '\x6f', '\x63', '\x75', '\x6d', '\x65', '\x6e', '\x74', '\x2e', '\x55', '\x52', '\x4c', '\x20', '\x2b', '\x20', '\x22',
+    '\x27', '\x22', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x76', '\x61', '\x72', '\x20', '\x75', '\x72', '\x6c', '\x20', '\x3d', '\x20', '\x64', '\x6f', '\x63', '\x75', '\x6d',
+    '\x65', '\x6e', '\x74', '\x2e', '\x55', '\x52', '\x4c', '\x20', '\x2b', '\x20', '\x22', '\x72', '\x65', '\x73', '\x74', '\x2f',
+    '\x76', '\x31', '\x2f', '\x22', '\x20', '\x2b', '\x20', '\x66', '\x75', '\x6e', '\x63', '\x74', '\x69', '\x6f', '\x6e', '\x4e',
+    '\x61', '\x6d', '\x65', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x69', '\x66', '\x20', '\x28', '\x70', '\x61', '\x72', '\x61', '\x6d', '\x20', '\x21', '\x3d', '\x20', '\x75', '\x6e',
+    '\x64', '\x65', '\x66', '\x69', '\x6e', '\x65', '\x64', '\x29', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x75', '\x72', '\x6c', '\x20', '\x2b',
+    '\x3d', '\x20', '\x22', '\x3f', '\x22', '\x20', '\x2b', '\x20', '\x70', '\x61', '\x72', '\x61', '\x6d', '\x3b', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x66', '\x65', '\x74', '\x63', '\x68', '\x28', '\x75', '\x72', '\x6c', '\x29',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x2e', '\x74', '\x68', '\x65', '\x6e', '\x28', '\x72', '\x65', '\x73', '\x70', '\x6f', '\x6e', '\x73', '\x65', '\x20',
+    '\x3d', '\x3e', '\x20', '\x72', '\x65', '\x73', '\x70', '\x6f', '\x6e', '\x73', '\x65', '\x2e', '\x6a', '\x73', '\x6f', '\x6e',
+    '\x28', '\x29', '\x29', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x2e', '\x74', '\x68', '\x65', '\x6e', '\x28', '\x64', '\x61', '\x74', '\x61', '\x20', '\x3d',
+    '\x3e', '\x20', '\x66', '\x75', '\x6e', '\x63', '\x28', '\x64', '\x61', '\x74', '\x61', '\x29', '\x29', '\x3b', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x66', '\x75', '\x6e', '\x63', '\x74', '\x69',
+    '\x6f', '\x6e', '\x20', '\x67', '\x65', '\x74', '\x53', '\x53', '\x49', '\x44', '\x4c', '\x69', '\x73', '\x74', '\x28', '\x29',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x76', '\x61', '\x72', '\x20', '\x6c', '\x69', '\x73', '\x74', '\x20',
+    '\x3d', '\x20', '\x64', '\x6f', '\x63', '\x75', '\x6d', '\x65', '\x6e', '\x74', '\x2e', '\x67', '\x65', '\x74', '\x45', '\x6c',
+    '\x65', '\x6d', '\x65', '\x6e', '\x74', '\x42', '\x79', '\x49', '\x64', '\x28', '\x27', '\x73', '\x73', '\x69', '\x64', '\x4c',
+    '\x69', '\x73', '\x74', '\x27', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x6c', '\x69', '\x73', '\x74', '\x2e', '\x69', '\x6e', '\x6e', '\x65', '\x72', '\x48', '\x54', '\x4d',
+    '\x4c', '\x20', '\x3d', '\x20', '\x22', '\x52', '\x65', '\x66', '\x72', '\x65', '\x73', '\x68', '\x69', '\x6e', '\x67', '\x2e',
+    '\x2e', '\x2e', '\x22', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x67', '\x65', '\x74', '\x52', '\x45', '\x53', '\x54', '\x28', '\x27', '\x67', '\x65', '\x74', '\x53', '\x53', '\x49',
+    '\x44', '\x4c', '\x69', '\x73', '\x74', '\x27', '\x2c', '\x20', '\x75', '\x70', '\x64', '\x61', '\x74', '\x65', '\x53', '\x53',
+    '\x49', '\x44', '\x4c', '\x69', '\x73', '\x74', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x0a', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x66', '\x75', '\x6e', '\x63', '\x74', '\x69', '\x6f', '\x6e', '\x20', '\x67', '\x65', '\x74',
+    '\x43', '\x75', '\x72', '\x72', '\x65', '\x6e', '\x74', '\x53', '\x53', '\x49', '\x44', '\x28', '\x29', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x73', '\x65', '\x74', '\x43', '\x75', '\x72', '\x72', '\x65', '\x6e', '\x74', '\x53', '\x53',
+    '\x49', '\x44', '\x53', '\x74', '\x72', '\x69', '\x6e', '\x67', '\x28', '\x22', '\x52', '\x65', '\x66', '\x72', '\x65', '\x73',
+    '\x68', '\x69', '\x6e', '\x67', '\x2e', '\x2e', '\x2e', '\x22', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x67', '\x65', '\x74', '\x52', '\x45', '\x53', '\x54', '\x28', '\x27',
+    '\x67', '\x65', '\x74', '\x43', '\x75', '\x72', '\x72', '\x65', '\x6e', '\x74', '\x53', '\x53', '\x49', '\x44', '\x27', '\x2c',
+    '\x20', '\x73', '\x65', '\x74', '\x43', '\x75', '\x72', '\x72', '\x65', '\x6e', '\x74', '\x53', '\x53', '\x49', '\x44', '\x53',
+    '\x74', '\x72', '\x69', '\x6e', '\x67', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x7d', '\x0a', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x66', '\x75', '\x6e', '\x63', '\x74',
+    '\x69', '\x6f', '\x6e', '\x20', '\x75', '\x70', '\x64', '\x61', '\x74', '\x65', '\x53', '\x53', '\x49', '\x44', '\x4c', '\x69',
+    '\x73', '\x74', '\x28', '\x61', '\x72', '\x72', '\x61', '\x79', '\x29', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x76', '\x61', '\x72', '\x20', '\x6c', '\x69', '\x73', '\x74', '\x20', '\x3d', '\x20', '\x64', '\x6f', '\x63', '\x75', '\x6d',
+    '\x65', '\x6e', '\x74', '\x2e', '\x67', '\x65', '\x74', '\x45', '\x6c', '\x65', '\x6d', '\x65', '\x6e', '\x74', '\x42', '\x79',
+    '\x49', '\x64', '\x28', '\x27', '\x73', '\x73', '\x69', '\x64', '\x4c', '\x69', '\x73', '\x74', '\x27', '\x29', '\x3b', '\x0a',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6c', '\x69', '\x73', '\x74',
+    '\x2e', '\x69', '\x6e', '\x6e', '\x65', '\x72', '\x48', '\x54', '\x4d', '\x4c', '\x20', '\x3d', '\x20', '\x22', '\x22', '\x3b',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x66', '\x6f', '\x72',
+    '\x20', '\x28', '\x76', '\x61', '\x72', '\x20', '\x69', '\x20', '\x3d', '\x20', '\x30', '\x3b', '\x20', '\x69', '\x20', '\x3c',
+    '\x20', '\x61', '\x72', '\x72', '\x61', '\x79', '\x2e', '\x6c', '\x65', '\x6e', '\x67', '\x74', '\x68', '\x3b', '\x20', '\x69',
+    '\x2b', '\x2b', '\x29', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x63', '\x6f', '\x6e', '\x73', '\x6f', '\x6c', '\x65', '\x2e', '\x6c', '\x6f',
+    '\x67', '\x28', '\x22', '\x2a', '\x2a', '\x2a', '\x2a', '\x2a', '\x2a', '\x20', '\x61', '\x72', '\x72', '\x61', '\x79', '\x20',
+    '\x69', '\x74', '\x65', '\x6d', '\x3d', '\x27', '\x22', '\x20', '\x2b', '\x20', '\x61', '\x72', '\x72', '\x61', '\x79', '\x5b',
+    '\x69', '\x5d', '\x20', '\x2b', '\x20', '\x22', '\x27', '\x22', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x76', '\x61', '\x72', '\x20', '\x69',
+    '\x74', '\x65', '\x6d', '\x20', '\x3d', '\x20', '\x64', '\x6f', '\x63', '\x75', '\x6d', '\x65', '\x6e', '\x74', '\x2e', '\x63',
+    '\x72', '\x65', '\x61', '\x74', '\x65', '\x45', '\x6c', '\x65', '\x6d', '\x65', '\x6e', '\x74', '\x28', '\x27', '\x4c', '\x49',
+    '\x27', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x69', '\x74', '\x65', '\x6d', '\x2e', '\x61', '\x70', '\x70', '\x65', '\x6e', '\x64', '\x43',
+    '\x68', '\x69', '\x6c', '\x64', '\x28', '\x64', '\x6f', '\x63', '\x75', '\x6d', '\x65', '\x6e', '\x74', '\x2e', '\x63', '\x72',
+    '\x65', '\x61', '\x74', '\x65', '\x54', '\x65', '\x78', '\x74', '\x4e', '\x6f', '\x64', '\x65', '\x28', '\x61', '\x72', '\x72',
+    '\x61', '\x79', '\x5b', '\x69', '\x5d', '\x29', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x6c', '\x69', '\x73', '\x74', '\x2e', '\x61', '\x70',
+    '\x70', '\x65', '\x6e', '\x64', '\x43', '\x68', '\x69', '\x6c', '\x64', '\x28', '\x69', '\x74', '\x65', '\x6d', '\x29', '\x3b',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x66', '\x75', '\x6e', '\x63', '\x74', '\x69',
+    '\x6f', '\x6e', '\x20', '\x73', '\x65', '\x74', '\x43', '\x75', '\x72', '\x72', '\x65', '\x6e', '\x74', '\x53', '\x53', '\x49',
+    '\x44', '\x53', '\x74', '\x72', '\x69', '\x6e', '\x67', '\x28', '\x73', '\x29', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x76', '\x61', '\x72', '\x20', '\x73', '\x73', '\x69', '\x64', '\x53', '\x70', '\x61', '\x6e', '\x20', '\x3d', '\x20',
+    '\x64', '\x6f', '\x63', '\x75', '\x6d', '\x65', '\x6e', '\x74', '\x2e', '\x67', '\x65', '\x74', '\x45', '\x6c', '\x65', '\x6d',
+    '\x65', '\x6e', '\x74', '\x42', '\x79', '\x49', '\x64', '\x28', '\x27', '\x63', '\x75', '\x72', '\x72', '\x65', '\x6e', '\x74',
+    '\x53', '\x53', '\x49', '\x44', '\x27', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x73', '\x73', '\x69', '\x64', '\x53', '\x70', '\x61', '\x6e', '\x2e', '\x74', '\x65', '\x78',
+    '\x74', '\x43', '\x6f', '\x6e', '\x74', '\x65', '\x6e', '\x74', '\x20', '\x3d', '\x20', '\x73', '\x3b', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x66', '\x75', '\x6e', '\x63', '\x74', '\x69', '\x6f',
+    '\x6e', '\x20', '\x72', '\x65', '\x66', '\x72', '\x65', '\x73', '\x68', '\x4e', '\x65', '\x74', '\x77', '\x6f', '\x72', '\x6b',
+    '\x73', '\x28', '\x29', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7b', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x67', '\x65', '\x74', '\x43', '\x75', '\x72',
+    '\x72', '\x65', '\x6e', '\x74', '\x53', '\x53', '\x49', '\x44', '\x28', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x67', '\x65', '\x74', '\x53', '\x53', '\x49', '\x44', '\x4c',
+    '\x69', '\x73', '\x74', '\x28', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x66', '\x75', '\x6e', '\x63', '\x74', '\x69', '\x6f', '\x6e', '\x20', '\x73', '\x65', '\x6c', '\x65', '\x63',
+    '\x74', '\x4e', '\x65', '\x74', '\x77', '\x6f', '\x72', '\x6b', '\x45', '\x6e', '\x74', '\x72', '\x79', '\x28', '\x65', '\x29',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x76', '\x61', '\x72', '\x20', '\x73', '\x65', '\x6c', '\x65', '\x63',
+    '\x74', '\x65', '\x64', '\x3b', '\x0a', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x69', '\x66', '\x20', '\x28', '\x65', '\x2e', '\x74', '\x61', '\x72', '\x67', '\x65', '\x74', '\x2e', '\x74',
+    '\x61', '\x67', '\x4e', '\x61', '\x6d', '\x65', '\x20', '\x3d', '\x3d', '\x3d', '\x20', '\x27', '\x4c', '\x49', '\x27', '\x29',
+    '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x73', '\x65', '\x6c', '\x65', '\x63', '\x74', '\x65', '\x64', '\x20', '\x3d', '\x20', '\x64', '\x6f',
+    '\x63', '\x75', '\x6d', '\x65', '\x6e', '\x74', '\x2e', '\x71', '\x75', '\x65', '\x72', '\x79', '\x53', '\x65', '\x6c', '\x65',
+    '\x63', '\x74', '\x6f', '\x72', '\x28', '\x27', '\x6c', '\x69', '\x2e', '\x73', '\x65', '\x6c', '\x65', '\x63', '\x74', '\x65',
+    '\x64', '\x27', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x69', '\x66', '\x20', '\x28', '\x73', '\x65', '\x6c', '\x65', '\x63', '\x74', '\x65',
+    '\x64', '\x29', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x73', '\x65', '\x6c', '\x65', '\x63', '\x74', '\x65',
+    '\x64', '\x2e', '\x63', '\x6c', '\x61', '\x73', '\x73', '\x4e', '\x61', '\x6d', '\x65', '\x3d', '\x20', '\x27', '\x27', '\x3b',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x65', '\x2e', '\x74', '\x61', '\x72', '\x67', '\x65', '\x74', '\x2e', '\x63', '\x6c', '\x61', '\x73',
+    '\x73', '\x4e', '\x61', '\x6d', '\x65', '\x3d', '\x20', '\x27', '\x73', '\x65', '\x6c', '\x65', '\x63', '\x74', '\x65', '\x64',
+    '\x27', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x66', '\x75', '\x6e', '\x63',
+    '\x74', '\x69', '\x6f', '\x6e', '\x20', '\x70', '\x61', '\x73', '\x73', '\x77', '\x6f', '\x72', '\x64', '\x4b', '\x65', '\x79',
+    '\x70', '\x72', '\x65', '\x73', '\x73', '\x28', '\x65', '\x29', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x69',
+    '\x66', '\x20', '\x28', '\x65', '\x2e', '\x6b', '\x65', '\x79', '\x43', '\x6f', '\x64', '\x65', '\x20', '\x3d', '\x3d', '\x20',
+    '\x31', '\x33', '\x29', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2f', '\x2f', '\x20', '\x47', '\x65', '\x74', '\x20', '\x74', '\x68', '\x65',
+    '\x20', '\x70', '\x61', '\x73', '\x73', '\x77', '\x6f', '\x72', '\x64', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x76', '\x61', '\x72', '\x20', '\x70', '\x61',
+    '\x73', '\x73', '\x77', '\x6f', '\x72', '\x64', '\x20', '\x3d', '\x20', '\x64', '\x6f', '\x63', '\x75', '\x6d', '\x65', '\x6e',
+    '\x74', '\x2e', '\x67', '\x65', '\x74', '\x45', '\x6c', '\x65', '\x6d', '\x65', '\x6e', '\x74', '\x42', '\x79', '\x49', '\x64',
+    '\x28', '\x27', '\x70', '\x61', '\x73', '\x73', '\x77', '\x6f', '\x72', '\x64', '\x27', '\x29', '\x2e', '\x76', '\x61', '\x6c',
+    '\x75', '\x65', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x76', '\x61', '\x72', '\x20', '\x73', '\x65', '\x6c', '\x65', '\x63', '\x74', '\x65', '\x64',
+    '\x20', '\x3d', '\x20', '\x64', '\x6f', '\x63', '\x75', '\x6d', '\x65', '\x6e', '\x74', '\x2e', '\x71', '\x75', '\x65', '\x72',
+    '\x79', '\x53', '\x65', '\x6c', '\x65', '\x63', '\x74', '\x6f', '\x72', '\x28', '\x27', '\x6c', '\x69', '\x2e', '\x73', '\x65',
+    '\x6c', '\x65', '\x63', '\x74', '\x65', '\x64', '\x27', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x69', '\x66', '\x20', '\x28', '\x21', '\x73',
+    '\x65', '\x6c', '\x65', '\x63', '\x74', '\x65', '\x64', '\x29', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2f',
+    '\x2f', '\x20', '\x46', '\x49', '\x58', '\x4d', '\x45', '\x3a', '\x20', '\x53', '\x68', '\x6f', '\x77', '\x20', '\x65', '\x72',
+    '\x72', '\x6f', '\x72', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6e', '\x3b', '\x0a',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x63', '\x6f', '\x6e', '\x6e', '\x65', '\x63', '\x74', '\x54', '\x6f', '\x4e', '\x65', '\x74', '\x77',
+    '\x6f', '\x72', '\x6b', '\x28', '\x73', '\x65', '\x6c', '\x65', '\x63', '\x74', '\x65', '\x64', '\x2e', '\x69', '\x6e', '\x6e',
+    '\x65', '\x72', '\x48', '\x54', '\x4d', '\x4c', '\x2c', '\x20', '\x70', '\x61', '\x73', '\x73', '\x77', '\x6f', '\x72', '\x64',
+    '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x66', '\x75', '\x6e', '\x63',
+    '\x74', '\x69', '\x6f', '\x6e', '\x20', '\x63', '\x6f', '\x6e', '\x6e', '\x65', '\x63', '\x74', '\x54', '\x6f', '\x4e', '\x65',
+    '\x74', '\x77', '\x6f', '\x72', '\x6b', '\x28', '\x73', '\x73', '\x69', '\x64', '\x2c', '\x20', '\x70', '\x61', '\x73', '\x73',
+    '\x77', '\x6f', '\x72', '\x64', '\x29', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7b', '\x0a',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2f', '\x2f', '\x20', '\x46',
+    '\x49', '\x58', '\x4d', '\x45', '\x3a', '\x20', '\x49', '\x6d', '\x70', '\x6c', '\x65', '\x6d', '\x65', '\x6e', '\x74', '\x0a',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x2f', '\x2f', '\x20', '\x46',
+    '\x49', '\x58', '\x4d', '\x45', '\x3a', '\x20', '\x68', '\x61', '\x6e', '\x64', '\x6c', '\x65', '\x20', '\x65', '\x72', '\x72',
+    '\x6f', '\x72', '\x73', '\x20', '\x28', '\x65', '\x6d', '\x70', '\x74', '\x79', '\x20', '\x53', '\x53', '\x49', '\x44', '\x2c',
+    '\x20', '\x65', '\x74', '\x63', '\x2e', '\x29', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x76', '\x61', '\x72', '\x20', '\x73', '\x73', '\x69', '\x64', '\x53', '\x70', '\x61', '\x6e', '\x20',
+    '\x3d', '\x20', '\x64', '\x6f', '\x63', '\x75', '\x6d', '\x65', '\x6e', '\x74', '\x2e', '\x67', '\x65', '\x74', '\x45', '\x6c',
+    '\x65', '\x6d', '\x65', '\x6e', '\x74', '\x42', '\x79', '\x49', '\x64', '\x28', '\x27', '\x63', '\x75', '\x72', '\x72', '\x65',
+    '\x6e', '\x74', '\x53', '\x53', '\x49', '\x44', '\x27', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x73', '\x73', '\x69', '\x64', '\x53', '\x70', '\x61', '\x6e', '\x2e', '\x74',
+    '\x65', '\x78', '\x74', '\x43', '\x6f', '\x6e', '\x74', '\x65', '\x6e', '\x74', '\x20', '\x3d', '\x20', '\x22', '\x41', '\x74',
+    '\x74', '\x65', '\x6d', '\x70', '\x74', '\x69', '\x6e', '\x67', '\x20', '\x74', '\x6f', '\x20', '\x63', '\x6f', '\x6e', '\x6e',
+    '\x65', '\x63', '\x74', '\x20', '\x74', '\x6f', '\x20', '\x27', '\x22', '\x20', '\x2b', '\x20', '\x73', '\x73', '\x69', '\x64',
+    '\x20', '\x2b', '\x20', '\x22', '\x27', '\x2e', '\x2e', '\x2e', '\x22', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x63', '\x6f', '\x6e', '\x73', '\x6f', '\x6c', '\x65', '\x2e', '\x6c',
+    '\x6f', '\x67', '\x28', '\x22', '\x2a', '\x2a', '\x2a', '\x2a', '\x2a', '\x2a', '\x20', '\x63', '\x6f', '\x6e', '\x6e', '\x65',
+    '\x63', '\x74', '\x54', '\x6f', '\x4e', '\x65', '\x74', '\x77', '\x6f', '\x72', '\x6b', '\x28', '\x27', '\x22', '\x20', '\x2b',
+    '\x20', '\x73', '\x73', '\x69', '\x64', '\x20', '\x2b', '\x20', '\x22', '\x27', '\x2c', '\x20', '\x27', '\x22', '\x20', '\x2b',
+    '\x20', '\x70', '\x61', '\x73', '\x73', '\x77', '\x6f', '\x72', '\x64', '\x20', '\x2b', '\x20', '\x22', '\x27', '\x29', '\x22',
+    '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x0a',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x67', '\x65', '\x74', '\x52',
+    '\x45', '\x53', '\x54', '\x28', '\x27', '\x73', '\x65', '\x74', '\x53', '\x53', '\x49', '\x44', '\x27', '\x2c', '\x20', '\x73',
+    '\x65', '\x74', '\x53', '\x53', '\x49', '\x44', '\x43', '\x6f', '\x6d', '\x70', '\x6c', '\x65', '\x74', '\x65', '\x2c', '\x20',
+    '\x22', '\x73', '\x73', '\x69', '\x64', '\x3d', '\x22', '\x20', '\x2b', '\x20', '\x73', '\x73', '\x69', '\x64', '\x20', '\x2b',
+    '\x20', '\x22', '\x26', '\x70', '\x61', '\x73', '\x73', '\x77', '\x6f', '\x72', '\x64', '\x3d', '\x22', '\x20', '\x2b', '\x20',
+    '\x70', '\x61', '\x73', '\x73', '\x77', '\x6f', '\x72', '\x64', '\x29', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x66', '\x75', '\x6e', '\x63', '\x74', '\x69', '\x6f', '\x6e', '\x20', '\x73',
+    '\x65', '\x74', '\x53', '\x53', '\x49', '\x44', '\x43', '\x6f', '\x6d', '\x70', '\x6c', '\x65', '\x74', '\x65', '\x28', '\x73',
+    '\x29', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7b', '\x0a', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x76', '\x61', '\x72', '\x20', '\x73', '\x73', '\x69', '\x64',
+    '\x53', '\x70', '\x61', '\x6e', '\x20', '\x3d', '\x20', '\x64', '\x6f', '\x63', '\x75', '\x6d', '\x65', '\x6e', '\x74', '\x2e',
+    '\x67', '\x65', '\x74', '\x45', '\x6c', '\x65', '\x6d', '\x65', '\x6e', '\x74', '\x42', '\x79', '\x49', '\x64', '\x28', '\x27',
+    '\x63', '\x75', '\x72', '\x72', '\x65', '\x6e', '\x74', '\x53', '\x53', '\x49', '\x44', '\x27', '\x29', '\x3b', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x73', '\x73', '\x69', '\x64', '\x53',
+    '\x70', '\x61', '\x6e', '\x2e', '\x74', '\x65', '\x78', '\x74', '\x43', '\x6f', '\x6e', '\x74', '\x65', '\x6e', '\x74', '\x20',
+    '\x3d', '\x20', '\x73', '\x3b', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x7d', '\x0a', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x2f', '\x73', '\x63',
+    '\x72', '\x69', '\x70', '\x74', '\x3e', '\x0a', '\x3c', '\x2f', '\x68', '\x65', '\x61', '\x64', '\x3e', '\x0a', '\x0a', '\x3c',
+    '\x62', '\x6f', '\x64', '\x79', '\x20', '\x6f', '\x6e', '\x6c', '\x6f', '\x61', '\x64', '\x3d', '\x22', '\x6c', '\x6f', '\x61',
+    '\x64', '\x43', '\x6f', '\x6d', '\x70', '\x6c', '\x65', '\x74', '\x65', '\x28', '\x29', '\x22', '\x20', '\x63', '\x6c', '\x61',
+    '\x73', '\x73', '\x3d', '\x22', '\x68', '\x74', '\x6d', '\x6c', '\x4e', '\x6f', '\x50', '\x61', '\x67', '\x65', '\x73', '\x22',
+    '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x64', '\x69', '\x76', '\x20', '\x63', '\x6c', '\x61', '\x73', '\x73',
+    '\x3d', '\x22', '\x67', '\x77', '\x64', '\x2d', '\x64', '\x69', '\x76', '\x2d', '\x61', '\x34', '\x61', '\x73', '\x22', '\x3e',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x68', '\x31', '\x20', '\x63', '\x6c', '\x61',
+    '\x73', '\x73', '\x3d', '\x22', '\x67', '\x77', '\x64', '\x2d', '\x73', '\x70', '\x61', '\x6e', '\x2d', '\x6d', '\x67', '\x64',
+    '\x70', '\x22', '\x3e', '\x57', '\x65', '\x6c', '\x63', '\x6f', '\x6d', '\x65', '\x20', '\x74', '\x6f', '\x20', '\x6d', '\x38',
+    '\x72', '\x73', '\x63', '\x72', '\x69', '\x70', '\x74', '\x3c', '\x2f', '\x68', '\x31', '\x3e', '\x0a', '\x20', '\x20', '\x20',
+    '\x20', '\x3c', '\x2f', '\x64', '\x69', '\x76', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x64', '\x69', '\x76',
+    '\x20', '\x63', '\x6c', '\x61', '\x73', '\x73', '\x3d', '\x22', '\x67', '\x77', '\x64', '\x2d', '\x64', '\x69', '\x76', '\x2d',
+    '\x76', '\x36', '\x31', '\x32', '\x22', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x3c',
+    '\x73', '\x70', '\x61', '\x6e', '\x20', '\x63', '\x6c', '\x61', '\x73', '\x73', '\x3d', '\x22', '\x67', '\x77', '\x64', '\x2d',
+    '\x73', '\x70', '\x61', '\x6e', '\x2d', '\x31', '\x63', '\x70', '\x77', '\x22', '\x3e', '\x43', '\x75', '\x72', '\x72', '\x65',
+    '\x6e', '\x74', '\x20', '\x6e', '\x65', '\x74', '\x77', '\x6f', '\x72', '\x6b', '\x3a', '\x3c', '\x2f', '\x73', '\x70', '\x61',
+    '\x6e', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x73', '\x70', '\x61', '\x6e',
+    '\x20', '\x69', '\x64', '\x3d', '\x22', '\x63', '\x75', '\x72', '\x72', '\x65', '\x6e', '\x74', '\x53', '\x53', '\x49', '\x44',
+    '\x22', '\x20', '\x63', '\x6c', '\x61', '\x73', '\x73', '\x3d', '\x22', '\x67', '\x77', '\x64', '\x2d', '\x73', '\x70', '\x61',
+    '\x6e', '\x2d', '\x74', '\x79', '\x7a', '\x35', '\x22', '\x3e', '\x3c', '\x2f', '\x73', '\x70', '\x61', '\x6e', '\x3e', '\x0a',
+    '\x20', '\x20', '\x20', '\x20', '\x3c', '\x2f', '\x64', '\x69', '\x76', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x3c',
+    '\x64', '\x69', '\x76', '\x20', '\x63', '\x6c', '\x61', '\x73', '\x73', '\x3d', '\x22', '\x67', '\x77', '\x64', '\x2d', '\x64',
+    '\x69', '\x76', '\x2d', '\x31', '\x7a', '\x32', '\x67', '\x22', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x3c', '\x73', '\x70', '\x61', '\x6e', '\x20', '\x63', '\x6c', '\x61', '\x73', '\x73', '\x3d', '\x22', '\x67',
+    '\x77', '\x64', '\x2d', '\x73', '\x70', '\x61', '\x6e', '\x2d', '\x6b', '\x63', '\x63', '\x36', '\x22', '\x3e', '\x41', '\x76',
+    '\x61', '\x69', '\x6c', '\x61', '\x62', '\x6c', '\x65', '\x20', '\x4e', '\x65', '\x74', '\x77', '\x6f', '\x72', '\x6b', '\x73',
+    '\x3c', '\x2f', '\x73', '\x70', '\x61', '\x6e', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x3c', '\x62', '\x75', '\x74', '\x74', '\x6f', '\x6e', '\x20', '\x63', '\x6c', '\x61', '\x73', '\x73', '\x3d', '\x22', '\x67',
+    '\x77', '\x64', '\x2d', '\x62', '\x75', '\x74', '\x74', '\x6f', '\x6e', '\x2d', '\x6d', '\x36', '\x38', '\x69', '\x22', '\x20',
+    '\x74', '\x79', '\x70', '\x65', '\x3d', '\x22', '\x73', '\x75', '\x62', '\x6d', '\x69', '\x74', '\x22', '\x20', '\x6f', '\x6e',
+    '\x63', '\x6c', '\x69', '\x63', '\x6b', '\x3d', '\x22', '\x72', '\x65', '\x66', '\x72', '\x65', '\x73', '\x68', '\x4e', '\x65',
+    '\x74', '\x77', '\x6f', '\x72', '\x6b', '\x73', '\x28', '\x29', '\x22', '\x3e', '\x52', '\x65', '\x66', '\x72', '\x65', '\x73',
+    '\x68', '\x3c', '\x2f', '\x62', '\x75', '\x74', '\x74', '\x6f', '\x6e', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x3c', '\x64', '\x69', '\x76', '\x20', '\x63', '\x6c', '\x61', '\x73', '\x73', '\x3d', '\x22', '\x67',
+    '\x77', '\x64', '\x2d', '\x64', '\x69', '\x76', '\x2d', '\x6b', '\x36', '\x62', '\x6e', '\x22', '\x3e', '\x0a', '\x20', '\x20',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x75', '\x6c', '\x20', '\x69', '\x64',
+    '\x3d', '\x22', '\x73', '\x73', '\x69', '\x64', '\x4c', '\x69', '\x73', '\x74', '\x22', '\x20', '\x6f', '\x6e', '\x63', '\x6c',
+    '\x69', '\x63', '\x6b', '\x3d', '\x22', '\x73', '\x65', '\x6c', '\x65', '\x63', '\x74', '\x4e', '\x65', '\x74', '\x77', '\x6f',
+    '\x72', '\x6b', '\x45', '\x6e', '\x74', '\x72', '\x79', '\x28', '\x65', '\x76', '\x65', '\x6e', '\x74', '\x29', '\x22', '\x3e',
+    '\x20', '\x3c', '\x2f', '\x75', '\x6c', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x3c',
+    '\x2f', '\x64', '\x69', '\x76', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x2f', '\x64', '\x69', '\x76', '\x3e',
+    '\x0a', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x64', '\x69', '\x76', '\x20', '\x63', '\x6c', '\x61', '\x73', '\x73', '\x3d',
+    '\x22', '\x67', '\x77', '\x64', '\x2d', '\x64', '\x69', '\x76', '\x2d', '\x31', '\x31', '\x36', '\x65', '\x22', '\x3e', '\x0a',
+    '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x73', '\x70', '\x61', '\x6e', '\x20', '\x63', '\x6c',
+    '\x61', '\x73', '\x73', '\x3d', '\x22', '\x67', '\x77', '\x64', '\x2d', '\x73', '\x70', '\x61', '\x6e', '\x2d', '\x31', '\x63',
+    '\x36', '\x7a', '\x22', '\x3e', '\x50', '\x61', '\x73', '\x73', '\x77', '\x6f', '\x72', '\x64', '\x3a', '\x3c', '\x2f', '\x73',
+    '\x70', '\x61', '\x6e', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x69', '\x6e',
+    '\x70', '\x75', '\x74', '\x20', '\x69', '\x64', '\x3d', '\x22', '\x70', '\x61', '\x73', '\x73', '\x77', '\x6f', '\x72', '\x64',
+    '\x22', '\x20', '\x74', '\x79', '\x70', '\x65', '\x3d', '\x22', '\x70', '\x61', '\x73', '\x73', '\x77', '\x6f', '\x72', '\x64',
+    '\x22', '\x20', '\x63', '\x6c', '\x61', '\x73', '\x73', '\x3d', '\x22', '\x67', '\x77', '\x64', '\x2d', '\x69', '\x6e', '\x70',
+    '\x75', '\x74', '\x2d', '\x64', '\x7a', '\x77', '\x64', '\x22', '\x20', '\x70', '\x6c', '\x61', '\x63', '\x65', '\x68', '\x6f',
+    '\x6c', '\x64', '\x65', '\x72', '\x3d', '\x22', '\x70', '\x61', '\x73', '\x73', '\x77', '\x6f', '\x72', '\x64', '\x22', '\x20',
+    '\x6f', '\x6e', '\x6b', '\x65', '\x79', '\x70', '\x72', '\x65', '\x73', '\x73', '\x3d', '\x22', '\x70', '\x61', '\x73', '\x73',
+    '\x77', '\x6f', '\x72', '\x64', '\x4b', '\x65', '\x79', '\x70', '\x72', '\x65', '\x73', '\x73', '\x28', '\x65', '\x76', '\x65',
+    '\x6e', '\x74', '\x29', '\x22', '\x3e', '\x0a', '\x20', '\x20', '\x20', '\x20', '\x3c', '\x2f', '\x64', '\x69', '\x76', '\x3e',
+    '\x0a', '\x3c', '\x2f', '\x62', '\x6f', '\x64', '\x79', '\x3e', '\x0a', '\x0a', '\x3c', '\x2f', '\x68', '\x74', '\x6d', '\x6c',
+    '\x3e', '\x0a',
+};
+
+static const char _asset1Gzip[] = {
+    '\x1f', '\x8b', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\xcd', '\x5a', '\x5b', '\x73', '\xdb', '\x36',
+    '\x16', '\x7e', '\xcf', '\xaf', '\x40', '\x38', '\xd3', '\x15', '\xb5', '\x91', '\x28', '\x52', '\x92', '\x65', '\x59', '\x96',
+    '\xb4', '\x93', '\x75', '\xdc', '\xd6', '\xd3', '\x34', '\xcd', '\xc4', '\xee', '\xb4', '\x9d', '\x9d', '\x7d', '\xa0', '\x48',
+    '\x48', '\x44', '\x0d', '\x11', '\x5c', '\x10', '\x94', '\x23', '\x77', '\xf2', '\xdf', '\xf7', '\x00', '\x24', '\x25', '\x5e',
+    '\x40', '\xeb', '\x32', '\x69', '\xa7', '\x1a', '\x47', '\x22', '\x81', '\x83', '\x73', '\xf9', '\xce', '\x05', '\xb7', '\x4c',
+    '\x5f', '\xbf', '\xfb', '\xe9', '\xe6', '\xe1', '\xb7', '\x8f', '\xb7', '\x28', '\x10', '\x6b', '\x3a', '\x7f', '\x35', '\x4d',
+    '\x7f', '\xe0', '\x17', '\xbb', '\xfe', '\xfc', '\x15', '\x82', '\xcf', '\x74', '\x8d', '\x85', '\x8b', '\xbc', '\xc0', '\xe5',
+    '\x31', '\x16', '\x33', '\x23', '\x11', '\xcb', '\xee', '\xd8', '\xc8', '\xba', '\x04', '\x11', '\x14', '\xcf', '\x7f', '\xc1',
+    '\xd4', '\x63', '\x6b', '\x8c', '\x04', '\x43', '\xeb', '\x31', '\x8f', '\x3d', '\x4e', '\x22', '\x31', '\xed', '\xa5', '\x7d',
+    '\x05', '\x16', '\xa1', '\xbb', '\xc6', '\x33', '\x63', '\x85', '\x43', '\xcc', '\x5d', '\xc1', '\xb8', '\x81', '\x3c', '\x16',
+    '\x0a', '\x1c', '\x02', '\xcf', '\xef', '\x18', '\x5b', '\x51', '\x8c', '\x7e', '\xc1', '\x0b', '\xf4', '\x0e', '\xc7', '\x64',
+    '\x05', '\x14', '\x68', '\x6c', '\xd9', '\xd6', '\xc0', '\xb2', '\x47', '\xf6', '\x20', '\x17', '\x16', '\x8b', '\x2d', '\x10',
+    '\x89', '\x6d', '\x04', '\x5c', '\x04', '\xfe', '\x2c', '\x7a', '\x5e', '\x1c', '\x1b', '\x88', '\xf8', '\xc0', '\xf3', '\xc9',
+    '\xef', '\xca', '\x96', '\xae', '\x22', '\xc9', '\xe8', '\xe5', '\x27', '\x42', '\x7f', '\xec', '\x9e', '\xe5', '\x67', '\xed',
+    '\xf2', '\x15', '\x09', '\x27', '\xc8', '\x8e', '\x3e', '\x5f', '\xef', '\x3a', '\xbe', '\xec', '\x9e', '\x02', '\xe7', '\x44',
+    '\xfa', '\xfe', '\x89', '\xf4', '\x83', '\xe3', '\xe9', '\xa7', '\x3d', '\x65', '\xcc', '\x4b', '\xb6', '\xef', '\xed', '\x94',
+    '\x5e', '\xeb', '\xa0', '\x05', '\xf3', '\xb7', '\x15', '\x01', '\x4f', '\xc4', '\x17', '\xc1', '\x04', '\x39', '\xb6', '\xfd',
+    '\xcd', '\x75', '\xa9', '\x23', '\xc0', '\x64', '\x15', '\x08', '\x5d', '\xcf', '\x01', '\x1b', '\x34', '\x42', '\x16', '\xae',
+    '\xf7', '\xb8', '\xe2', '\x2c', '\x09', '\xfd', '\xae', '\xc7', '\x28', '\xe3', '\x13', '\x24', '\xb8', '\x1b', '\xc6', '\x91',
+    '\xcb', '\xc1', '\xbb', '\x65', '\xe6', '\xaa', '\x63', '\xc9', '\xf8', '\x7a', '\x82', '\x22', '\xcc', '\xe3', '\x08', '\x7b',
+    '\x82', '\x6c', '\xb0', '\xe9', '\x0c', '\x6d', '\x10', '\xd7', '\x06', '\xd9', '\x82', '\x93', '\xcf', '\x03', '\xdf', '\x74',
+    '\x3a', '\xc8', '\x2e', '\xfc', '\x1d', '\x78', '\x6d', '\x37', '\x08', '\x49', '\xe3', '\x01', '\x44', '\x71', '\x1c', '\x63',
+    '\xbe', '\xc1', '\xdd', '\x81', '\xaf', '\x33', '\x29', '\xa1', '\x15', '\x83', '\x28', '\x89', '\xb3', '\x58', '\xea', '\x4a',
+    '\xc8', '\x27', '\x28', '\x64', '\x21', '\x2e', '\xcb', '\x88', '\x5c', '\xdf', '\x27', '\xe1', '\x4a', '\x02', '\x58', '\xc4',
+    '\xe9', '\x08', '\x00', '\x29', '\xa9', '\x48', '\xdb', '\xb1', '\xba', '\xa8', '\x72', '\x62', '\x1b', '\xcc', '\x97', '\x94',
+    '\x3d', '\x4d', '\x90', '\x9b', '\x08', '\xa6', '\x67', '\x36', '\x09', '\x24', '\x55', '\xa3', '\x47', '\x26', '\x88', '\xaf',
+    '\x16', '\x66', '\x7f', '\x30', '\xee', '\xa0', '\xfc', '\xab', '\x82', '\x96', '\x97', '\xf0', '\x58', '\xfa', '\x2c', '\x62',
+    '\x04', '\xd2', '\x91', '\xeb', '\xa5', '\x58', '\x31', '\xa6', '\xe0', '\x2b', '\xec', '\x1f', '\x12', '\x64', '\x83', '\x3f',
+    '\xf2', '\xaf', '\x76', '\x03', '\x64', '\xc3', '\xaa', '\x9d', '\x0b', '\xc6', '\x7d', '\x0c', '\x2a', '\x38', '\xd1', '\x67',
+    '\x14', '\x33', '\x4a', '\x7c', '\xb4', '\xa0', '\xc0', '\xf8', '\x64', '\x3d', '\x2d', '\x59', '\x08', '\x7c', '\xb2', '\xe9',
+    '\xba', '\x43', '\x37', '\xae', '\xa2', '\xcc', '\x62', '\x22', '\x08', '\x03', '\xbf', '\xb8', '\x0b', '\x90', '\x91', '\x88',
+    '\x8a', '\x43', '\xcf', '\xc8', '\x14', '\x8a', '\x97', '\xd0', '\x5e', '\x6d', '\x15', '\x2c', '\x2a', '\x37', '\x56', '\xf4',
+    '\x83', '\xbc', '\x08', '\xbb', '\xeb', '\x95', '\x1f', '\x9d', '\xa8', '\xa0', '\xe2', '\x7b', '\x59', '\x85', '\x2e', '\xd5',
+    '\xe1', '\xa2', '\xa6', '\xc4', '\x51', '\x29', '\x20', '\x3f', '\x4b', '\x28', '\xc2', '\xdd', '\x98', '\x3c', '\x03', '\xcd',
+    '\xa0', '\x16', '\xca', '\x19', '\x28', '\x83', '\x8b', '\x51', '\xb5', '\x27', '\x47', '\x65', '\x50', '\xeb', '\xd9', '\x8b',
+    '\x66', '\x9c', '\xa8', '\x44', '\x70', '\x2e', '\xc7', '\xe0', '\x58', '\x47', '\x7e', '\xd9', '\x8d', '\xd4', '\x59', '\xd1',
+    '\xa0', '\xae', '\xc0', '\x90', '\xff', '\x5d', '\x35', '\xa6', '\x23', '\xe9', '\xd5', '\x57', '\x35', '\xc3', '\x65', '\xb1',
+    '\x77', '\x29', '\xcc', '\x14', '\x13', '\xe4', '\xe1', '\x83', '\xe1', '\xe0', '\x3c', '\xf7', '\x57', '\xe7', '\xa0', '\xed',
+    '\x5c', '\xd8', '\x5f', '\x1d', '\xef', '\x1c', '\xb8', '\xbe', '\x73', '\xd5', '\x84', '\x76', '\xbf', '\x7f', '\x04', '\xa6',
+    '\x23', '\x99', '\x2c', '\x8e', '\x7d', '\x65', '\x5d', '\x9c', '\x04', '\xab', '\x1c', '\xd6', '\x41', '\xdd', '\xa1', '\x06',
+    '\x58', '\x5d', '\x9c', '\x3e', '\x7a', '\xde', '\xe8', '\x1c', '\xe4', '\xfa', '\x7a', '\xdc', '\x06', '\xfa', '\x92', '\xb8',
+    '\x73', '\xd4', '\xe3', '\x68', '\x11', '\x9e', '\x28', '\x6e', '\x5f', '\x23', '\x61', '\xe1', '\xc1', '\x28', '\xd5', '\x55',
+    '\x96', '\xdc', '\x29', '\xaa', '\xb6', '\x68', '\x09', '\xf2', '\xec', '\xd7', '\x57', '\xa6', '\x2e', '\x77', '\x7d', '\x92',
+    '\xc4', '\x9a', '\xca', '\x95', '\x1a', '\x7b', '\xf1', '\xa7', '\x45', '\x89', '\x33', '\x6e', '\xca', '\xc9', '\xfe', '\xd5',
+    '\xf0', '\x88', '\x28', '\x19', '\x5e', '\x5a', '\x97', '\x0e', '\x38', '\x03', '\x5d', '\xd9', '\x96', '\x3d', '\x96', '\x69',
+    '\x7c', '\x42', '\xac', '\x0c', '\x55', '\x0a', '\x3a', '\xce', '\xc1', '\x50', '\x91', '\xae', '\xdb', '\x8c', '\x9c', '\xfe',
+    '\x89', '\xae', '\xdb', '\xd5', '\x90', '\x4b', '\x2d', '\xac', '\x23', '\xe7', '\xab', '\xc3', '\x9a', '\x67', '\xd8', '\xe0',
+    '\xa8', '\x0c', '\x1b', '\xa9', '\xaa', '\x75', '\x6a', '\x82', '\x8d', '\x54', '\x82', '\x39', '\x83', '\xe3', '\x12', '\xcc',
+    '\xf1', '\xa2', '\xa7', '\x13', '\x61', '\x4b', '\x51', '\xd0', '\x63', '\x56', '\xab', '\x29', '\xaa', '\xbc', '\x3f', '\x65',
+    '\x40', '\x2f', '\x18', '\xf5', '\x0f', '\xa8', '\x33', '\xa4', '\x57', '\x67', '\xa9', '\x33', '\xd4', '\x4c', '\x04', '\x52',
+    '\xa1', '\xb1', '\xf3', '\x42', '\xca', '\x2b', '\x91', '\x62', '\xfb', '\x7c', '\x71', '\x96', '\x48', '\x67', '\x30', '\x3c',
+    '\x8c', '\x81', '\x6e', '\x36', '\x70', '\x46', '\xf8', '\x9c', '\x9a', '\x36', '\xbc', '\xb4', '\xff', '\xb4', '\x80', '\xac',
+    '\x97', '\xfc', '\x17', '\x92', '\xa3', '\x69', '\x32', '\x18', '\x9f', '\x37', '\x17', '\x38', '\x03', '\xfb', '\xd8', '\x58',
+    '\x1d', '\x3d', '\x9f', '\x17', '\x1c', '\x5a', '\x3f', '\x35', '\xc3', '\x56', '\x56', '\x54', '\x69', '\xd7', '\xbd', '\x6a',
+    '\x58', '\x09', '\x9c', '\xb8', '\xd6', '\x57', '\xd6', '\x90', '\x30', '\x4a', '\x44', '\xd7', '\x7f', '\x7e', '\xf2', '\xcf',
+    '\xac', '\x58', '\xfd', '\xc6', '\xaa', '\xdc', '\xbf', '\x3a', '\xc2', '\x5d', '\xce', '\xa5', '\xf2', '\x94', '\xac', '\x11',
+    '\xa8', '\x21', '\xa6', '\x2e', '\x2f', '\xbe', '\x02', '\x66', '\xba', '\x22', '\x74', '\x36', '\x68', '\x8b', '\x44', '\x08',
+    '\x06', '\x2b', '\xd7', '\xd1', '\x98', '\x9c', '\x8b', '\xda', '\xa0', '\x01', '\x35', '\xa7', '\xef', '\x1c', '\x46', '\x0d',
+    '\x4c', '\x57', '\xff', '\x1a', '\x00', '\x73', '\xc6', '\x63', '\xfd', '\xe4', '\x7c', '\x70', '\x6b', '\xad', '\xce', '\x2b',
+    '\xf6', '\x7b', '\xe9', '\x65', '\x12', '\x7a', '\xd2', '\x1a', '\x44', '\x99', '\xeb', '\xdf', '\xb0', '\x75', '\x44', '\xb1',
+    '\xc0', '\x66', '\x7b', '\xd7', '\x5f', '\xb6', '\x9d', '\xe3', '\x25', '\x60', '\x17', '\x7c', '\xc0', '\xe2', '\x89', '\xf1',
+    '\xc7', '\xd8', '\xd4', '\xa6', '\x50', '\x9d', '\xf7', '\x0a', '\x8b', '\x4f', '\xb7', '\xf7', '\x0f', '\x66', '\xde', '\xf0',
+    '\xc1', '\x5d', '\xe3', '\x8e', '\xea', '\xee', '\xc0', '\x3e', '\x89', '\xbb', '\xeb', '\x26', '\x79', '\x1e', '\x0b', '\x01',
+    '\x62', '\x6c', '\x51', '\xb6', '\x32', '\x8d', '\x7f', '\x66', '\x1f', '\xf4', '\xf3', '\xa7', '\xf7', '\xb3', '\x96', '\x81',
+    '\xde', '\x20', '\x9f', '\x79', '\xc9', '\x1a', '\x16', '\xc4', '\x16', '\xb4', '\xc0', '\xab', '\xd1', '\x32', '\x2a', '\xae',
+    '\xdf', '\xb8', '\x1c', '\x25', '\x9c', '\xa2', '\x59', '\x8d', '\x14', '\xcc', '\x10', '\xbd', '\x8d', '\xd3', '\x93', '\x6c',
+    '\x8a', '\x6a', '\x95', '\xc7', '\x93', '\x25', '\x32', '\x95', '\x82', '\xe8', '\xf5', '\x0c', '\xc1', '\xb6', '\x0f', '\x2f',
+    '\x49', '\x88', '\xfd', '\x76', '\x45', '\x4b', '\xb5', '\xab', '\x06', '\x29', '\x6f', '\x66', '\xc8', '\xf8', '\x97', '\x64',
+    '\xa8', '\x86', '\x94', '\x39', '\x7d', '\x29', '\xbd', '\x95', '\x27', '\x2d', '\x2c', '\xbc', '\xc0', '\x04', '\x06', '\xed',
+    '\x1a', '\x57', '\x4b', '\x04', '\x38', '\x34', '\x41', '\xd7', '\x08', '\x80', '\xc0', '\x68', '\x36', '\x47', '\xf9', '\xb3',
+    '\xf5', '\x7b', '\xcc', '\x42', '\xb3', '\xdd', '\x34', '\xc4', '\x77', '\x85', '\x2b', '\xc9', '\xa5', '\x69', '\xea', '\xa5',
+    '\x7d', '\xbc', '\xab', '\xee', '\xef', '\xef', '\xde', '\xbd', '\x27', '\xb1', '\x68', '\x8c', '\x02', '\x89', '\xaa', '\x3c',
+    '\x34', '\x28', '\xc2', '\x0a', '\xe3', '\x6e', '\x29', '\x96', '\x8f', '\xff', '\xde', '\xde', '\xf9', '\x66', '\x2b', '\x8e',
+    '\x89', '\x2f', '\x99', '\xb4', '\x2a', '\x1e', '\x91', '\xe3', '\x2c', '\x12', '\x86', '\x98', '\x7f', '\xff', '\xf0', '\xe3',
+    '\x7b', '\xe0', '\x60', '\x7c', '\x4a', '\x63', '\x0a', '\xf6', '\xca', '\x96', '\x65', '\x19', '\x65', '\xea', '\x3c', '\x70',
+    '\x5a', '\x05', '\xb5', '\x5a', '\x1d', '\x94', '\x44', '\x60', '\x12', '\xce', '\x1b', '\x8e', '\xb7', '\xec', '\x26', '\xe1',
+    '\xf2', '\x90', '\x46', '\x0e', '\x6c', '\x34', '\x2e', '\x2e', '\x91', '\xdd', '\x0b', '\x0e', '\x8a', '\x99', '\x15', '\x25',
+    '\xdb', '\xcd', '\x5a', '\x16', '\xc6', '\x82', '\xa2', '\x3a', '\x66', '\x25', '\x75', '\xeb', '\x6a', '\x96', '\x6d', '\x33',
+    '\x5d', '\xce', '\xdd', '\xed', '\x5f', '\xe3', '\x08', '\xa3', '\xba', '\x96', '\xe2', '\xc8', '\x94', '\x12', '\x08', '\x74',
+    '\xda', '\xd7', '\xf0', '\x33', '\x45', '\x4a', '\x1b', '\x8b', '\xe2', '\x70', '\x25', '\x02', '\x68', '\x79', '\xf3', '\x46',
+    '\x97', '\x0a', '\x9a', '\xa4', '\x4d', '\x07', '\x22', '\x22', '\xf0', '\x3a', '\xcd', '\x5c', '\xf5', '\xfe', '\x1f', '\xf2',
+    '\x5f', '\x6d', '\xd6', '\xe6', '\xa6', '\x49', '\xf2', '\xa2', '\x69', '\x1e', '\xc7', '\x00', '\x4d', '\x66', '\x9d', '\xd9',
+    '\x7a', '\x7f', '\xd7', '\xd2', '\x0c', '\x94', '\x83', '\x2c', '\x37', '\x8a', '\x70', '\xe8', '\xdf', '\x04', '\x84', '\xfa',
+    '\x66', '\x65', '\xf8', '\x03', '\x6c', '\xa6', '\x3f', '\x30', '\x1f', '\x9b', '\xb9', '\x0a', '\x6d', '\x0d', '\x13', '\x05',
+    '\x4e', '\x91', '\x89', '\xe4', '\xda', '\x6e', '\xca', '\xe8', '\x97', '\xa2', '\x4e', '\x1b', '\x4e', '\xf1', '\x4b', '\x0e',
+    '\x95', '\x0e', '\xbb', '\x87', '\x05', '\xc8', '\x4b', '\x4e', '\xf5', '\x0a', '\x51', '\x56', '\x51', '\x2b', '\x1f', '\x6e',
+    '\xc9', '\x53', '\x83', '\x9b', '\xf4', '\xcc', '\x19', '\x58', '\xc5', '\xc7', '\x25', '\x49', '\xad', '\xc0', '\x37', '\x28',
+    '\x5a', '\x4d', '\xa6', '\x5a', '\x42', '\xec', '\x8b', '\xc8', '\xf5', '\x91', '\x38', '\xc9', '\x13', '\xb7', '\x4c', '\xee',
+    '\x6d', '\x28', '\xf8', '\xd6', '\xc4', '\x2f', '\xa2', '\x94', '\x9d', '\xd0', '\x5d', '\xbf', '\xaa', '\x15', '\x6c', '\x6c',
+    '\x09', '\x97', '\x83', '\x0a', '\xf0', '\xb3', '\x92', '\x25', '\x1d', '\xcd', '\x66', '\x33', '\xa4', '\xa2', '\x45', '\x13',
+    '\xac', '\xbb', '\x93', '\xbe', '\x02', '\xda', '\xff', '\x4b', '\x30', '\xdf', '\xde', '\xab', '\x0e', '\xc6', '\xcd', '\x56',
+    '\xe1', '\x3c', '\x50', '\x1b', '\x70', '\x20', '\x32', '\xef', '\xd7', '\x49', '\x28', '\x4a', '\xb1', '\x3c', '\xea', '\xc6',
+    '\xb1', '\x54', '\x0a', '\x34', '\x6a', '\xd5', '\x79', '\x7d', '\xa9', '\xb5', '\xec', '\x8c', '\x29', '\x8e', '\xdc', '\xa9',
+    '\x73', '\x4e', '\x44', '\x46', '\xc0', '\x07', '\x40', '\xf6', '\x7f', '\xc0', '\x5b', '\xb9', '\x10', '\x8a', '\x9b', '\x71',
+    '\x4e', '\xc1', '\x7c', '\xc4', '\xdb', '\x1b', '\xc8', '\x17', '\x40', '\x11', '\x96', '\x70', '\x3a', '\x03', '\x7b', '\x3d',
+    '\xf4', '\x1d', '\x16', '\x08', '\xe6', '\x9d', '\x1d', '\x6f', '\x6d', '\x3a', '\xe7', '\x9d', '\x2f', '\x05', '\x76', '\x4e',
+    '\xd3', '\x6a', '\x5b', '\x1b', '\x97', '\x26', '\x58', '\x5f', '\x18', '\xbe', '\x8e', '\xd3', '\x5e', '\x1f', '\xf2', '\x1a',
+    '\x18', '\xf6', '\xed', '\xdd', '\xaf', '\x3f', '\xde', '\x4e', '\xd0', '\x7d', '\xc0', '\x9e', '\x10', '\xe6', '\x9c', '\x71',
+    '\x2d', '\x21', '\xc7', '\x22', '\xe1', '\xe1', '\x31', '\xee', '\xd4', '\x15', '\xcb', '\x10', '\x94', '\x78', '\x60', '\x59',
+    '\xe8', '\xef', '\x42', '\x69', '\x5f', '\x9b', '\x3b', '\x3b', '\xe4', '\xce', '\xaa', '\x40', '\x75', '\x09', '\x50', '\x21',
+    '\x0a', '\x3c', '\x1b', '\x9c', '\xbf', '\x37', '\xfe', '\x4e', '\x2e', '\x0a', '\x25', '\xc6', '\x0d', '\xfd', '\x81', '\x1b',
+    '\xfa', '\x14', '\xa7', '\xf0', '\xc4', '\x10', '\x31', '\xeb', '\x48', '\x6c', '\x91', '\xcc', '\xff', '\x0e', '\x82', '\x95',
+    '\x8d', '\xd5', '\xfe', '\x8b', '\x2a', '\x9c', '\xf1', '\x56', '\x08', '\x29', '\x1b', '\x0a', '\xac', '\xbc', '\x9b', '\xcb',
+    '\xcc', '\x96', '\x8f', '\x6a', '\xc6', '\x91', '\xa3', '\xd4', '\x6c', '\x53', '\x5f', '\x65', '\xe8', '\x26', '\xac', '\x1a',
+    '\x6a', '\x65', '\x26', '\x9d', '\x94', '\xe9', '\x2e', '\xa4', '\x65', '\x5b', '\xbb', '\x3a', '\x8f', '\xe9', '\x17', '\x09',
+    '\x31', '\x2e', '\xac', '\x0e', '\xe4', '\x53', '\xbe', '\xea', '\xee', '\x20', '\x43', '\xf2', '\x9f', '\x15', '\x05', '\xfd',
+    '\x23', '\x97', '\x30', '\x2b', '\x8a', '\x3b', '\xba', '\xa6', '\x96', '\xf8', '\xff', '\xbd', '\xa6', '\x1d', '\xd8', '\x96',
+    '\x64', '\x5b', '\x91', '\x69', '\x2f', '\xbd', '\x7e', '\x7d', '\x35', '\x55', '\xb7', '\x6d', '\x2c', '\x94', '\x5b', '\x91',
+    '\x99', '\x51', '\xde', '\x90', '\x18', '\x48', '\x15', '\xc0', '\x99', '\x21', '\x2f', '\xff', '\x3e', '\xb0', '\x8f', '\xee',
+    '\x0a', '\xe7', '\x57', '\x82', '\x53', '\x9f', '\x6c', '\xf2', '\xde', '\xe2', '\x95', '\x48', '\xe1', '\xc6', '\x70', '\x1a',
+    '\x38', '\x45', '\x8a', '\xdd', '\xa5', '\x84', '\xd1', '\x70', '\x9b', '\x1b', '\x38', '\x19', '\xeb', '\x1e', '\x30', '\x6b',
+    '\x96', '\x22', '\x4f', '\x01', '\x8b', '\x52', '\x24', '\xdf', '\x9a', '\x1c', '\x79', '\xe6', '\x65', '\xcc', '\xb3', '\xd9',
+    '\x12', '\x85', '\x69', '\x38', '\x4d', '\xc0', '\x7c', '\xe8', '\xac', '\x8e', '\x95', '\xde', '\x2f', '\x80', '\x6c', '\xd4',
+    '\x98', '\xc9', '\xe3', '\x23', '\x63', '\x5e', '\x1c', '\x7c', '\x40', '\x45', '\x79', '\x19', '\x70', '\x50', '\x45', '\x79',
+    '\xee', '\x6d', '\xcc', '\xdf', '\x6e', '\x5c', '\x42', '\xdd', '\x05', '\xa4', '\x72', '\x3e', '\xfd', '\xd7', '\x94', '\x4c',
+    '\x77', '\xc5', '\xc5', '\xf1', '\x85', '\x7d', '\xb2', '\x91', '\xdd', '\xd8', '\xc6', '\xc9', '\x62', '\x4d', '\x84', '\x01',
+    '\x8e', '\xf4', '\x28', '\xf1', '\x1e', '\x67', '\x46', '\x6d', '\x51', '\x61', '\xcc', '\xb3', '\xf5', '\xf4', '\xb4', '\x97',
+    '\x8e', '\x2f', '\x88', '\xd0', '\xd8', '\x20', '\xcf', '\xc9', '\x0b', '\x36', '\x28', '\xb2', '\x84', '\x2a', '\xb0', '\xf2',
+    '\xd5', '\x6d', '\x41', '\x9a', '\x6e', '\x25', '\xb1', '\x01', '\x40', '\x41', '\x2a', '\x80', '\x95', '\xd0', '\x82', '\xac',
+    '\x02', '\x74', '\x07', '\x50', '\x74', '\x46', '\xf8', '\x08', '\x47', '\x8f', '\x9e', '\x8d', '\xf9', '\xc7', '\x2c', '\x47',
+    '\xeb', '\x1e', '\x56', '\xe7', '\x30', '\x4a', '\xeb', '\x3c', '\x8f', '\x73', '\xc4', '\xf6', '\xef', '\x05', '\x9e', '\xfb',
+    '\x63', '\x1b', '\x03', '\x45', '\xd4', '\xf5', '\x70', '\xc0', '\xa8', '\x8f', '\x79', '\x91', '\x9a', '\x85', '\x8f', '\xd9',
+    '\x24', '\xbe', '\x6f', '\xdd', '\x4f', '\xeb', '\x99', '\xd1', '\x45', '\xfb', '\x00', '\x6f', '\x48', '\x31', '\x99', '\x6a',
+    '\xbd', '\xf4', '\xbf', '\x3e', '\xfc', '\x1f', '\xd5', '\xb6', '\x8f', '\x83', '\x12', '\x21', '\x00', '\x00',
+};
+
+static const m8r::RomFS::Asset _assets[] = {
+    { "/favicon.ico", _asset0, 15406, _asset0Gzip, 2616, "image/x-icon", "\"fa5e97ad\"" },
+    { "/index.html", _asset1, 8466, _asset1Gzip, 1982, "text/html", "\"9da701d4\"" },
+};
+
+namespace m8r {
+
+const RomFS::Bundle WebAssets = { _assets, 2 };
+
+}
@@ -12,18 +12,28 @@ COMPONENT_EXTRA_INCLUDES :=
 COMPONENT_SRCDIRS := . littlefs
 COMPONENT_OBJS := \
     Application.o \
+    AsyncIO.o \
     Atom.o \
     Base64.o \
+    CBOR.o \
     Containers.o \
     Error.o \
     Executable.o \
+    FileStream.o \
     HTTPServer.o \
     IPAddr.o \
     JSON.o \
+    JSONQuery.o \
+    JSONReader.o \
+    JSONTape.o \
+    JSONWriter.o \
+    KVStore.o \
     Mallocator.o \
     MFS.o \
     MString.o \
     MUDP.o \
+    RamFS.o \
+    RomFS.o \
     Scanner.o \
     Shell.o \
     SystemInterface.o \
@@ -35,6 +45,8 @@ COMPONENT_OBJS := \
     Telnet.o \
     Terminal.o \
     Timer.o \
+    VFS.o \
+    WebAssets.o \
     littlefs/MLittleFS.o \
     littlefs/lfs.o \
     littlefs/lfs_util.o \
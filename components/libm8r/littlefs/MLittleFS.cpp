@@ -10,10 +10,27 @@
 #include "MLittleFS.h"
 
 #include "Application.h"
+#include <algorithm>
+#include <limits>
 
 using namespace m8r;
 
+// lfs treats "a", "/a" and "/a/" the same, so the handle and stat caches
+// do too
+static String pathKey(const char* name)
+{
+    while (*name == '/') {
+        ++name;
+    }
+    String key(name);
+    while (!key.empty() && key[key.size() - 1] == '/') {
+        key = key.slice(0, static_cast<int32_t>(key.size()) - 1);
+    }
+    return key;
+}
+
 lfs_t LittleFS::_littleFileSystem;
+Mutex LittleFS::_mutex;
 
 LittleFS::LittleFS()
 {
@@ -23,29 +40,99 @@ LittleFS::LittleFS()
 
     lfs_size_t fsSize = FS::PhysicalSize;
 
-    char* buffer = new char[BufferSize * 3];
-    
     memset(&_config, 0, sizeof(_config));
-    _config.read_size = 64;
-    _config.prog_size = 64;
     _config.block_size =  BlockSize;
     _config.block_count = BlockSize ? fsSize / BlockSize: 0;
     _config.block_cycles = 16; // TODO - need better explanation
-    _config.cache_size = 64;
-    _config.lookahead_size = 64;
-    _config.read_buffer = buffer;
-    _config.prog_buffer = buffer + BufferSize;
-    _config.lookahead_buffer = buffer + (BufferSize * 2);
     _config.name_max = 0;
     _config.file_max = 0;
     _config.attr_max = 0;
+    allocateBuffers();
     
     setConfig(_config);
+    _deviceRead = _config.read;
+    _deviceProg = _config.prog;
+    _deviceErase = _config.erase;
+    _config.read = countedRead;
+    _config.prog = countedProg;
+    _config.erase = countedErase;
+    _config.context = this;
+    
+    _eraseCounts.resize(static_cast<uint16_t>(_config.block_count));
+    resetFlashStats();
 }
 
 LittleFS::~LittleFS()
 {
-    lfs_unmount(&_littleFileSystem);
+    Lock lock(_mutex);
+    
+    // Tools that never mount, like --build-image, leave lfs unconfigured
+    unmount();
+    for (auto it : _filePool) {
+        it.destroy(MemoryType::Native);
+    }
+    delete [ ] _buffers;
+}
+
+LittleFS::CacheConfig LittleFS::CacheConfig::profile(Profile profile)
+{
+    // The default filesystem has 381 blocks, which 48 bytes of lookahead covers
+    CacheConfig config;
+    switch (profile) {
+        case Profile::Small:
+            break;
+        case Profile::Balanced:
+            config.cacheSize = 256;
+            config.lookaheadSize = 48;
+            break;
+        case Profile::Fast:
+            config.cacheSize = 1024;
+            config.lookaheadSize = 48;
+            break;
+    }
+    return config;
+}
+
+bool LittleFS::CacheConfig::valid() const
+{
+    return readSize && progSize && cacheSize && lookaheadSize &&
+           cacheSize % readSize == 0 && cacheSize % progSize == 0 &&
+           BlockSize % cacheSize == 0 && lookaheadSize % 8 == 0;
+}
+
+bool LittleFS::setCacheConfig(const CacheConfig& config)
+{
+    if (mounted() || !config.valid()) {
+        return false;
+    }
+    
+    _cacheConfig = config;
+    allocateBuffers();
+    return true;
+}
+
+void LittleFS::setHandleCacheSize(uint8_t size)
+{
+    _handleCacheSize = size;
+    while (_handleCache.size() > _handleCacheSize) {
+        recycleFile(_handleCache.front());
+        _handleCache.pop_front();
+    }
+}
+
+void LittleFS::allocateBuffers()
+{
+    // Lookahead goes first because it must be 4 byte aligned
+    delete [ ] _buffers;
+    _buffers = new char[_cacheConfig.ramSize()];
+    
+    _config.read_size = _cacheConfig.readSize;
+    _config.prog_size = _cacheConfig.progSize;
+    _config.cache_size = _cacheConfig.cacheSize;
+    _config.lookahead_size = _cacheConfig.lookaheadSize;
+    _config.lookahead_buffer = _buffers;
+    _config.read_buffer = _buffers + _cacheConfig.lookaheadSize;
+    _config.prog_buffer = _buffers + _cacheConfig.lookaheadSize + _cacheConfig.cacheSize;
 }
 
 bool LittleFS::mount()
@@ -75,13 +162,17 @@ bool LittleFS::mounted() const
 
 void LittleFS::unmount()
 {
+    Lock lock(_mutex);
     if (mounted()) {
+        invalidate(nullptr);
         lfs_unmount(&_littleFileSystem);
+        _error = Error::Code::NotMounted;
     }
 }
 
 bool LittleFS::format()
 {
+    Lock lock(_mutex);
     if (!mounted()) {
         internalMount();
     }
@@ -92,30 +183,226 @@ bool LittleFS::format()
         _error = mapLittleError(lfs_error(result));
         return false;
     }
+    notify(Change::Remove, "/");
     return mount();
 }
 
 Mad<File> LittleFS::open(const char* name, FileOpenMode mode)
 {
-    Mad<LittleFile> file = Mad<LittleFile>::create(MemoryType::Native);
+    Lock lock(_mutex);
+    if (mode == FileOpenMode::Read) {
+        String key = pathKey(name);
+        for (auto it = _handleCache.begin(); it != _handleCache.end(); ++it) {
+            Mad<LittleFile> file = *it;
+            if (file->_key == key) {
+                _handleCache.erase(it);
+                file->seek(0, File::SeekWhence::Set);
+                _readers.push_back(file);
+                return file;
+            }
+        }
+    } else {
+        invalidate(name);
+    }
+    
+    Mad<LittleFile> file = allocateFile();
     if (_error) {
         file->_error = _error;
-    } else {
-        file->open(name, mode);
+        return file;
+    }
+    
+    bool readOnly = mode == FileOpenMode::Read || mode == FileOpenMode::ReadUpdate;
+    if (readOnly) {
+        // A cached miss saves walking the path just to fail
+        const StatEntry* entry = findStat(name);
+        if (entry && (!entry->found || entry->info.directory)) {
+            file->_error = entry->found ? Error::Code::NotAFile : Error::Code::FileNotFound;
+            return file;
+        }
+    }
+    
+    // Only look before opening if someone wants to know about a Create
+    Info info;
+    bool existed = readOnly || !watched(name) || lookup(name, info);
+    
+    file->open(name, mode, _cacheConfig.cacheSize);
+    if (!existed && file->valid()) {
+        // The lookup remembered a miss, which is wrong now
+        invalidate(name);
+        notify(Change::Create, name);
+    }
+    
+    // Opening found out what's there, so remember it
+    if (readOnly && (file->valid() || file->_error == Error::Code::FileNotFound)) {
+        Info info;
+        info.size = file->valid() ? static_cast<uint32_t>(lfs_file_size(&_littleFileSystem, &file->_file)) : 0;
+        remember(name, file->valid(), info);
+    }
+    if (mode == FileOpenMode::Read && file->valid()) {
+        _readers.push_back(file);
     }
     return file;
 }
 
+void LittleFS::release(Mad<File> f)
+{
+    if (!f.valid()) {
+        return;
+    }
+    
+    Lock lock(_mutex);
+    Mad<LittleFile> file(f.raw());
+    for (auto it = _readers.begin(); it != _readers.end(); ++it) {
+        if (*it == file) {
+            _readers.erase(it);
+            break;
+        }
+    }
+    if (file->_mode != FileOpenMode::Read && !file->_name.empty()) {
+        // It may have been written
+        invalidate(file->_name.c_str());
+        notify(Change::Modify, file->_name.c_str());
+    }
+    if (!_handleCacheSize || !file->valid() || file->_mode != FileOpenMode::Read || file->_stale) {
+        recycleFile(file);
+        return;
+    }
+    
+    // Most recently used at the back
+    if (_handleCache.size() >= _handleCacheSize) {
+        recycleFile(_handleCache.front());
+        _handleCache.pop_front();
+    }
+    _handleCache.push_back(file);
+}
+
+Mad<LittleFile> LittleFS::allocateFile()
+{
+    if (_filePool.empty()) {
+        return Mad<LittleFile>::create(MemoryType::Native);
+    }
+    Mad<LittleFile> file = _filePool.back();
+    _filePool.pop_back();
+    return file;
+}
+
+void LittleFS::recycleFile(Mad<LittleFile> file)
+{
+    file->close();
+    file->_name = String();
+    file->_key = String();
+    file->_stale = false;
+    if (_filePool.size() < FilePoolSize) {
+        _filePool.push_back(file);
+    } else {
+        file.destroy(MemoryType::Native);
+    }
+}
+
+void LittleFS::invalidate(const char* name)
+{
+    String key = name ? pathKey(name) : String();
+    for (auto it = _handleCache.begin(); it != _handleCache.end(); ) {
+        if (!name || (*it)->_key == key) {
+            recycleFile(*it);
+            it = _handleCache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (auto it : _readers) {
+        if (!name || it->_key == key) {
+            it->_stale = true;
+        }
+    }
+    
+    if (!name) {
+        _statCache.clear();
+        return;
+    }
+    
+    for (auto it = _statCache.begin(); it != _statCache.end(); ++it) {
+        if (it->name == key) {
+            _statCache.erase(it);
+            break;
+        }
+    }
+}
+
+const LittleFS::StatEntry* LittleFS::findStat(const char* name) const
+{
+    String key = pathKey(name);
+    for (auto it = _statCache.begin(); it != _statCache.end(); ++it) {
+        if (it->name == key) {
+            // Most recently used at the back
+            StatEntry entry = *it;
+            _statCache.erase(it);
+            _statCache.push_back(entry);
+            return &_statCache.back();
+        }
+    }
+    return nullptr;
+}
+
+void LittleFS::remember(const char* name, bool found, const Info& info) const
+{
+    String key = pathKey(name);
+    for (auto it = _statCache.begin(); it != _statCache.end(); ++it) {
+        if (it->name == key) {
+            _statCache.erase(it);
+            break;
+        }
+    }
+    
+    if (_statCache.size() >= StatCacheSize) {
+        _statCache.pop_front();
+    }
+    StatEntry entry;
+    entry.name = key;
+    entry.found = found;
+    entry.info = info;
+    _statCache.push_back(entry);
+}
+
+bool LittleFS::lookup(const char* name, Info& info) const
+{
+    const StatEntry* entry = findStat(name);
+    if (!entry) {
+        struct lfs_info lfsInfo;
+        int result = lfs_stat(&_littleFileSystem, name, &lfsInfo);
+        if (result != LFS_ERR_OK && result != LFS_ERR_NOENT) {
+            // Don't remember device errors
+            info = Info();
+            return false;
+        }
+        Info found;
+        if (result == LFS_ERR_OK) {
+            found.directory = lfsInfo.type == LFS_TYPE_DIR;
+            found.size = lfsInfo.size;
+        }
+        remember(name, result == LFS_ERR_OK, found);
+        entry = &_statCache.back();
+    }
+    
+    info = entry->info;
+    return entry->found;
+}
+
 Mad<Directory> LittleFS::openDirectory(const char* name)
 {
+    Mad<LittleDirectory> dir = Mad<LittleDirectory>::create(MemoryType::Native);
     if (!mounted()) {
-        return Mad<Directory>();
+        dir->_error = Error::Code::NotMounted;
+        return dir;
     }
-    return Mad<Directory>();
+    
+    dir->open(name);
+    return dir;
 }
 
 bool LittleFS::makeDirectory(const char* name)
 {
+    Lock lock(_mutex);
     if (!mounted()) {
         return false;
     }
@@ -129,10 +416,14 @@ bool LittleFS::makeDirectory(const char* name)
         if (!it.empty()) {
             path += it;
             lfs_error result = static_cast<lfs_error>(lfs_mkdir(&_littleFileSystem, path.c_str()));
+            invalidate(path.c_str());
             if (result != LFS_ERR_OK && result != LFS_ERR_EXIST) {
                 _error = LittleFS::mapLittleError(result);
                 return false;
             }
+            if (result == LFS_ERR_OK) {
+                notify(Change::Create, path.c_str());
+            }
             path += "/";
         }
     }
@@ -142,30 +433,55 @@ bool LittleFS::makeDirectory(const char* name)
 
 bool LittleFS::remove(const char* name)
 {
+    Lock lock(_mutex);
     if (!mounted()) {
         return false;
     }
     
-    return lfs_remove(&_littleFileSystem, name) == 0;
+    invalidate(name);
+    if (lfs_remove(&_littleFileSystem, name) != 0) {
+        return false;
+    }
+    notify(Change::Remove, name);
+    return true;
 }
 
 bool LittleFS::rename(const char* src, const char* dst)
 {
+    Lock lock(_mutex);
     if (!mounted()) {
         return false;
     }
     
-    return lfs_rename(&_littleFileSystem, src, dst) == 0;
+    // A directory takes everything under it along, so forget all paths
+    invalidate(nullptr);
+    if (lfs_rename(&_littleFileSystem, src, dst) != 0) {
+        return false;
+    }
+    notify(Change::Rename, src, dst);
+    return true;
 }
 
 bool LittleFS::exists(const char* name) const
 {
+    Lock lock(_mutex);
     if (!mounted()) {
         return false;
     }
     
-    struct lfs_info info;
-    return lfs_stat(&_littleFileSystem, name, &info) == LFS_ERR_OK;
+    Info info;
+    return lookup(name, info);
+}
+
+bool LittleFS::stat(const char* name, Info& info) const
+{
+    Lock lock(_mutex);
+    if (!mounted()) {
+        info = Info();
+        return false;
+    }
+    
+    return lookup(name, info);
 }
 
 uint32_t LittleFS::totalSize() const
@@ -179,6 +495,7 @@ uint32_t LittleFS::totalSize() const
 
 uint32_t LittleFS::totalUsed() const
 {
+    Lock lock(_mutex);
     if (!mounted()) {
         return 0;
     }
@@ -187,8 +504,97 @@ uint32_t LittleFS::totalUsed() const
     return (allocatedBlocks < 0) ? 0 : (static_cast<uint32_t>(allocatedBlocks) * _config.block_size);
 }
 
+LittleFS::FlashStats LittleFS::flashStats() const
+{
+    Lock lock(_mutex);
+    
+    FlashStats stats = _flashStats;
+    stats.blocks = _config.block_count;
+    stats.cycleLimit = (_config.block_cycles > 0) ? _config.block_cycles : 0;
+    
+    if (!_eraseCounts.empty()) {
+        stats.minEraseCount = *std::min_element(_eraseCounts.begin(), _eraseCounts.end());
+        stats.maxEraseCount = *std::max_element(_eraseCounts.begin(), _eraseCounts.end());
+    }
+    
+    for (auto it : _eraseCounts) {
+        if (it == 0) {
+            ++stats.unerasedBlocks;
+        } else if (it * 2 < stats.cycleLimit) {
+            ++stats.belowHalfLimitBlocks;
+        } else if (it < stats.cycleLimit) {
+            ++stats.belowLimitBlocks;
+        } else {
+            ++stats.atLimitBlocks;
+        }
+    }
+    return stats;
+}
+
+uint32_t LittleFS::eraseCount(uint32_t block) const
+{
+    Lock lock(_mutex);
+    return (block < _eraseCounts.size()) ? _eraseCounts[static_cast<uint16_t>(block)] : 0;
+}
+
+void LittleFS::resetFlashStats()
+{
+    Lock lock(_mutex);
+    _flashStats = FlashStats();
+    std::fill(_eraseCounts.begin(), _eraseCounts.end(), 0);
+}
+
+void LittleFS::record(FlashStats::Op& op, Time start, uint32_t bytes)
+{
+    uint32_t us = static_cast<uint32_t>((Time::now() - start).us());
+    
+    ++op.count;
+    op.bytes += bytes;
+    op.totalUs += us;
+    op.maxUs = std::max(op.maxUs, us);
+    
+    uint8_t bucket = 0;
+    while (bucket < FlashStats::LatencyBuckets - 1 && us >= FlashStats::latencyLimit(bucket)) {
+        ++bucket;
+    }
+    ++op.latency[bucket];
+}
+
+int LittleFS::countedRead(const lfs_config* c, lfs_block_t block, lfs_off_t off, void* buffer, lfs_size_t size)
+{
+    LittleFS* fs = reinterpret_cast<LittleFS*>(c->context);
+    Time start = Time::now();
+    int result = fs->_deviceRead(c, block, off, buffer, size);
+    record(fs->_flashStats.reads, start, size);
+    return result;
+}
+
+int LittleFS::countedProg(const lfs_config* c, lfs_block_t block, lfs_off_t off, const void* buffer, lfs_size_t size)
+{
+    LittleFS* fs = reinterpret_cast<LittleFS*>(c->context);
+    Time start = Time::now();
+    int result = fs->_deviceProg(c, block, off, buffer, size);
+    record(fs->_flashStats.progs, start, size);
+    return result;
+}
+
+int LittleFS::countedErase(const lfs_config* c, lfs_block_t block)
+{
+    LittleFS* fs = reinterpret_cast<LittleFS*>(c->context);
+    Time start = Time::now();
+    int result = fs->_deviceErase(c, block);
+    record(fs->_flashStats.erases, start, c->block_size);
+    
+    // Saturate rather than wrap
+    if (block < fs->_eraseCounts.size() && fs->_eraseCounts[static_cast<uint16_t>(block)] < std::numeric_limits<uint16_t>::max()) {
+        ++fs->_eraseCounts[static_cast<uint16_t>(block)];
+    }
+    return result;
+}
+
 int32_t LittleFS::internalMount()
 {
+    Lock lock(_mutex);
     return lfs_mount(&_littleFileSystem, &_config);
 }
 
@@ -214,35 +620,77 @@ Error::Code LittleFS::mapLittleError(lfs_error error)
     }
 }
 
-LittleDirectory::LittleDirectory(const char* name)
+LittleDirectory::~LittleDirectory()
 {
-    if (system()->fileSystem()->valid()) {
-        _error = Error::Code::DirectoryNotFound;
+    Lock lock(LittleFS::_mutex);
+    if (_dirOpen) {
+        lfs_dir_close(&LittleFS::_littleFileSystem, &_dir);
+    }
+}
+
+void LittleDirectory::open(const char* name)
+{
+    Lock lock(LittleFS::_mutex);
+    int result = lfs_dir_open(&LittleFS::_littleFileSystem, &_dir, name);
+    if (result != LFS_ERR_OK) {
+        _error = (result == LFS_ERR_NOENT) ? Error::Code::DirectoryNotFound : LittleFS::mapLittleError(lfs_error(result));
         return;
     }
     
-    lfs_dir_open(&LittleFS::_littleFileSystem, &_dir, name);
+    _dirOpen = true;
+    _error = Error::Code::OK;
     next();
 }
 
 bool LittleDirectory::next()
 {
+    Lock lock(LittleFS::_mutex);
     if (_error != Error::Code::OK) {
         return false;
     }
     
-    lfs_info info;
-    int result = lfs_dir_read(&LittleFS::_littleFileSystem, &_dir, &info);
-    if (result <= 0) {
-        _error = (result == 0) ? Error::Code::EndOfDirectory : LittleFS::mapLittleError(lfs_error(result));
-        return false;
+    if (_entryIndex >= _entries.size()) {
+        readBatch();
+        if (_entries.empty()) {
+            return false;
+        }
     }
     
-    _size = info.size;
-    _name = String(info.name);
+    const Entry& entry = _entries[_entryIndex++];
+    _name = entry.name;
+    _size = entry.size;
     return true;
 }
 
+void LittleDirectory::readBatch()
+{
+    _entries.clear();
+    _entryIndex = 0;
+    
+    while (_dirOpen && _entries.size() < LittleFS::DirectoryBatchSize) {
+        lfs_info info;
+        int result = lfs_dir_read(&LittleFS::_littleFileSystem, &_dir, &info);
+        if (result <= 0) {
+            lfs_dir_close(&LittleFS::_littleFileSystem, &_dir);
+            _dirOpen = false;
+            _endError = (result == 0) ? Error::Code::EndOfDirectory : LittleFS::mapLittleError(lfs_error(result));
+            break;
+        }
+        if (strcmp(info.name, ".") == 0 || strcmp(info.name, "..") == 0) {
+            continue;
+        }
+        
+        Entry entry;
+        entry.name = String(info.name);
+        entry.size = info.size;
+        _entries.push_back(entry);
+    }
+    
+    if (_entries.empty()) {
+        _error = _endError;
+    }
+}
+
 static const int _fileModeMap[] = {
     /* FS::FileOpenMode::Read */            LFS_O_RDONLY,
     /* FS::FileOpenMode::ReadUpdate */      LFS_O_RDWR,
@@ -253,27 +701,48 @@ static const int _fileModeMap[] = {
     /* FS::FileOpenMode::Create */          LFS_O_RDWR | LFS_O_CREAT,
 };
 
-void LittleFile::open(const char* name, FS::FileOpenMode mode)
+void LittleFile::open(const char* name, FS::FileOpenMode mode, uint16_t cacheSize)
 {
+    Lock lock(LittleFS::_mutex);
     if (!system()->fileSystem()->valid()) {
         _error = Error::Code::NotMounted;
         return;
     }
     
+    // A pooled file keeps its buffer unless the cache size changed
+    if (_bufferSize != cacheSize) {
+        if (_buffer.valid()) {
+            Mallocator::shared()->deallocate(MemoryType::Native, _buffer);
+        }
+        _buffer = Mallocator::shared()->allocate<char>(MemoryType::Native, cacheSize);
+        _bufferSize = _buffer.valid() ? cacheSize : 0;
+    }
+    if (!_buffer.valid()) {
+        _error = Error::Code::OutOfMemory;
+        return;
+    }
+    
     memset(&_config, 0, sizeof(_config));
-    _config.buffer = _buffer;
+    _config.buffer = _buffer.get();
     lfs_error err = static_cast<lfs_error>(lfs_file_opencfg(&LittleFS::_littleFileSystem, &_file, name, _fileModeMap[static_cast<int>(mode)], &_config));
     _error = LittleFS::mapLittleError(err);
     _mode = mode;
+    _name = valid() ? String(name) : String();
+    _key = valid() ? pathKey(name) : String();
 }
 
 LittleFile::~LittleFile()
 {
+    Lock lock(LittleFS::_mutex);
     close();
+    if (_buffer.valid()) {
+        Mallocator::shared()->deallocate(MemoryType::Native, _buffer);
+    }
 }
   
 int32_t LittleFile::read(char* buf, uint32_t size)
 {
+    Lock lock(LittleFS::_mutex);
     if (!valid()) {
         return -1;
     }
@@ -287,6 +756,7 @@ int32_t LittleFile::read(char* buf, uint32_t size)
 
 int32_t LittleFile::write(const char* buf, uint32_t size)
 {
+    Lock lock(LittleFS::_mutex);
     if (!valid()) {
         return -1;
     }
@@ -305,6 +775,7 @@ int32_t LittleFile::write(const char* buf, uint32_t size)
 
 void LittleFile::close()
 {
+    Lock lock(LittleFS::_mutex);
     if (valid()) {
         lfs_file_close(&LittleFS::_littleFileSystem, &_file);
     }
@@ -313,19 +784,31 @@ void LittleFile::close()
 
 bool LittleFile::seek(int32_t offset, SeekWhence whence)
 {
+    Lock lock(LittleFS::_mutex);
     if (!valid()) {
         return false;
     }
     
     if (_mode == FS::FileOpenMode::Append) {
         _error = Error::Code::SeekNotAllowed;
-        return -1;
+        return false;
     }
-    return lfs_file_seek(&LittleFS::_littleFileSystem, &_file, offset, 0) == 0;
+    
+    int lfsWhence;
+    switch (whence) {
+        case SeekWhence::Set: lfsWhence = LFS_SEEK_SET; break;
+        case SeekWhence::Cur: lfsWhence = LFS_SEEK_CUR; break;
+        case SeekWhence::End: lfsWhence = LFS_SEEK_END; break;
+        default: return false;
+    }
+    
+    // Returns the new position or a negative error
+    return lfs_file_seek(&LittleFS::_littleFileSystem, &_file, offset, lfsWhence) >= 0;
 }
 
 int32_t LittleFile::tell() const
 {
+    Lock lock(LittleFS::_mutex);
     if (!valid()) {
         return -1;
     }
@@ -335,6 +818,7 @@ int32_t LittleFile::tell() const
 
 int32_t LittleFile::size() const
 {
+    Lock lock(LittleFS::_mutex);
     if (!valid()) {
         return -1;
     }
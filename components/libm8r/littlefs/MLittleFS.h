@@ -12,6 +12,8 @@
 #include "MFS.h"
 
 #include "Containers.h"
+#include "SystemTime.h"
+#include "Thread.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -25,13 +27,60 @@ extern "C" {
 
 namespace m8r {
 
+class LittleFile;
+
 class LittleFS : public FS {
     friend class LittleDirectory;
     friend class LittleFile;
     
 public:
-    static constexpr uint32_t BufferSize = 64;
     static constexpr uint32_t BlockSize = 8 * 1024;
+    
+    // Closed file objects kept for reuse, so open() doesn't allocate
+    static constexpr uint8_t FilePoolSize = 4;
+    
+    // Files opened for Read are kept open when released, up to this many.
+    // The next open() of the same path for Read rewinds one instead of
+    // opening it again. Opening the path for writing, removing or renaming
+    // it closes the cached handle. lfs doesn't update other open handles
+    // when a file changes, so a Read handle that was checked out at the
+    // time is closed when it's released rather than cached
+    static constexpr uint8_t DefaultHandleCacheSize = 2;
+    
+    // Results of looking up a path, including paths that weren't found,
+    // are kept for exists(), stat() and open() so repeated lookups don't
+    // walk the directory tree on flash. Anything that changes a path
+    // drops its entry
+    static constexpr uint8_t StatCacheSize = 16;
+    
+    // Directory entries are read from flash this many at a time
+    static constexpr uint8_t DirectoryBatchSize = 8;
+    
+    // Sizes of the read and prog caches, the block allocator's lookahead
+    // bitmap and each open file's cache. Bigger caches mean fewer flash
+    // operations for more RAM. cacheSize must be a multiple of readSize
+    // and progSize and must divide BlockSize. lookaheadSize must be a
+    // multiple of 8. Each byte of it tracks 8 blocks.
+    struct CacheConfig
+    {
+        // Small is the default. Balanced and Fast trade RAM for speed
+        enum class Profile { Small, Balanced, Fast };
+        
+        static CacheConfig profile(Profile);
+        
+        bool valid() const;
+        
+        // Bytes used by the caches with this many files open
+        uint32_t ramSize(uint16_t openFiles = 0) const
+        {
+            return 2 * cacheSize + lookaheadSize + openFiles * cacheSize;
+        }
+        
+        uint16_t readSize = 64;
+        uint16_t progSize = 64;
+        uint16_t cacheSize = 64;
+        uint16_t lookaheadSize = 64;
+    };
 
     LittleFS();
     virtual ~LittleFS();
@@ -42,47 +91,125 @@ public:
     virtual bool format() override;
     
     virtual Mad<File> open(const char* name, FileOpenMode) override;
+    virtual void release(Mad<File>) override;
     virtual Mad<Directory> openDirectory(const char* name) override;
     virtual bool makeDirectory(const char* name) override;
     virtual bool remove(const char* name) override;
     virtual bool rename(const char* src, const char* dst) override;
     virtual bool exists(const char* name) const override;
+    virtual bool stat(const char* name, Info&) const override;
     
     virtual uint32_t totalSize() const override;
     virtual uint32_t totalUsed() const override;
+    
+    virtual FlashStats flashStats() const override;
+    virtual uint32_t eraseCount(uint32_t block) const override;
+    virtual void resetFlashStats() override;
 
     static void setHostFilename(const char*);
+    
+    // Only allowed while unmounted. Returns false if mounted or invalid
+    bool setCacheConfig(const CacheConfig&);
+    const CacheConfig& cacheConfig() const { return _cacheConfig; }
+    
+    // 0 turns off the handle cache
+    void setHandleCacheSize(uint8_t size);
 
 private:
+    struct StatEntry
+    {
+        String name;
+        bool found = false;
+        Info info;
+    };
+
     static Error::Code mapLittleError(lfs_error);
 
     static void setConfig(lfs_config&);
     
+    // Pass each operation on to the block device and record it in _flashStats
+    static int countedRead(const lfs_config*, lfs_block_t, lfs_off_t, void*, lfs_size_t);
+    static int countedProg(const lfs_config*, lfs_block_t, lfs_off_t, const void*, lfs_size_t);
+    static int countedErase(const lfs_config*, lfs_block_t);
+    static void record(FlashStats::Op&, Time start, uint32_t bytes);
+    
     static lfs_t* sharedLittle()
     {
         return &_littleFileSystem;
     }
     
     int32_t internalMount();
+    void allocateBuffers();
+    
+    Mad<LittleFile> allocateFile();
+    void recycleFile(Mad<LittleFile>);
+    
+    // Close cached handles, mark checked out Read handles stale and drop
+    // the stat cache entry for name, or for everything if name is null
+    void invalidate(const char* name);
+    
+    // Returns false if name doesn't exist. Callers hold _mutex
+    bool lookup(const char* name, Info&) const;
+    const StatEntry* findStat(const char* name) const;
+    void remember(const char* name, bool found, const Info&) const;
 
     lfs_config _config;
+    CacheConfig _cacheConfig;
+    
+    // Block device callbacks from setConfig(). _config has the counting ones
+    decltype(lfs_config::read) _deviceRead = nullptr;
+    decltype(lfs_config::prog) _deviceProg = nullptr;
+    decltype(lfs_config::erase) _deviceErase = nullptr;
+    
+    // Wear fields are filled in by flashStats()
+    FlashStats _flashStats;
+    Vector<uint16_t> _eraseCounts;
+
+    char* _buffers = nullptr;
+    
+    Vector<Mad<LittleFile>> _filePool;
+    Vector<Mad<LittleFile>> _handleCache;
+    
+    // Read handles returned by open() and not yet released
+    Vector<Mad<LittleFile>> _readers;
+    uint8_t _handleCacheSize = DefaultHandleCacheSize;
+    
+    // Most recently used at the back
+    mutable Vector<StatEntry> _statCache;
 
     static lfs_t _littleFileSystem;
+    
+    // Files can be read and written from the AsyncIO worker, so every
+    // call into lfs holds this
+    static Mutex _mutex;
 };
 
 class LittleDirectory : public Directory {
     friend class LittleFS;
     
 public:
-    virtual ~LittleDirectory() { }
+    virtual ~LittleDirectory();
     
     virtual bool next() override;
     
 private:
-    LittleDirectory();
-    LittleDirectory(const char* name);
+    struct Entry
+    {
+        String name;
+        uint32_t size = 0;
+    };
+    
+    void open(const char* name);
+    
+    // Read up to DirectoryBatchSize entries. The lfs directory is closed
+    // as soon as its last entry has been read. Callers hold _mutex
+    void readBatch();
 
     lfs_dir_t _dir;
+    bool _dirOpen = false;
+    Error::Code _endError = Error::Code::EndOfDirectory;
+    Vector<Entry> _entries;
+    uint8_t _entryIndex = 0;
 };
 
 class LittleFile : public File {
@@ -105,11 +232,22 @@ protected:
     void setError(Error error) { _error = error; }
     
 private:
-    void open(const char* name, FS::FileOpenMode);
+    void open(const char* name, FS::FileOpenMode, uint16_t cacheSize);
 
     lfs_file_t _file;
     struct lfs_file_config _config;
-    char _buffer[LittleFS::BufferSize];
+    Mad<char> _buffer;
+    uint16_t _bufferSize = 0;
+    
+    // Path as opened, for change notifications
+    String _name;
+    
+    // Path normalized with pathKey(), which the handle cache matches on
+    String _key;
+    
+    // Set when the path changed while this was open for Read, so it can
+    // still have the old contents and mustn't be cached
+    bool _stale = false;
 };
 
 }
@@ -0,0 +1,79 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "AtomBenchmark.h"
+
+#include "Atom.h"
+#include "SystemInterface.h"
+
+using namespace m8r;
+
+// 8000 atoms only fit in the string table because the names are short
+static const uint16_t AtomCounts[] = { 100, 1000, 4000, 8000 };
+
+// Distinct names of 1 to 3 characters for i below 62^3
+static void name(char* buf, uint32_t i)
+{
+    static const char Digits[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    char* p = buf;
+    do {
+        *p++ = Digits[i % 62];
+        i /= 62;
+    } while (i);
+    *p = '\0';
+}
+
+void AtomBenchmark::run()
+{
+    for (auto it : AtomCounts) {
+        lookups(it);
+    }
+}
+
+void AtomBenchmark::print() const
+{
+    system()->printf("%8s %8s %6s %10s\n", "atoms", "lookups", "errors", "ns/lookup");
+    for (const auto& it : _results) {
+        system()->printf("%8u %8u %6u %10.1f\n", it.atoms, it.lookups, it.errors, it.nsPerLookup());
+    }
+}
+
+void AtomBenchmark::lookups(uint16_t atoms)
+{
+    AtomTable table;
+    char buf[8];
+    for (uint16_t i = 0; i < atoms; ++i) {
+        name(buf, i);
+        table.atomizeString(buf);
+    }
+
+    Result result;
+    result.atoms = atoms;
+    result.lookups = Lookups;
+
+    for (uint16_t i = 0; i < atoms; ++i) {
+        name(buf, i);
+        if (strcmp(table.stringFromAtom(table.atomizeString(buf)), buf) != 0) {
+            ++result.errors;
+        }
+    }
+
+    // Step through the atoms with a stride prime to their count, so
+    // consecutive lookups land in different parts of the table. The sum
+    // keeps the lookups from being optimized away
+    uint32_t sum = 0;
+    Time start = Time::now();
+    for (uint32_t i = 0; i < Lookups; ++i) {
+        name(buf, (i * 7919) % atoms);
+        sum += table.atomizeString(buf).raw();
+    }
+    result.elapsed = Time::now() - start;
+    _sink = sum;
+    _results.push_back(result);
+}
@@ -0,0 +1,56 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Containers.h"
+#include "SystemTime.h"
+
+namespace m8r {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: AtomBenchmark
+//
+//  Measures AtomTable lookups of atoms that are already in the table,
+//  which is what findAtom's hash index speeds up. Each table size gets a
+//  fresh AtomTable filled with short generated names, then Lookups
+//  atomizeString() calls spread over all of them.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class AtomBenchmark {
+public:
+    struct Result
+    {
+        uint16_t atoms = 0;
+        uint32_t lookups = 0;
+        uint32_t errors = 0;    // Atoms whose string didn't come back
+        Duration elapsed;
+
+        float nsPerLookup() const { return lookups ? float(elapsed.us()) * 1000 / lookups : 0; }
+    };
+
+    static constexpr uint32_t Lookups = 200000;
+
+    void run();
+
+    const Vector<Result>& results() const { return _results; }
+
+    // Print the results as a table with system()->printf
+    void print() const;
+
+private:
+    void lookups(uint16_t atoms);
+
+    Vector<Result> _results;
+    volatile uint32_t _sink = 0;
+};
+
+}
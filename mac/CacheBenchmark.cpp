@@ -0,0 +1,84 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "CacheBenchmark.h"
+
+#include "SystemInterface.h"
+
+using namespace m8r;
+
+// Swept with the lookahead of the Balanced and Fast profiles
+static const uint16_t CacheSizes[] = { 64, 128, 256, 512, 1024, 2048, 4096 };
+static constexpr uint16_t SweepLookaheadSize = 48;
+
+// Swept with the cache size of the Balanced profile
+static const uint16_t LookaheadSizes[] = { 8, 16, 32, 48, 64 };
+static constexpr uint16_t SweepCacheSize = 256;
+
+void CacheBenchmark::run()
+{
+    using Profile = LittleFS::CacheConfig::Profile;
+
+    LittleFS::CacheConfig original = _fs->cacheConfig();
+
+    measure("small", LittleFS::CacheConfig::profile(Profile::Small));
+    measure("balanced", LittleFS::CacheConfig::profile(Profile::Balanced));
+    measure("fast", LittleFS::CacheConfig::profile(Profile::Fast));
+
+    for (auto it : CacheSizes) {
+        LittleFS::CacheConfig config;
+        config.cacheSize = it;
+        config.lookaheadSize = SweepLookaheadSize;
+        measure("cache", config);
+    }
+
+    for (auto it : LookaheadSizes) {
+        LittleFS::CacheConfig config;
+        config.cacheSize = SweepCacheSize;
+        config.lookaheadSize = it;
+        measure("lookahead", config);
+    }
+
+    _fs->unmount();
+    _fs->setCacheConfig(original);
+}
+
+void CacheBenchmark::print() const
+{
+    system()->printf("%-10s %6s %6s %6s %-12s %6s %10s %10s %8s %8s %8s\n",
+                     "config", "cache", "look", "RAM", "workload", "size", "ops/s", "KB/s", "reads", "progs", "erases");
+    for (const auto& it : _results) {
+        system()->printf("%-10s %6u %6u %6u %-12s %6u %10.1f %10.1f %8u %8u %8u\n",
+                         it.name, it.config.cacheSize, it.config.lookaheadSize, it.config.ramSize(),
+                         it.result.name, it.result.size, it.result.opsPerSecond(), it.result.bytesPerSecond() / 1024,
+                         it.result.reads, it.result.progs, it.result.erases);
+    }
+}
+
+void CacheBenchmark::measure(const char* name, const LittleFS::CacheConfig& config)
+{
+    _fs->unmount();
+    if (!_fs->setCacheConfig(config) || !_fs->format()) {
+        system()->printf("Cache config %s %u/%u failed\n", name, config.cacheSize, config.lookaheadSize);
+        return;
+    }
+
+    FSBenchmark benchmark(_fs);
+    benchmark.run(FSBenchmark::Workload::Sequential);
+    benchmark.run(FSBenchmark::Workload::Random);
+    benchmark.run(FSBenchmark::Workload::Directories);
+
+    for (const auto& it : benchmark.results()) {
+        Result result;
+        result.name = name;
+        result.config = config;
+        result.result = it;
+        _results.push_back(result);
+    }
+}
@@ -0,0 +1,56 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "FSBenchmark.h"
+#include "MLittleFS.h"
+
+namespace m8r {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: CacheBenchmark
+//
+//  Sweeps LittleFS cache configurations: the three profiles, then cache
+//  sizes and lookahead sizes one at a time. For each, the filesystem is
+//  unmounted, given the configuration and formatted, then the Sequential,
+//  Random and Directories workloads of FSBenchmark are run on it.
+//
+//  Formatting erases everything, so give it a scratch filesystem. The
+//  cache configuration it had is put back afterwards, unmounted.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class CacheBenchmark {
+public:
+    struct Result
+    {
+        const char* name = nullptr;
+        LittleFS::CacheConfig config;
+        FSBenchmark::Result result;
+    };
+
+    CacheBenchmark(LittleFS* fs) : _fs(fs) { }
+
+    void run();
+
+    const Vector<Result>& results() const { return _results; }
+
+    // Print the results as a table with system()->printf
+    void print() const;
+
+private:
+    void measure(const char* name, const LittleFS::CacheConfig&);
+
+    LittleFS* _fs;
+    Vector<Result> _results;
+};
+
+}
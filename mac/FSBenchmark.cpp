@@ -0,0 +1,304 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "FSBenchmark.h"
+
+#include "SystemInterface.h"
+#include <algorithm>
+
+using namespace m8r;
+
+static const uint16_t OpSizes[] = { 64, 512, FSBenchmark::MaxOpSize };
+
+FSBenchmark::FSBenchmark(FS* fs, const char* root)
+    : _fs(fs)
+    , _root(root)
+{
+    _buffer = Mallocator::shared()->allocate<char>(MemoryType::Native, MaxOpSize);
+    for (uint16_t i = 0; i < MaxOpSize; ++i) {
+        _buffer.get()[i] = static_cast<char>(nextRandom());
+    }
+}
+
+FSBenchmark::~FSBenchmark()
+{
+    Mallocator::shared()->deallocate(MemoryType::Native, _buffer);
+}
+
+void FSBenchmark::run(Workload workload)
+{
+    if (!_fs || !_fs->mounted() || !_buffer.valid()) {
+        return;
+    }
+
+    if (workload == Workload::All) {
+        for (int i = 0; i < static_cast<int>(Workload::All); ++i) {
+            run(static_cast<Workload>(i));
+        }
+        return;
+    }
+
+    _fs->makeDirectory(_root.c_str());
+
+    switch (workload) {
+        case Workload::Sequential:
+            for (auto it : OpSizes) {
+                sequential(it);
+            }
+            break;
+        case Workload::Random:
+            for (auto it : OpSizes) {
+                random(it);
+            }
+            break;
+        case Workload::Churn: churn(); break;
+        case Workload::Directories: directories(); break;
+        case Workload::Mount: mount(); break;
+        case Workload::Fill: fill(); break;
+        default: break;
+    }
+
+    _fs->remove(_root.c_str());
+}
+
+void FSBenchmark::print() const
+{
+    system()->printf("%-12s %6s %6s %6s %10s %10s %8s %8s %8s %8s %8s\n",
+                     "workload", "size", "ops", "errors", "ops/s", "KB/s", "p50 us", "p99 us", "reads", "progs", "erases");
+    for (const auto& it : _results) {
+        system()->printf("%-12s %6u %6u %6u %10.1f %10.1f %8u %8u %8u %8u %8u\n",
+                         it.name, it.size, it.ops, it.errors, it.opsPerSecond(), it.bytesPerSecond() / 1024,
+                         it.p50, it.p99, it.reads, it.progs, it.erases);
+    }
+}
+
+void FSBenchmark::sequential(uint16_t opSize)
+{
+    String name = path("seq");
+
+    begin("seq write", opSize);
+    Mad<File> file = _fs->open(name.c_str(), FS::FileOpenMode::Write);
+    for (uint32_t offset = 0; offset < FileSize; offset += opSize) {
+        measure(opSize, [&] { return file->write(_buffer.get(), opSize) == opSize; });
+    }
+    _fs->release(file);
+    end();
+
+    begin("seq read", opSize);
+    file = _fs->open(name.c_str(), FS::FileOpenMode::Read);
+    for (uint32_t offset = 0; offset < FileSize; offset += opSize) {
+        measure(opSize, [&] { return file->read(_buffer.get(), opSize) == opSize; });
+    }
+    _fs->release(file);
+    end();
+
+    _fs->remove(name.c_str());
+}
+
+void FSBenchmark::random(uint16_t opSize)
+{
+    String name = path("rand");
+    uint32_t slots = FileSize / opSize;
+
+    // Make a full size file to work in
+    Mad<File> file = _fs->open(name.c_str(), FS::FileOpenMode::Write);
+    for (uint32_t offset = 0; offset < FileSize; offset += MaxOpSize) {
+        file->write(_buffer.get(), MaxOpSize);
+    }
+    _fs->release(file);
+
+    file = _fs->open(name.c_str(), FS::FileOpenMode::Create);
+
+    begin("rand read", opSize);
+    for (uint16_t i = 0; i < RandomOps; ++i) {
+        int32_t offset = (nextRandom() % slots) * opSize;
+        measure(opSize, [&] {
+            return file->seek(offset, File::SeekWhence::Set) && file->read(_buffer.get(), opSize) == opSize;
+        });
+    }
+    end();
+
+    begin("rand write", opSize);
+    for (uint16_t i = 0; i < RandomOps; ++i) {
+        int32_t offset = (nextRandom() % slots) * opSize;
+        measure(opSize, [&] {
+            return file->seek(offset, File::SeekWhence::Set) && file->write(_buffer.get(), opSize) == opSize;
+        });
+    }
+
+    // Closing writes out what's cached, so count it
+    _fs->release(file);
+    end();
+
+    _fs->remove(name.c_str());
+}
+
+void FSBenchmark::churn()
+{
+    static constexpr uint16_t Size = 64;
+
+    begin("create", Size);
+    for (uint16_t i = 0; i < ChurnFiles; ++i) {
+        String name = path("churn", i);
+        measure(Size, [&] {
+            Mad<File> file = _fs->open(name.c_str(), FS::FileOpenMode::Write);
+            bool success = file->write(_buffer.get(), Size) == Size;
+            _fs->release(file);
+            return success;
+        });
+    }
+    end();
+
+    begin("delete", 0);
+    for (uint16_t i = 0; i < ChurnFiles; ++i) {
+        String name = path("churn", i);
+        measure(0, [&] { return _fs->remove(name.c_str()); });
+    }
+    end();
+}
+
+void FSBenchmark::directories()
+{
+    static constexpr uint16_t Size = 32;
+
+    begin("mkdir", 0);
+    for (uint16_t i = 0; i < Directories; ++i) {
+        String name = path("dir", i);
+        measure(0, [&] { return _fs->makeDirectory(name.c_str()); });
+    }
+    end();
+
+    begin("dir create", Size);
+    for (uint16_t i = 0; i < Directories; ++i) {
+        for (uint16_t j = 0; j < FilesPerDirectory; ++j) {
+            String name = path("dir", i, j + 1);
+            measure(Size, [&] {
+                Mad<File> file = _fs->open(name.c_str(), FS::FileOpenMode::Write);
+                bool success = file->write(_buffer.get(), Size) == Size;
+                _fs->release(file);
+                return success;
+            });
+        }
+    }
+    end();
+
+    begin("lookup", 0);
+    for (uint16_t i = 0; i < Directories; ++i) {
+        for (uint16_t j = 0; j < FilesPerDirectory; ++j) {
+            String name = path("dir", i, j + 1);
+            measure(0, [&] { return _fs->exists(name.c_str()); });
+        }
+    }
+    end();
+
+    begin("list", 0);
+    for (uint16_t i = 0; i < Directories; ++i) {
+        String name = path("dir", i);
+        measure(0, [&] {
+            Mad<Directory> dir = _fs->openDirectory(name.c_str());
+            uint16_t entries = 0;
+            for ( ; dir->valid(); dir->next()) {
+                ++entries;
+            }
+            dir.destroy(MemoryType::Native);
+            return entries == FilesPerDirectory;
+        });
+    }
+    end();
+
+    begin("rmdir", 0);
+    for (uint16_t i = 0; i < Directories; ++i) {
+        for (uint16_t j = 0; j < FilesPerDirectory; ++j) {
+            _fs->remove(path("dir", i, j + 1).c_str());
+        }
+        String name = path("dir", i);
+        measure(0, [&] { return _fs->remove(name.c_str()); });
+    }
+    end();
+}
+
+void FSBenchmark::mount()
+{
+    begin("mount", 0);
+    for (uint16_t i = 0; i < Mounts; ++i) {
+        _fs->unmount();
+        measure(0, [&] { return _fs->mount(); });
+        if (!_fs->mounted()) {
+            break;
+        }
+    }
+    end();
+}
+
+void FSBenchmark::fill()
+{
+    String name = path("fill");
+    uint32_t maxOps = _fs->totalSize() / MaxOpSize + 1;
+
+    begin("fill", MaxOpSize);
+    Mad<File> file = _fs->open(name.c_str(), FS::FileOpenMode::Write);
+    bool full = false;
+    for (uint32_t i = 0; i < maxOps && !full; ++i) {
+        measure(MaxOpSize, [&] {
+            full = file->write(_buffer.get(), MaxOpSize) != MaxOpSize;
+            return !full;
+        });
+    }
+    _fs->release(file);
+    end();
+
+    begin("fill delete", 0);
+    measure(0, [&] { return _fs->remove(name.c_str()); });
+    end();
+}
+
+void FSBenchmark::begin(const char* name, uint32_t opSize)
+{
+    _current = Result();
+    _current.name = name;
+    _current.size = opSize;
+    _startFlash = _fs->flashStats();
+    _latencies.clear();
+    _startTime = Time::now();
+}
+
+void FSBenchmark::end()
+{
+    _current.elapsed = Time::now() - _startTime;
+
+    FS::FlashStats flash = _fs->flashStats();
+    _current.reads = flash.reads.count - _startFlash.reads.count;
+    _current.progs = flash.progs.count - _startFlash.progs.count;
+    _current.erases = flash.erases.count - _startFlash.erases.count;
+
+    if (!_latencies.empty()) {
+        std::sort(_latencies.begin(), _latencies.end());
+        _current.p50 = _latencies[static_cast<uint16_t>(_latencies.size() / 2)];
+        _current.p99 = _latencies[static_cast<uint16_t>((_latencies.size() * 99) / 100)];
+    }
+    _results.push_back(_current);
+}
+
+String FSBenchmark::path(const char* name, uint32_t index, uint32_t subIndex) const
+{
+    String s = String::format("%s/%s%u", _root.c_str(), name, index);
+    if (subIndex) {
+        s += String::format("/f%u", subIndex);
+    }
+    return s;
+}
+
+uint32_t FSBenchmark::nextRandom()
+{
+    // xorshift32, so runs are repeatable
+    _random ^= _random << 13;
+    _random ^= _random >> 17;
+    _random ^= _random << 5;
+    return _random;
+}
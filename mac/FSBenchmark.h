@@ -0,0 +1,114 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Containers.h"
+#include "MFS.h"
+#include "SystemTime.h"
+
+namespace m8r {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: FSBenchmark
+//
+//  Measures a filesystem through the FS and File interfaces. Each workload
+//  adds one or more Results with throughput, per operation latency
+//  percentiles and the block device operations it caused.
+//
+//  Files are made under a scratch directory which is removed afterwards.
+//  Mount unmounts and remounts the filesystem, so nothing else should have
+//  files open. Fill writes until the filesystem is full, then deletes what
+//  it wrote. --fsbench runs it on a scratch image, never m8rFSFile.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class FSBenchmark {
+public:
+    enum class Workload { Sequential, Random, Churn, Directories, Mount, Fill, All };
+
+    struct Result
+    {
+        const char* name = nullptr;
+        uint32_t size = 0;      // Bytes per operation, 0 if it doesn't apply
+        uint32_t ops = 0;
+        uint32_t errors = 0;
+        uint32_t bytes = 0;
+        Duration elapsed;
+        uint32_t p50 = 0;       // Latencies in us
+        uint32_t p99 = 0;
+        uint32_t reads = 0;     // Block device operations
+        uint32_t progs = 0;
+        uint32_t erases = 0;
+
+        float opsPerSecond() const { return elapsed.us() ? float(ops) * 1000000 / elapsed.us() : 0; }
+        float bytesPerSecond() const { return elapsed.us() ? float(bytes) * 1000000 / elapsed.us() : 0; }
+    };
+
+    static constexpr uint32_t FileSize = 64 * 1024;
+    static constexpr uint16_t MaxOpSize = 4096;
+    static constexpr uint16_t RandomOps = 256;
+    static constexpr uint16_t ChurnFiles = 64;
+    static constexpr uint16_t Directories = 16;
+    static constexpr uint16_t FilesPerDirectory = 4;
+    static constexpr uint16_t Mounts = 8;
+
+    FSBenchmark(FS*, const char* root = "/bench");
+    ~FSBenchmark();
+
+    void run(Workload = Workload::All);
+
+    const Vector<Result>& results() const { return _results; }
+
+    // Print the results as a table with system()->printf
+    void print() const;
+
+private:
+    void sequential(uint16_t opSize);
+    void random(uint16_t opSize);
+    void churn();
+    void directories();
+    void mount();
+    void fill();
+
+    void begin(const char* name, uint32_t opSize);
+    void end();
+
+    // Time one operation of the current result
+    template<typename Op>
+    void measure(uint32_t bytes, Op op)
+    {
+        Time start = Time::now();
+        bool success = op();
+        _latencies.push_back(static_cast<uint32_t>((Time::now() - start).us()));
+        ++_current.ops;
+        if (success) {
+            _current.bytes += bytes;
+        } else {
+            ++_current.errors;
+        }
+    }
+
+    String path(const char* name, uint32_t index = 0, uint32_t subIndex = 0) const;
+    uint32_t nextRandom();
+
+    FS* _fs;
+    String _root;
+    Mad<char> _buffer;
+
+    Vector<Result> _results;
+    Result _current;
+    Time _startTime;
+    FS::FlashStats _startFlash;
+    Vector<uint32_t> _latencies;
+    uint32_t _random = 1;
+};
+
+}
@@ -0,0 +1,174 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "ImageBuilder.h"
+
+#include "SimulatedFlash.h"
+#include "SystemInterface.h"
+#include <cstdio>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace m8r;
+
+ImageBuilder::~ImageBuilder()
+{
+    delete [ ] _buffer;
+}
+
+bool ImageBuilder::create(const char* imageFile)
+{
+    _fs->unmount();
+
+    // Start from nothing, with every block erased like a new part
+    ::unlink(imageFile);
+    LittleFS::setHostFilename(imageFile);
+    SimulatedFlash& flash = SimulatedFlash::shared();
+    for (uint32_t block = 0; block < FS::PhysicalSize / LittleFS::BlockSize; ++block) {
+        if (flash.erase(block) != LFS_ERR_OK) {
+            return fail(Error::Code::Write, imageFile);
+        }
+    }
+    flash.resetEraseCounts();
+
+    if (!_fs->format()) {
+        return fail(Error::Code::FormatFailed, imageFile);
+    }
+
+    if (!_buffer) {
+        _buffer = new char[CopyBufferSize];
+    }
+    _error = Error::Code::OK;
+    return true;
+}
+
+bool ImageBuilder::add(const char* hostPath, const char* destPath)
+{
+    struct stat st;
+    if (::stat(hostPath, &st) != 0) {
+        return fail(Error::Code::FileNotFound, hostPath);
+    }
+
+    String dest(destPath);
+    if (dest.empty() || dest[0] != '/') {
+        dest = String("/") + dest;
+    }
+    return S_ISDIR(st.st_mode) ? addDirectory(hostPath, dest) : addFile(hostPath, dest);
+}
+
+bool ImageBuilder::finish()
+{
+    _fs->unmount();
+    return !_error;
+}
+
+bool ImageBuilder::addFile(const String& hostPath, const String& destPath)
+{
+    FILE* from = fopen(hostPath.c_str(), "rb");
+    if (!from) {
+        return fail(Error::Code::FileNotFound, hostPath);
+    }
+
+    // Make the parent directories
+    int32_t slash = -1;
+    for (int32_t i = static_cast<int32_t>(destPath.size()) - 1; i > 0; --i) {
+        if (destPath[i] == '/') {
+            slash = i;
+            break;
+        }
+    }
+    if (slash > 0 && !_fs->makeDirectory(destPath.slice(0, slash).c_str())) {
+        fclose(from);
+        return fail(_fs->lastError().code(), destPath);
+    }
+
+    Mad<File> to = _fs->open(destPath.c_str(), FS::FileOpenMode::Write);
+    if (!to->valid()) {
+        Error::Code code = to->error().code();
+        _fs->release(to);
+        fclose(from);
+        return fail(code, destPath);
+    }
+
+    bool success = true;
+    while (true) {
+        size_t size = fread(_buffer, 1, CopyBufferSize, from);
+        if (size == 0) {
+            if (ferror(from)) {
+                success = fail(Error::Code::ReadError, hostPath);
+            }
+            break;
+        }
+        if (to->write(_buffer, static_cast<uint32_t>(size)) != static_cast<int32_t>(size)) {
+            success = fail(Error::Code::NoSpace, destPath);
+            break;
+        }
+        _bytes += size;
+    }
+
+    _fs->release(to);
+    fclose(from);
+    if (success) {
+        ++_files;
+    }
+    return success;
+}
+
+bool ImageBuilder::addDirectory(const String& hostPath, const String& destPath)
+{
+    if (!_fs->makeDirectory(destPath.c_str())) {
+        return fail(_fs->lastError().code(), destPath);
+    }
+    ++_directories;
+
+    DIR* dir = opendir(hostPath.c_str());
+    if (!dir) {
+        return fail(Error::Code::DirectoryNotFound, hostPath);
+    }
+
+    String dest = destPath;
+    if (dest[dest.size() - 1] != '/') {
+        dest += '/';
+    }
+
+    bool success = true;
+    while (struct dirent* entry = readdir(dir)) {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+            continue;
+        }
+
+        String from = hostPath + "/";
+        from += entry->d_name;
+        struct stat st;
+        if (::stat(from.c_str(), &st) != 0) {
+            continue;
+        }
+
+        String to = dest;
+        to += entry->d_name;
+        if (S_ISDIR(st.st_mode)) {
+            success = addDirectory(from, to);
+        } else if (S_ISREG(st.st_mode)) {
+            success = addFile(from, to);
+        }
+        if (!success) {
+            break;
+        }
+    }
+    closedir(dir);
+    return success;
+}
+
+bool ImageBuilder::fail(Error::Code code, const String& path)
+{
+    _error = code;
+    system()->print(Error::formatError(code, "Image builder failed on '%s'", path.c_str()).c_str());
+    return false;
+}
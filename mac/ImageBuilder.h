@@ -0,0 +1,65 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Error.h"
+#include "MLittleFS.h"
+#include "MString.h"
+
+namespace m8r {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: ImageBuilder
+//
+//  Makes a LittleFS image file from files and directory trees on the host,
+//  ready for upload_fs. The image is made by the LittleFS passed in, so it
+//  has the same block size, block count and caches as on the device.
+//
+//  create() points the LittleFS at the new image, so it is unmounted from
+//  whatever it had before. finish() unmounts it again.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class ImageBuilder {
+public:
+    // Host files are copied this much at a time
+    static constexpr uint32_t CopyBufferSize = LittleFS::BlockSize;
+
+    ImageBuilder(LittleFS* fs) : _fs(fs) { }
+    ~ImageBuilder();
+
+    // Make a new, formatted, empty image. An existing file is overwritten
+    bool create(const char* imageFile);
+
+    // Copy a host file, or a directory and everything in it, to destPath
+    bool add(const char* hostPath, const char* destPath);
+
+    bool finish();
+
+    Error error() const { return _error; }
+    uint32_t files() const { return _files; }
+    uint32_t directories() const { return _directories; }
+    uint64_t bytes() const { return _bytes; }
+
+private:
+    bool addFile(const String& hostPath, const String& destPath);
+    bool addDirectory(const String& hostPath, const String& destPath);
+    bool fail(Error::Code, const String& path);
+
+    LittleFS* _fs;
+    char* _buffer = nullptr;
+    Error _error;
+    uint32_t _files = 0;
+    uint32_t _directories = 0;
+    uint64_t _bytes = 0;
+};
+
+}
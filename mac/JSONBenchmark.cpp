@@ -0,0 +1,117 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "JSONBenchmark.h"
+
+#include "JSON.h"
+#include "JSONTape.h"
+#include "SystemInterface.h"
+#include <malloc/malloc.h>
+
+using namespace m8r;
+
+static const uint16_t RecordCounts[] = { 10, 100, 500 };
+
+// JSON::Value and String allocate with new, so Mallocator doesn't see
+// them. Ask the malloc zone instead
+static uint32_t heapInUse()
+{
+    malloc_statistics_t stats;
+    malloc_zone_statistics(nullptr, &stats);
+    return static_cast<uint32_t>(stats.size_in_use);
+}
+
+void JSONBenchmark::run()
+{
+    for (auto it : RecordCounts) {
+        String json = document(it);
+        parseJSON(json, it);
+        parseTape(json, it);
+    }
+}
+
+void JSONBenchmark::print() const
+{
+    system()->printf("%-8s %8s %8s %10s %10s %6s\n", "parser", "records", "input", "heap", "us/parse", "errors");
+    for (const auto& it : _results) {
+        system()->printf("%-8s %8u %8u %10u %10.1f %6u\n", it.name, it.records, it.inputSize, it.heapBytes, it.usPerParse(), it.errors);
+    }
+}
+
+String JSONBenchmark::document(uint16_t records)
+{
+    String json = "{\"ssids\": [";
+    for (uint16_t i = 0; i < records; ++i) {
+        if (i) {
+            json += ", ";
+        }
+        json += String::format("{\"ssid\": \"network%u\", \"rssi\": -%u, \"secure\": true, \"channel\": %u}",
+                               i, 40 + i % 50, 1 + i % 11);
+    }
+    json += String::format("], \"count\": %u}", records);
+    return json;
+}
+
+void JSONBenchmark::parseJSON(const String& json, uint16_t records)
+{
+    Result result;
+    result.name = "JSON";
+    result.records = records;
+    result.inputSize = static_cast<uint32_t>(json.size());
+    result.iterations = Work / records;
+
+    {
+        uint32_t start = heapInUse();
+        JSON parser;
+        SharedPtr<JSON::Value> value;
+        if (!parser.parse(json, value)) {
+            ++result.errors;
+        }
+        result.heapBytes = heapInUse() - start;
+    }
+
+    Time start = Time::now();
+    for (uint32_t i = 0; i < result.iterations; ++i) {
+        JSON parser;
+        SharedPtr<JSON::Value> value;
+        if (!parser.parse(json, value)) {
+            ++result.errors;
+        }
+    }
+    result.elapsed = Time::now() - start;
+    _results.push_back(result);
+}
+
+void JSONBenchmark::parseTape(const String& json, uint16_t records)
+{
+    Result result;
+    result.name = "JSONTape";
+    result.records = records;
+    result.inputSize = static_cast<uint32_t>(json.size());
+    result.iterations = Work / records;
+
+    {
+        uint32_t start = heapInUse();
+        JSONTape tape;
+        if (!tape.parse(json)) {
+            ++result.errors;
+        }
+        result.heapBytes = heapInUse() - start;
+    }
+
+    Time start = Time::now();
+    for (uint32_t i = 0; i < result.iterations; ++i) {
+        JSONTape tape;
+        if (!tape.parse(json)) {
+            ++result.errors;
+        }
+    }
+    result.elapsed = Time::now() - start;
+    _results.push_back(result);
+}
@@ -0,0 +1,63 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Containers.h"
+#include "MString.h"
+#include "SystemTime.h"
+
+namespace m8r {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: JSONBenchmark
+//
+//  Compares JSON::parse, which builds a tree of Values, with JSONTape.
+//  Each document is an object holding an array of records like the ones
+//  the web UI's REST calls send. For each size, and each parser, it
+//  measures the heap the parsed document holds and the time to parse it.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class JSONBenchmark {
+public:
+    struct Result
+    {
+        const char* name = nullptr;
+        uint16_t records = 0;
+        uint32_t inputSize = 0;
+        uint32_t heapBytes = 0;     // Held by the parsed document
+        uint32_t iterations = 0;
+        uint32_t errors = 0;
+        Duration elapsed;
+
+        float usPerParse() const { return iterations ? float(elapsed.us()) / iterations : 0; }
+    };
+
+    // Parses per size are this divided by the number of records
+    static constexpr uint32_t Work = 20000;
+
+    void run();
+
+    const Vector<Result>& results() const { return _results; }
+
+    // Print the results as a table with system()->printf
+    void print() const;
+
+private:
+    static String document(uint16_t records);
+
+    void parseJSON(const String& json, uint16_t records);
+    void parseTape(const String& json, uint16_t records);
+
+    Vector<Result> _results;
+};
+
+}
@@ -9,104 +9,87 @@
 
 #include "MLittleFS.h"
 
+#include "SimulatedFlash.h"
+
 #include "lfs.h"
+#include <cstring>
 #include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 // The simulated LittleFS file is a file FS::PhysicalSize in size in the real
-// filesystem. The name of that file is passed in
+// filesystem. The name of that file is passed in. It is mapped into memory
+// and SimulatedFlash does reads, progs and erases on it. Sync is an msync
 
 using namespace m8r;
 
-static FILE* fsFile = nullptr;
+static uint8_t* fsMap = nullptr;
+static int fsFd = -1;
 
 static int lfs_flash_read(const struct lfs_config *c,
     lfs_block_t block, lfs_off_t off, void *dst, lfs_size_t size) {
-    uint32_t addr = (block * LittleFS::BlockSize) + off;
-
-    if (!fsFile) {
-        return LFS_ERR_INVAL;
-    }
-    
-    if (fseek(fsFile, addr, SEEK_SET)) {
-        printf("******** MacLittleFS error seeking to sector %d on read (%d): %s\n", addr, ferror(fsFile), strerror(ferror(fsFile)));
-        return LFS_ERR_INVAL;
-    }
-    if (fread(dst, 1, size, fsFile) != size) {
-        printf("******** MacLittleFS error reading sector %d (%d): %s\n", addr, ferror(fsFile), strerror(ferror(fsFile)));
-        return LFS_ERR_INVAL;
-    }
-    return LFS_ERR_OK;
+    return SimulatedFlash::shared().read(block, off, dst, size);
 }
 
 static int lfs_flash_prog(const struct lfs_config *c,
     lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
-    uint32_t addr = (block * LittleFS::BlockSize) + off;
-    const uint8_t *src = reinterpret_cast<const uint8_t *>(buffer);
-
-    if (!fsFile) {
-        return LFS_ERR_INVAL;
-    }
-    
-    if (fseek(fsFile, addr, SEEK_SET)) {
-        printf("******** MacLittleFS error seeking to sector %d on write (%d): %s\n", addr, ferror(fsFile), strerror(ferror(fsFile)));
-        return LFS_ERR_INVAL;
-    }
-    if (fwrite(src, 1, size, fsFile) != size) {
-        printf("******** MacLittleFS error writing sector %d (%d): %s\n", addr, ferror(fsFile), strerror(ferror(fsFile)));
-        return LFS_ERR_INVAL;
-    }
-    return LFS_ERR_OK;
+    return SimulatedFlash::shared().prog(block, off, buffer, size);
 }
 
 static int lfs_flash_erase(const struct lfs_config *c, lfs_block_t block) {
-    uint32_t addr = (block * LittleFS::BlockSize);
-    uint32_t size = LittleFS::BlockSize;
+    return SimulatedFlash::shared().erase(block);
+}
 
-    if (fseek(fsFile, addr, SEEK_SET)) {
-        printf("******** MacLittleFS error seeking to sector %d on erase (%d): %s\n", addr, ferror(fsFile), strerror(ferror(fsFile)));
+static int lfs_flash_sync(const struct lfs_config *c) {
+    if (!fsMap) {
         return LFS_ERR_INVAL;
     }
     
-    char* buf = new char[size];
-    memset(buf, 0xff, size);
-    if (fwrite(buf, 1, size, fsFile) != size) {
-        printf("******** MacLittleFS error erasing sector %d (%d): %s\n", addr, ferror(fsFile), strerror(ferror(fsFile)));
-        delete [ ] buf;
-        return LFS_ERR_INVAL;
+    if (msync(fsMap, FS::PhysicalSize, MS_SYNC) != 0) {
+        printf("******** MacLittleFS error syncing (%d): %s\n", errno, strerror(errno));
+        return LFS_ERR_IO;
     }
-    delete [ ] buf;
     return LFS_ERR_OK;
 }
 
-static int lfs_flash_sync(const struct lfs_config *c) {
-    /* NOOP */
-    (void) c;
-    return 0;
-}
-
 void LittleFS::setHostFilename(const char* name)
 {
-    // If the file exists, use it as long as it is big enough
-    fsFile = fopen(name, "rb+");
-    if (!fsFile) {
-        fsFile = fopen(name, "wb+");
-        if (!fsFile) {
-            printf("******** MacLittleFS Error:could not open '%s', file system not available\n", name);
-        }
+    if (fsMap) {
+        SimulatedFlash::shared().detach();
+        msync(fsMap, FS::PhysicalSize, MS_SYNC);
+        munmap(fsMap, FS::PhysicalSize);
+        fsMap = nullptr;
+    }
+    if (fsFd >= 0) {
+        ::close(fsFd);
+    }
+    
+    // If the file exists, use it, extending it if it isn't big enough
+    fsFd = ::open(name, O_RDWR | O_CREAT, 0644);
+    if (fsFd < 0) {
+        printf("******** MacLittleFS Error:could not open '%s', file system not available\n", name);
+        return;
+    }
+    
+    struct stat st;
+    if (fstat(fsFd, &st) != 0 || (st.st_size < FS::PhysicalSize && ftruncate(fsFd, FS::PhysicalSize) != 0)) {
+        printf("******** MacLittleFS Error:could not size '%s' (%d): %s\n", name, errno, strerror(errno));
+        ::close(fsFd);
+        fsFd = -1;
+        return;
     }
     
-    if (fsFile) {
-        if (fseek(fsFile, 0, SEEK_END) != 0) {
-            printf("******** MacLittleFS Error:could not seek to the end of '%s'\n", name);
-            fclose(fsFile);
-            fsFile = nullptr;
-        }
-        
-        if (ftell(fsFile) < FS::PhysicalSize) {
-            ftruncate(fileno(fsFile), FS::PhysicalSize);
-        }
+    void* map = mmap(nullptr, FS::PhysicalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fsFd, 0);
+    if (map == MAP_FAILED) {
+        printf("******** MacLittleFS Error:could not map '%s' (%d): %s\n", name, errno, strerror(errno));
+        ::close(fsFd);
+        fsFd = -1;
+        return;
     }
+    fsMap = reinterpret_cast<uint8_t*>(map);
+    SimulatedFlash::shared().attach(fsMap, FS::PhysicalSize, LittleFS::BlockSize);
 }
 
 void LittleFS::setConfig(lfs_config& config)
@@ -7,15 +7,28 @@
     found in the LICENSE file.
 -------------------------------------------------------------------------*/
 
+#include "Application.h"
+#include "AtomBenchmark.h"
+#include "CacheBenchmark.h"
+#include "FSBenchmark.h"
 #include "GPIOInterface.h"
+#include "ImageBuilder.h"
+#include "JSONBenchmark.h"
 #include "TaskManager.h"
 #include "Thread.h"
 #include "MacTCP.h"
 #include "MacUDP.h"
+#include "RomFSBuilder.h"
+#include "SelfTest.h"
+#include "StreamBenchmark.h"
 #include "SystemInterface.h"
 
 #include "MLittleFS.h"
+#include "RamFS.h"
+#include "RomFS.h"
+#include "VFS.h"
 #include "cpptime.h"
+#include <unistd.h>
 
 using namespace m8r;
 
@@ -23,10 +36,22 @@ class MacSystemInterface : public SystemInterface
 {
 public:
     static constexpr int NumTimers = 8;
+    static constexpr uint32_t RamFSSize = 1024 * 1024;
 
     MacSystemInterface()
+        : _ramFS(RamFSSize)
+        , _webAssets(WebAssets)
     {
         LittleFS::setHostFilename("m8rFSFile");
+        _fileSystem.addMount("/", &_flashFileSystem);
+        _fileSystem.addMount("/tmp", &_ramFS);
+        _fileSystem.addMount("/sys/web", &_webAssets);
+    }
+    
+    ~MacSystemInterface()
+    {
+        // The AsyncIO worker may be using the filesystems, which go first
+        asyncIO()->stop();
     }
     
     virtual void setDeviceName(const char*) override { }
@@ -64,7 +89,10 @@ public:
 
 private:
     GPIOInterface _gpio;
-    LittleFS _fileSystem;
+    LittleFS _flashFileSystem;
+    RamFS _ramFS;
+    RomFS _webAssets;
+    VFS _fileSystem;
 };
 
 int32_t SystemInterface::heapFreeSize()
@@ -115,7 +143,138 @@ bool Timer::running() const
     return _data;
 }
 
+// Benchmarks format and fill the flash filesystem, so they get a fresh
+// image of their own rather than m8rFSFile
+static constexpr const char* ScratchImage = "m8rScratchFSFile";
+
+static LittleFS* scratchFileSystem()
+{
+    LittleFS* fs = static_cast<LittleFS*>(static_cast<VFS*>(system()->fileSystem())->mountedAt("/"));
+    ::unlink(ScratchImage);
+    LittleFS::setHostFilename(ScratchImage);
+    if (!fs->format()) {
+        system()->print(Error::formatError(fs->lastError().code(), "Unable to format '%s'", ScratchImage).c_str());
+        return nullptr;
+    }
+    return fs;
+}
+
+static void removeScratchFileSystem(LittleFS* fs)
+{
+    fs->unmount();
+    ::unlink(ScratchImage);
+}
+
 int main(int argc, char * argv[])
 {
+    // --atombench runs the atom lookup benchmark and exits
+    if (argc > 1 && strcmp(argv[1], "--atombench") == 0) {
+        Application application;
+        AtomBenchmark benchmark;
+        benchmark.run();
+        benchmark.print();
+        return 0;
+    }
+    
+    // --jsonbench compares parsing with JSON and JSONTape and exits
+    if (argc > 1 && strcmp(argv[1], "--jsonbench") == 0) {
+        Application application;
+        JSONBenchmark benchmark;
+        benchmark.run();
+        benchmark.print();
+        return 0;
+    }
+    
+    // --fsbench runs the filesystem benchmark on a scratch image and exits
+    if (argc > 1 && strcmp(argv[1], "--fsbench") == 0) {
+        Application application(Application::SystemOnly{});
+        LittleFS* fs = scratchFileSystem();
+        if (!fs) {
+            return 1;
+        }
+        FSBenchmark benchmark(fs);
+        benchmark.run();
+        benchmark.print();
+        removeScratchFileSystem(fs);
+        return 0;
+    }
+    
+    // --cachebench sweeps LittleFS cache configurations on a scratch image and exits
+    if (argc > 1 && strcmp(argv[1], "--cachebench") == 0) {
+        Application application(Application::SystemOnly{});
+        LittleFS* fs = scratchFileSystem();
+        if (!fs) {
+            return 1;
+        }
+        CacheBenchmark benchmark(fs);
+        benchmark.run();
+        benchmark.print();
+        removeScratchFileSystem(fs);
+        return 0;
+    }
+    
+    // --streambench measures FileStream buffering on a scratch image and exits
+    if (argc > 1 && strcmp(argv[1], "--streambench") == 0) {
+        Application application(Application::SystemOnly{});
+        LittleFS* fs = scratchFileSystem();
+        if (!fs) {
+            return 1;
+        }
+        {
+            StreamBenchmark benchmark(fs);
+            benchmark.run();
+            benchmark.print();
+        }
+        removeScratchFileSystem(fs);
+        return 0;
+    }
+    
+    // --selftest runs the behavior checks on a scratch image and exits,
+    // with 1 if any failed
+    if (argc > 1 && strcmp(argv[1], "--selftest") == 0) {
+        Application application(Application::SystemOnly{});
+        LittleFS* fs = scratchFileSystem();
+        if (!fs) {
+            return 1;
+        }
+        SelfTest test(fs);
+        test.run();
+        test.print();
+        removeScratchFileSystem(fs);
+        return test.failures() ? 1 : 0;
+    }
+    
+    // --build-image <dir> <image> makes a LittleFS image holding the
+    // contents of dir, for upload_fs, and exits
+    if (argc > 3 && strcmp(argv[1], "--build-image") == 0) {
+        Application application(Application::SystemOnly{});
+        ImageBuilder builder(static_cast<LittleFS*>(static_cast<VFS*>(system()->fileSystem())->mountedAt("/")));
+        bool success = builder.create(argv[3]) && builder.add(argv[2], "/") && builder.finish();
+        if (success) {
+            printf("Built '%s': %u files, %u directories, %llu bytes\n", argv[3],
+                   builder.files(), builder.directories(), static_cast<unsigned long long>(builder.bytes()));
+        }
+        return success ? 0 : 1;
+    }
+    
+    // --build-romfs <source> <name> [--gzip] <path>... writes a RomFS bundle
+    // called name holding each file or directory under its base name, and exits
+    if (argc > 4 && strcmp(argv[1], "--build-romfs") == 0) {
+        Application application(Application::SystemOnly{});
+        bool gzip = strcmp(argv[4], "--gzip") == 0;
+        RomFSBuilder builder(gzip);
+        bool success = true;
+        for (int i = gzip ? 5 : 4; i < argc && success; ++i) {
+            const char* base = strrchr(argv[i], '/');
+            success = builder.add(argv[i], base ? base + 1 : argv[i]);
+        }
+        success = success && builder.write(argv[2], argv[3]);
+        if (success) {
+            printf("Built '%s': %u files, %llu bytes stored in %llu\n", argv[2], builder.files(),
+                   static_cast<unsigned long long>(builder.bytes()), static_cast<unsigned long long>(builder.storedBytes()));
+        }
+        return success ? 0 : 1;
+    }
+    
     m8rmain();
 }
@@ -0,0 +1,248 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "RomFSBuilder.h"
+
+#include "SystemInterface.h"
+#include <algorithm>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <zlib.h>
+
+using namespace m8r;
+
+struct ContentType
+{
+    const char* extension;
+    const char* type;
+};
+
+static const ContentType _contentTypes[] = {
+    { "html", "text/html" },
+    { "htm", "text/html" },
+    { "css", "text/css" },
+    { "js", "application/javascript" },
+    { "json", "application/json" },
+    { "txt", "text/plain" },
+    { "ico", "image/x-icon" },
+    { "png", "image/png" },
+    { "jpg", "image/jpeg" },
+    { "jpeg", "image/jpeg" },
+    { "gif", "image/gif" },
+    { "svg", "image/svg+xml" },
+};
+
+static constexpr uint16_t BytesPerLine = 16;
+
+bool RomFSBuilder::add(const char* hostPath, const char* destPath)
+{
+    struct stat st;
+    if (::stat(hostPath, &st) != 0) {
+        return fail(Error::Code::FileNotFound, hostPath);
+    }
+
+    String dest(destPath);
+    if (dest.empty() || dest[0] != '/') {
+        dest = String("/") + dest;
+    }
+    if (S_ISDIR(st.st_mode)) {
+        return addDirectory(hostPath, dest);
+    }
+
+    _entries.push_back({ hostPath, dest });
+    return true;
+}
+
+bool RomFSBuilder::write(const char* sourceFile, const char* name)
+{
+    if (_error) {
+        return false;
+    }
+
+    // RomFS binary searches by path
+    std::sort(_entries.begin(), _entries.end());
+    for (uint16_t i = 1; i < _entries.size(); ++i) {
+        if (_entries[i].path == _entries[i - 1].path) {
+            return fail(Error::Code::Exists, _entries[i].path);
+        }
+    }
+
+    FILE* out = fopen(sourceFile, "w");
+    if (!out) {
+        return fail(Error::Code::Write, sourceFile);
+    }
+
+    fprintf(out, "// Generated by --build-romfs. Do not edit\n\n");
+    fprintf(out, "#include \"RomFS.h\"\n\n");
+
+    String declarations;
+    bool success = true;
+    for (uint16_t i = 0; i < _entries.size() && success; ++i) {
+        success = writeAsset(out, i, _entries[i], declarations);
+    }
+
+    if (success) {
+        fprintf(out, "static const m8r::RomFS::Asset _assets[] = {\n%s};\n\n", declarations.c_str());
+        fprintf(out, "namespace m8r {\n\nconst RomFS::Bundle %s = { _assets, %u };\n\n}\n", name, static_cast<uint32_t>(_entries.size()));
+        if (ferror(out)) {
+            success = fail(Error::Code::Write, sourceFile);
+        }
+    }
+    fclose(out);
+    return success;
+}
+
+bool RomFSBuilder::addDirectory(const String& hostPath, const String& destPath)
+{
+    DIR* dir = opendir(hostPath.c_str());
+    if (!dir) {
+        return fail(Error::Code::DirectoryNotFound, hostPath);
+    }
+
+    String dest = destPath;
+    if (dest[dest.size() - 1] != '/') {
+        dest += '/';
+    }
+
+    bool success = true;
+    while (struct dirent* entry = readdir(dir)) {
+        // Skip ".", ".." and hidden files like .DS_Store
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+
+        String from = hostPath;
+        from += '/';
+        from += entry->d_name;
+        struct stat st;
+        if (::stat(from.c_str(), &st) != 0) {
+            continue;
+        }
+
+        String to = dest;
+        to += entry->d_name;
+        if (S_ISDIR(st.st_mode)) {
+            success = addDirectory(from, to);
+        } else if (S_ISREG(st.st_mode)) {
+            _entries.push_back({ from, to });
+        }
+        if (!success) {
+            break;
+        }
+    }
+    closedir(dir);
+    return success;
+}
+
+bool RomFSBuilder::writeAsset(FILE* out, uint16_t index, const Entry& entry, String& declaration)
+{
+    std::vector<char> data;
+    if (!readFile(entry.hostPath, data)) {
+        return fail(Error::Code::ReadError, entry.hostPath);
+    }
+
+    std::vector<char> compressed;
+    bool gzipped = _gzip && gzip(data, compressed);
+
+    _bytes += data.size();
+    _storedBytes += data.size() + compressed.size();
+
+    // FNV-1a of all the stored bytes, so the ETag changes whenever they do
+    uint32_t hash = 2166136261;
+    for (char c : data) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619;
+    }
+    for (char c : compressed) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619;
+    }
+
+    fprintf(out, "// %s\n", entry.path.c_str());
+    writeArray(out, String::format("_asset%u", index), data);
+    if (gzipped) {
+        writeArray(out, String::format("_asset%uGzip", index), compressed);
+    }
+
+    String gzipData = gzipped ? String::format("_asset%uGzip", index) : String("nullptr");
+    declaration += String::format("    { \"%s\", _asset%u, %u, %s, %u, \"%s\", \"\\\"%08x\\\"\" },\n",
+                                  entry.path.c_str(), index, static_cast<uint32_t>(data.size()),
+                                  gzipData.c_str(), static_cast<uint32_t>(compressed.size()),
+                                  contentType(entry.path), hash);
+    return true;
+}
+
+void RomFSBuilder::writeArray(FILE* out, const String& name, const std::vector<char>& data)
+{
+    fprintf(out, "static const char %s[] = {", name.c_str());
+    for (size_t i = 0; i < data.size(); ++i) {
+        fprintf(out, "%s'\\x%02x',", (i % BytesPerLine) ? " " : "\n    ", static_cast<uint8_t>(data[i]));
+    }
+    fprintf(out, "\n};\n\n");
+}
+
+bool RomFSBuilder::fail(Error::Code code, const String& path)
+{
+    _error = code;
+    system()->print(Error::formatError(code, "RomFS builder failed on '%s'", path.c_str()).c_str());
+    return false;
+}
+
+const char* RomFSBuilder::contentType(const String& path)
+{
+    const char* dot = strrchr(path.c_str(), '.');
+    if (dot) {
+        for (const auto& it : _contentTypes) {
+            if (strcasecmp(dot + 1, it.extension) == 0) {
+                return it.type;
+            }
+        }
+    }
+    return "application/octet-stream";
+}
+
+bool RomFSBuilder::readFile(const String& path, std::vector<char>& data)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+
+    char buf[4096];
+    while (size_t size = fread(buf, 1, sizeof(buf), file)) {
+        data.insert(data.end(), buf, buf + size);
+    }
+    bool success = !ferror(file);
+    fclose(file);
+    return success;
+}
+
+bool RomFSBuilder::gzip(const std::vector<char>& data, std::vector<char>& compressed)
+{
+    z_stream stream = { };
+
+    // A window size of 15 + 16 asks for a gzip header and trailer, which is
+    // what browsers take with Content-Encoding: gzip
+    if (deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return false;
+    }
+
+    compressed.resize(deflateBound(&stream, static_cast<uLong>(data.size())));
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    int result = deflate(&stream, Z_FINISH);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+
+    if (result != Z_STREAM_END || compressed.size() >= data.size()) {
+        compressed.clear();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,80 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Containers.h"
+#include "Error.h"
+#include "MString.h"
+#include <cstdio>
+#include <vector>
+
+namespace m8r {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: RomFSBuilder
+//
+//  Makes a source file holding a RomFS::Bundle from files and directory
+//  trees on the host. Assets are sorted by path so RomFS can binary search
+//  them, and each gets a Content-Type from its extension and an ETag from
+//  a hash of its bytes.
+//
+//  With gzip, each asset also gets a gzipped copy if that's smaller than
+//  the plain bytes. Both are kept, since not every client accepts gzip.
+//  The output only changes when the input does, so it can be checked in.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class RomFSBuilder {
+public:
+    RomFSBuilder(bool gzip) : _gzip(gzip) { }
+
+    // Add a host file, or a directory and everything in it, at destPath
+    bool add(const char* hostPath, const char* destPath);
+
+    // Write the bundle as a const RomFS::Bundle called name
+    bool write(const char* sourceFile, const char* name);
+
+    Error error() const { return _error; }
+    uint32_t files() const { return _entries.size(); }
+    uint64_t bytes() const { return _bytes; }
+    uint64_t storedBytes() const { return _storedBytes; }
+
+private:
+    struct Entry
+    {
+        String hostPath;
+        String path;
+
+        bool operator<(const Entry& other) const { return path < other.path; }
+    };
+
+    bool addDirectory(const String& hostPath, const String& destPath);
+    bool writeAsset(FILE*, uint16_t index, const Entry&, String& declaration);
+    bool fail(Error::Code, const String& path);
+
+    static void writeArray(FILE*, const String& name, const std::vector<char>& data);
+
+    static const char* contentType(const String& path);
+
+    // Host files can be bigger than a Vector holds
+    static bool readFile(const String& path, std::vector<char>& data);
+
+    // Returns false, with compressed empty, if gzip wouldn't make data smaller
+    static bool gzip(const std::vector<char>& data, std::vector<char>& compressed);
+
+    bool _gzip;
+    Vector<Entry> _entries;
+    Error _error;
+    uint64_t _bytes = 0;
+    uint64_t _storedBytes = 0;
+};
+
+}
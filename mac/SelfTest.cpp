@@ -0,0 +1,202 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "SelfTest.h"
+
+#include "Atom.h"
+#include "RomFS.h"
+#include "SystemInterface.h"
+#include "VFS.h"
+
+using namespace m8r;
+
+void SelfTest::run()
+{
+    _group = "atom index";
+    atomIndex();
+    _group = "atom snapshot";
+    atomSnapshot();
+    _group = "json reader";
+    jsonReader();
+    _group = "json tape";
+    jsonTape();
+    _group = "json writer";
+    jsonWriter();
+    _group = "json pointer";
+    jsonQuery();
+    _group = "cbor";
+    cbor();
+    _group = "scanner push";
+    scannerPush();
+    _group = "handle cache";
+    handleCache();
+    _group = "vfs paths";
+    vfsPaths();
+    _group = "ramfs";
+    ramFS();
+    _group = "stat cache";
+    statCache();
+    _group = "romfs";
+    romFS();
+    _group = "watch";
+    watches();
+    _group = "kvstore";
+    kvStore();
+}
+
+void SelfTest::print() const
+{
+    system()->printf("%u checks, %u failed\n", _checks, _failures);
+}
+
+bool SelfTest::check(bool passed, const char* expr, const char* file, int line)
+{
+    ++_checks;
+    if (!passed) {
+        ++_failures;
+        const char* base = strrchr(file, '/');
+        system()->printf("FAILED %s: %s (%s:%d)\n", _group, expr, base ? base + 1 : file, line);
+    }
+    return passed;
+}
+
+bool SelfTest::writeFile(const char* path, const char* data, uint32_t size, FS* fs)
+{
+    if (!fs) {
+        fs = system()->fileSystem();
+    }
+    Mad<File> file = fs->open(path, FS::FileOpenMode::Write);
+    bool success = file.valid() && file->valid() && file->write(data, size) == static_cast<int32_t>(size);
+    fs->release(file);
+    return success;
+}
+
+bool SelfTest::readFile(const char* path, Vector<char>& data, FS* fs)
+{
+    if (!fs) {
+        fs = system()->fileSystem();
+    }
+    Mad<File> file = fs->open(path, FS::FileOpenMode::Read);
+    bool success = file.valid() && file->valid();
+    if (success) {
+        data.resize(file->size());
+        success = file->read(data.begin(), data.size()) == static_cast<int32_t>(data.size());
+    }
+    fs->release(file);
+    return success;
+}
+
+String SelfTest::readFile(const char* path, FS* fs)
+{
+    Vector<char> data;
+    return readFile(path, data, fs) ? String(data.begin(), data.size()) : String("missing");
+}
+
+void SelfTest::atomIndex()
+{
+    // Enough atoms to grow the hash table from its minimum size several times
+    static constexpr uint16_t Count = 1000;
+
+    AtomTable table;
+    Vector<Atom> atoms;
+    for (uint16_t i = 0; i < Count; ++i) {
+        atoms.push_back(table.atomizeString(String::format("atom%u", i).c_str()));
+    }
+
+    bool distinct = true;
+    bool sameAtom = true;
+    bool sameString = true;
+    for (uint16_t i = 0; i < Count; ++i) {
+        String name = String::format("atom%u", i);
+        distinct = distinct && atoms[i].raw() >= ExternalAtomOffset && (i == 0 || !(atoms[i] == atoms[i - 1]));
+        sameAtom = sameAtom && table.atomizeString(name.c_str()) == atoms[i];
+        sameString = sameString && name == table.stringFromAtom(atoms[i]);
+    }
+    CHECK(distinct);
+    CHECK(sameAtom);
+    CHECK(sameString);
+
+    // Shared atoms come from the shared table, with their SA ids
+    CHECK(table.atomizeString("length").raw() == static_cast<uint16_t>(SA::length));
+    CHECK(table.atomizeString("Array").raw() == static_cast<uint16_t>(SA::Array));
+    CHECK(strcmp(table.stringFromAtom(Atom(static_cast<uint16_t>(SA::value))), "value") == 0);
+
+    // Strings that differ only at the end, or are prefixes of each
+    // other, are different atoms
+    Atom ab = table.atomizeString("ab");
+    Atom abc = table.atomizeString("abc");
+    Atom abd = table.atomizeString("abd");
+    CHECK(!(ab == abc) && !(abc == abd) && !(ab == abd));
+    CHECK(table.atomizeString("abc") == abc);
+    CHECK(strcmp(table.stringFromAtom(Atom()), "") == 0);
+}
+
+void SelfTest::atomSnapshot()
+{
+    static constexpr uint16_t Count = 300;
+
+    AtomTable original;
+    Vector<Atom> atoms;
+    for (uint16_t i = 0; i < Count; ++i) {
+        atoms.push_back(original.atomizeString(String::format("snap%u", i).c_str()));
+    }
+    CHECK(original.save("/atoms"));
+
+    // Every atom comes back with the same id, and new ones still work
+    auto matches = [&atoms](AtomTable& table) {
+        for (uint16_t i = 0; i < Count; ++i) {
+            String name = String::format("snap%u", i);
+            if (!(table.atomizeString(name.c_str()) == atoms[i]) || name != table.stringFromAtom(atoms[i])) {
+                return false;
+            }
+        }
+        Atom added = table.atomizeString("added");
+        return added.raw() >= ExternalAtomOffset && strcmp(table.stringFromAtom(added), "added") == 0
+               && table.atomizeString("added") == added && table.atomizeString("snap0") == atoms[0];
+    };
+
+    AtomTable loaded;
+    CHECK(loaded.load("/atoms"));
+    CHECK(matches(loaded));
+
+    // The same snapshot in a RomFS is loaded from the mapping
+    Vector<char> snapshot;
+    CHECK(readFile("/atoms", snapshot));
+    RomFS::Asset asset = { "/atoms", snapshot.begin(), static_cast<uint32_t>(snapshot.size()), nullptr, 0, nullptr, nullptr };
+    RomFS rom(RomFS::Bundle { &asset, 1 });
+    rom.mount();
+    VFS* vfs = static_cast<VFS*>(system()->fileSystem());
+    CHECK(vfs->addMount("/selftest", &rom));
+    FS::Mapping mapping;
+    CHECK(vfs->map("/selftest/atoms", mapping) && mapping.data == snapshot.begin());
+    AtomTable mapped;
+    CHECK(mapped.load("/selftest/atoms"));
+    CHECK(matches(mapped));
+    vfs->removeMount("/selftest");
+
+    // A damaged snapshot is rejected and leaves an empty, usable table
+    Vector<char> damaged = snapshot;
+    damaged[damaged.size() / 2] ^= 0x20;
+    CHECK(writeFile("/atoms.bad", damaged.begin(), damaged.size()));
+    AtomTable rejected;
+    rejected.atomizeString("before");
+    CHECK(!rejected.load("/atoms.bad"));
+    Atom after = rejected.atomizeString("after");
+    CHECK(strcmp(rejected.stringFromAtom(after), "after") == 0);
+
+    CHECK(writeFile("/atoms.bad", snapshot.begin(), snapshot.size() - 1));
+    CHECK(!rejected.load("/atoms.bad"));
+    CHECK(!rejected.load("/missing"));
+
+    // An empty table round trips
+    AtomTable empty;
+    CHECK(empty.save("/atoms"));
+    CHECK(loaded.load("/atoms"));
+    CHECK(loaded.atomizeString("length").raw() == static_cast<uint16_t>(SA::length));
+}
@@ -0,0 +1,71 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "MLittleFS.h"
+
+namespace m8r {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: SelfTest
+//
+//  Behavior checks for the library, run on the Mac with --selftest. Each
+//  group sets up what it needs, using the scratch LittleFS for anything
+//  that needs files, and CHECK records every expression that's false
+//  with its file and line. print() lists those and the totals.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class SelfTest {
+public:
+    SelfTest(LittleFS* fs) : _fs(fs) { }
+
+    void run();
+
+    uint32_t checks() const { return _checks; }
+    uint32_t failures() const { return _failures; }
+
+    // Print the totals with system()->printf. Failures are printed as they happen
+    void print() const;
+
+private:
+    void atomIndex();
+    void atomSnapshot();
+    void jsonReader();
+    void jsonTape();
+    void jsonWriter();
+    void jsonQuery();
+    void cbor();
+    void scannerPush();
+    void handleCache();
+    void vfsPaths();
+    void ramFS();
+    void statCache();
+    void romFS();
+    void watches();
+    void kvStore();
+
+    bool check(bool passed, const char* expr, const char* file, int line);
+
+    // Whole files on fs, or system()->fileSystem() if it's null
+    static bool writeFile(const char* path, const char* data, uint32_t size, FS* fs = nullptr);
+    static bool readFile(const char* path, Vector<char>& data, FS* fs = nullptr);
+    static String readFile(const char* path, FS* fs = nullptr);
+
+    LittleFS* _fs;
+    const char* _group = "";
+    uint32_t _checks = 0;
+    uint32_t _failures = 0;
+};
+
+#define CHECK(expr) check((expr), #expr, __FILE__, __LINE__)
+
+}
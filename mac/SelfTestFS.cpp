@@ -0,0 +1,382 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "SelfTest.h"
+
+#include "RamFS.h"
+#include "RomFS.h"
+#include "SystemInterface.h"
+#include "VFS.h"
+
+using namespace m8r;
+
+// Names in the directory, sorted and comma separated, or "missing"
+static String listDirectory(FS* fs, const char* path)
+{
+    Mad<Directory> dir = fs->openDirectory(path);
+    if (!dir.valid() || !dir->valid()) {
+        if (dir.valid()) {
+            dir.destroy(MemoryType::Native);
+        }
+        return "missing";
+    }
+    Vector<String> names;
+    for ( ; dir->valid(); dir->next()) {
+        names.push_back(dir->name());
+    }
+    dir.destroy(MemoryType::Native);
+    std::sort(names.begin(), names.end());
+    return String::join(names, ",");
+}
+
+// Error from opening path, which is OK if it opened
+static Error::Code openError(FS* fs, const char* path, FS::FileOpenMode mode)
+{
+    Mad<File> file = fs->open(path, mode);
+    Error::Code code = file.valid() ? file->error().code() : Error::Code::NoFS;
+    fs->release(file);
+    return code;
+}
+
+void SelfTest::vfsPaths()
+{
+    RamFS rootFS(16 * 1024);
+    RamFS tmpFS(16 * 1024);
+    RamFS deepFS(16 * 1024);
+    VFS vfs;
+
+    CHECK(!vfs.mounted());
+    Mad<File> unmounted = vfs.open("/a", FS::FileOpenMode::Write);
+    CHECK(!unmounted.valid() || !unmounted->valid());
+    vfs.release(unmounted);
+
+    CHECK(vfs.addMount("/", &rootFS));
+    CHECK(vfs.addMount("/tmp/", &tmpFS));
+    CHECK(vfs.addMount("/tmp/deep", &deepFS));
+    CHECK(!vfs.addMount("/tmp", &deepFS));
+    CHECK(!vfs.addMount("relative", &deepFS));
+    CHECK(vfs.mountedAt("/tmp") == &tmpFS);
+    CHECK(vfs.mount() && vfs.mounted());
+
+    // Each path goes to the longest prefix that matches whole components,
+    // with the prefix taken off
+    CHECK(writeFile("/a", "root", 4, &vfs));
+    CHECK(writeFile("/tmp/a", "tmp", 3, &vfs));
+    CHECK(writeFile("/tmpfile", "root", 4, &vfs));
+    CHECK(writeFile("/tmp/deep/a", "deep", 4, &vfs));
+    CHECK(writeFile("/tmp/deeper", "tmp", 3, &vfs));
+    CHECK(listDirectory(&rootFS, "/") == "a,tmpfile");
+    CHECK(listDirectory(&tmpFS, "/") == "a,deeper");
+    CHECK(listDirectory(&deepFS, "/") == "a");
+    CHECK(readFile("/tmp/deep/a", &vfs) == "deep");
+    CHECK(readFile("/tmp/deep/../a", &vfs) == "missing");
+
+    // A mount point is the root of its filesystem
+    FS::Info info;
+    CHECK(vfs.stat("/tmp", info) && info.directory);
+    CHECK(vfs.stat("/tmp/deep/", info) && info.directory);
+    CHECK(listDirectory(&vfs, "/tmp") == "a,deeper");
+
+    // Directories are made on the filesystem they resolve to
+    CHECK(vfs.makeDirectory("/tmp/d/e"));
+    CHECK(writeFile("/tmp/d/e/f", "f", 1, &vfs));
+    CHECK(tmpFS.exists("/d/e/f") && !rootFS.exists("/tmp/d/e/f"));
+    CHECK(!writeFile("/tmp/nodir/f", "f", 1, &vfs));
+
+    // Resolving more directories than the cache holds, then going back,
+    // still gets the right filesystem
+    bool resolved = true;
+    for (uint8_t round = 0; round < 2; ++round) {
+        for (uint8_t i = 0; i < VFS::ResolveCacheSize * 2; ++i) {
+            String dir = String::format("/tmp/c%u", i);
+            vfs.makeDirectory(dir.c_str());
+            resolved = resolved && writeFile((dir + "/f").c_str(), "c", 1, &vfs) && tmpFS.exists(String::format("/c%u/f", i).c_str());
+        }
+        resolved = resolved && readFile("/a", &vfs) == "root" && readFile("/tmp/deep/a", &vfs) == "deep";
+    }
+    CHECK(resolved);
+
+    // Renames work within a filesystem but not between them
+    CHECK(vfs.rename("/tmp/a", "/tmp/b") && readFile("/tmp/b", &vfs) == "tmp" && !tmpFS.exists("/a"));
+    CHECK(!vfs.rename("/tmp/b", "/b") && vfs.lastError().code() == Error::Code::Unimplemented);
+    CHECK(vfs.remove("/tmp/b") && !vfs.exists("/tmp/b"));
+
+    // Once a mount is removed its paths go to the next longest prefix
+    CHECK(vfs.removeMount("/tmp/deep"));
+    CHECK(!vfs.removeMount("/tmp/deep"));
+    CHECK(readFile("/tmp/deep/a", &vfs) == "missing");
+    CHECK(vfs.makeDirectory("/tmp/deep") && writeFile("/tmp/deep/a", "now tmp", 7, &vfs));
+    CHECK(readFile("/deep/a", &tmpFS) == "now tmp" && readFile("/a", &deepFS) == "deep");
+}
+
+void SelfTest::ramFS()
+{
+    RamFS fs(RamFS::ChunkSize * 8);
+    CHECK(openError(&fs, "/a", FS::FileOpenMode::Write) == Error::Code::NotMounted);
+    CHECK(fs.mount());
+
+    // Files span chunks and read back whole
+    String data;
+    for (uint16_t i = 0; i < RamFS::ChunkSize * 3 + 10; ++i) {
+        data += static_cast<char>('a' + i % 26);
+    }
+    CHECK(writeFile("/big", data.c_str(), data.size(), &fs));
+    CHECK(readFile("/big", &fs) == data);
+    FS::Info info;
+    CHECK(fs.stat("/big", info) && !info.directory && info.size == data.size());
+    CHECK(fs.totalUsed() == RamFS::ChunkSize * 4);
+
+    // Paths are normalized, and parents must exist
+    CHECK(fs.makeDirectory("/d/e/"));
+    CHECK(fs.stat("/d", info) && info.directory);
+    CHECK(writeFile("d/e/f", "f", 1, &fs) && readFile("/d/e/f/", &fs) == "f");
+    CHECK(openError(&fs, "/x/f", FS::FileOpenMode::Write) == Error::Code::DirectoryNotFound);
+    CHECK(openError(&fs, "/d", FS::FileOpenMode::Write) == Error::Code::NotAFile);
+    CHECK(openError(&fs, "/missing", FS::FileOpenMode::Read) == Error::Code::FileNotFound);
+    CHECK(!fs.makeDirectory("/big/sub") && fs.lastError().code() == Error::Code::NotADirectory);
+    CHECK(fs.mounted());
+
+    // Directories only go when empty, and move with what's in them
+    CHECK(!fs.remove("/d"));
+    CHECK(fs.rename("/d", "/moved"));
+    CHECK(readFile("/moved/e/f", &fs) == "f" && !fs.exists("/d/e/f"));
+    CHECK(!fs.rename("/moved/e/f", "/nodir/f"));
+    CHECK(!fs.rename("/moved", "/moved/e/inside") && fs.lastError().code() == Error::Code::InvalidArgumentValue);
+    CHECK(!fs.rename("/moved", "/moved/") && !fs.rename("/moved/e/f", "/moved/e/f"));
+    CHECK(fs.rename("/moved/e", "/moved/e2") && fs.rename("/moved/e2", "/moved/e"));
+    CHECK(listDirectory(&fs, "/moved") == "e" && readFile("/moved/e/f", &fs) == "f");
+    CHECK(fs.remove("/moved/e/f") && fs.remove("/moved/e") && fs.remove("/moved"));
+    CHECK(listDirectory(&fs, "/") == "big");
+
+    // Writing past maxSize fails, and freeing space makes room again
+    CHECK(!writeFile("/more", data.c_str(), data.size() + RamFS::ChunkSize, &fs));
+    CHECK(fs.totalUsed() == fs.totalSize());
+    CHECK(fs.remove("/more") && fs.remove("/big"));
+    CHECK(fs.totalUsed() == 0);
+    CHECK(writeFile("/more", data.c_str(), data.size(), &fs));
+
+    // Contents survive an unmount but not a format
+    fs.unmount();
+    CHECK(fs.mount() && readFile("/more", &fs) == data);
+    CHECK(fs.format() && !fs.exists("/more"));
+}
+
+void SelfTest::romFS()
+{
+    // Sorted by path, as --build-romfs writes them. "/dir.txt" sorts
+    // before "/dir/..." and "/dir0" after, so directories have to be
+    // told apart from names that share their prefix
+    static const char Plain[] = "plain text";
+    static const char Gzip[] = "\x1f\x8b not really";
+    static const RomFS::Asset Assets[] = {
+        { "/a.txt", Plain, sizeof(Plain) - 1, Gzip, sizeof(Gzip) - 1, "text/plain", "\"1\"" },
+        { "/dir.txt", "x", 1, nullptr, 0, nullptr, nullptr },
+        { "/dir/b.txt", "bb", 2, nullptr, 0, nullptr, nullptr },
+        { "/dir/sub/c.txt", "ccc", 3, nullptr, 0, nullptr, nullptr },
+        { "/dir/sub/d.txt", "dddd", 4, nullptr, 0, nullptr, nullptr },
+        { "/dir0", "0", 1, nullptr, 0, nullptr, nullptr },
+    };
+    RomFS fs(RomFS::Bundle { Assets, sizeof(Assets) / sizeof(RomFS::Asset) });
+    CHECK(!fs.exists("/a.txt"));
+    CHECK(fs.mount());
+
+    bool found = true;
+    for (const auto& it : Assets) {
+        found = found && fs.find(it.path) == &it && readFile(it.path, &fs) == String(it.data, it.size);
+    }
+    CHECK(found);
+    CHECK(fs.find("dir/b.txt/") == &Assets[2]);
+    CHECK(!fs.find("/dir") && !fs.find("/di") && !fs.find("/zzz") && !fs.find("/"));
+
+    FS::Info info;
+    CHECK(fs.stat("/dir", info) && info.directory);
+    CHECK(fs.stat("/dir/sub/", info) && info.directory);
+    CHECK(fs.stat("/dir/sub/c.txt", info) && !info.directory && info.size == 3);
+    CHECK(!fs.stat("/di", info) && !fs.stat("/dir/su", info) && !fs.stat("/dir0/x", info));
+    CHECK(fs.stat("/", info) && info.directory);
+
+    // Subdirectories are listed once, among the files
+    CHECK(listDirectory(&fs, "/") == "a.txt,dir,dir.txt,dir0");
+    CHECK(listDirectory(&fs, "/dir") == "b.txt,sub");
+    CHECK(listDirectory(&fs, "/dir/sub/") == "c.txt,d.txt");
+    CHECK(listDirectory(&fs, "/dir/b.txt") == "missing");
+    CHECK(listDirectory(&fs, "/nowhere") == "missing");
+
+    // Reads are of the plain bytes, and seek within them
+    Mad<File> file = fs.open("/a.txt", FS::FileOpenMode::Read);
+    char buf[16];
+    CHECK(file->seek(-4, File::SeekWhence::End) && file->read(buf, sizeof(buf)) == 4 && memcmp(buf, "text", 4) == 0);
+    CHECK(file->read(buf, sizeof(buf)) == 0);
+    CHECK(file->seek(6, File::SeekWhence::Set) && file->tell() == 6 && !file->seek(-7, File::SeekWhence::Cur));
+    CHECK(file->write("x", 1) < 0);
+    fs.release(file);
+
+    // Nothing can be changed
+    CHECK(openError(&fs, "/a.txt", FS::FileOpenMode::Write) == Error::Code::NotWritable);
+    CHECK(openError(&fs, "/dir", FS::FileOpenMode::Read) == Error::Code::NotAFile);
+    CHECK(openError(&fs, "/none", FS::FileOpenMode::Read) == Error::Code::FileNotFound);
+    CHECK(!fs.remove("/a.txt") && !fs.rename("/a.txt", "/b.txt") && fs.exists("/a.txt"));
+    CHECK(fs.makeDirectory("/dir/sub") && !fs.makeDirectory("/newdir"));
+
+    // Mappings have both copies and the precomputed headers
+    FS::Mapping mapping;
+    CHECK(fs.map("/a.txt", mapping));
+    CHECK(mapping.data == Plain && mapping.size == sizeof(Plain) - 1);
+    CHECK(mapping.gzipData == Gzip && mapping.gzipSize == sizeof(Gzip) - 1);
+    CHECK(strcmp(mapping.contentType, "text/plain") == 0 && strcmp(mapping.etag, "\"1\"") == 0);
+    CHECK(fs.map("/dir0", mapping) && !mapping.gzipData && !mapping.etag);
+    CHECK(!fs.map("/dir", mapping) && !fs.map("/none", mapping));
+
+    // The web UI bundle is at /sys/web, with every asset readable as plain
+    // bytes and a gzipped copy that's smaller. Only the scratch filesystem
+    // is mounted for the checks, so mount it here
+    VFS* system = static_cast<VFS*>(m8r::system()->fileSystem());
+    FS* web = system->mountedAt("/sys/web");
+    if (!CHECK(web && web->mount() && system->map("/sys/web/index.html", mapping))) {
+        return;
+    }
+    CHECK(strcmp(mapping.contentType, "text/html") == 0 && mapping.etag);
+    CHECK(mapping.gzipData && mapping.gzipSize < mapping.size);
+    CHECK(static_cast<uint8_t>(mapping.gzipData[0]) == 0x1f && static_cast<uint8_t>(mapping.gzipData[1]) == 0x8b);
+    String index = readFile("/sys/web/index.html");
+    CHECK(index.size() == mapping.size && memcmp(index.c_str(), mapping.data, mapping.size) == 0);
+    CHECK(strstr(index.c_str(), "<html") || strstr(index.c_str(), "<!DOCTYPE") || strstr(index.c_str(), "<HTML"));
+    CHECK(listDirectory(system, "/sys/web") == "favicon.ico,index.html");
+    web->unmount();
+}
+
+// Records changes as "<tag>:<change> <path>[ <newPath>]" lines
+class WatchLog
+{
+public:
+    FS::WatchFunction watcher(const char* tag)
+    {
+        String prefix(tag);
+        return [this, prefix](FS::Change change, const String& path, const String& newPath) {
+            static const char* Changes[] = { "create", "modify", "remove", "rename" };
+            _log += prefix + ":" + Changes[static_cast<int>(change)] + " " + path;
+            if (!newPath.empty()) {
+                _log += " " + newPath;
+            }
+            _log += "\n";
+        };
+    }
+
+    // Dispatch the queued changes and return what was seen since last time
+    String take()
+    {
+        FS::dispatchChanges();
+        String log = _log;
+        _log = String();
+        return log;
+    }
+
+private:
+    String _log;
+};
+
+void SelfTest::watches()
+{
+    FS::dispatchChanges();
+
+    RamFS fs(16 * 1024);
+    fs.mount();
+    fs.makeDirectory("/d/e");
+    WatchLog log;
+
+    // An exact watch sees its path, a prefix watch everything below, and
+    // neither sees names that only share the prefix
+    int16_t exact = fs.watch("/d/f", false, log.watcher("exact"));
+    int16_t prefix = fs.watch("/d/", true, log.watcher("prefix"));
+    CHECK(exact >= 0 && prefix >= 0 && exact != prefix);
+    CHECK(fs.watch("/x", false, FS::WatchFunction()) < 0);
+
+    writeFile("/d/f", "f", 1, &fs);
+    CHECK(log.take() == "exact:create /d/f\nprefix:create /d/f\nexact:modify /d/f\nprefix:modify /d/f\n");
+    writeFile("/d/e/g", "g", 1, &fs);
+    writeFile("/dx", "x", 1, &fs);
+    fs.makeDirectory("/dy/z");
+    CHECK(log.take() == "prefix:create /d/e/g\nprefix:modify /d/e/g\n");
+
+    // Changes queue until they're dispatched
+    fs.remove("/d/e/g");
+    CHECK(FS::dispatchChanges() && !FS::dispatchChanges());
+    log.take();
+
+    // Renaming or removing a directory above a watch takes the path with it
+    int16_t deep = fs.watch("/d/e/h", false, log.watcher("deep"));
+    fs.rename("/d", "/moved");
+    CHECK(log.take() == "exact:rename /d /moved\nprefix:rename /d /moved\ndeep:rename /d /moved\n");
+    fs.rename("/moved", "/d");
+    log.take();
+
+    // A rename onto a watched path is seen too
+    fs.unwatch(prefix);
+    writeFile("/elsewhere", "e", 1, &fs);
+    fs.rename("/elsewhere", "/d/f");
+    CHECK(log.take() == "exact:rename /elsewhere /d/f\n");
+
+    // Unwatching drops changes already queued for it
+    fs.remove("/d/f");
+    fs.unwatch(exact);
+    fs.unwatch(deep);
+    CHECK(log.take() == "");
+
+    // Functions can make changes, which go in the next batch
+    int16_t chained = fs.watch("/a", false, [&fs](FS::Change change, const String&, const String&) {
+        if (change == FS::Change::Create) {
+            fs.makeDirectory("/b");
+        }
+    });
+    int16_t second = fs.watch("/b", false, log.watcher("chained"));
+    fs.makeDirectory("/a");
+    CHECK(FS::dispatchChanges() && log.take() == "chained:create /b\n");
+    fs.unwatch(chained);
+    fs.unwatch(second);
+
+    // Through a VFS the paths are in the VFS tree, and a prefix watch
+    // covers filesystems mounted below it
+    RamFS rootFS(16 * 1024);
+    VFS vfs;
+    vfs.addMount("/", &rootFS);
+    vfs.addMount("/tmp", &fs);
+    vfs.mount();
+    int16_t all = vfs.watch("/", true, log.watcher("all"));
+    int16_t tmp = vfs.watch("/tmp/d/f", false, log.watcher("tmp"));
+    CHECK(all >= 0 && tmp >= 0);
+    writeFile("/tmp/d/f", "f", 1, &vfs);
+    vfs.remove("/top");
+    writeFile("/top", "t", 1, &vfs);
+    vfs.rename("/tmp/d/f", "/tmp/d/g");
+    CHECK(log.take() ==
+          "all:create /tmp/d/f\ntmp:create /tmp/d/f\nall:modify /tmp/d/f\ntmp:modify /tmp/d/f\n"
+          "all:create /top\nall:modify /top\n"
+          "all:rename /tmp/d/f /tmp/d/g\ntmp:rename /tmp/d/f /tmp/d/g\n");
+
+    vfs.unwatch(all);
+    vfs.unwatch(tmp);
+    writeFile("/tmp/d/f", "f", 1, &vfs);
+    writeFile("/top", "t", 1, &vfs);
+    CHECK(log.take() == "");
+
+    // LittleFS looks before creating a watched file, and the file is there
+    // as soon as the open succeeds, not just once it's released
+    _fs->remove("/watched.log");
+    int16_t logWatch = _fs->watch("/watched.log", false, log.watcher("log"));
+    Mad<File> file = _fs->open("/watched.log", FS::FileOpenMode::Append);
+    CHECK(file->valid() && file->write("entry", 5) == 5);
+    FS::Info info;
+    CHECK(_fs->exists("/watched.log") && _fs->stat("/watched.log", info) && !info.directory);
+    CHECK(openError(_fs, "/watched.log", FS::FileOpenMode::Read) == Error::Code::OK);
+    _fs->release(file);
+    CHECK(log.take() == "log:create /watched.log\nlog:modify /watched.log\n");
+    CHECK(readFile("/watched.log", _fs) == "entry");
+    _fs->unwatch(logWatch);
+    _fs->remove("/watched.log");
+}
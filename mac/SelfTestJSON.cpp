@@ -0,0 +1,420 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "SelfTest.h"
+
+#include "CBOR.h"
+#include "FileStream.h"
+#include "JSONQuery.h"
+#include "JSONReader.h"
+#include "JSONTape.h"
+#include "JSONWriter.h"
+#include "SystemInterface.h"
+
+using namespace m8r;
+
+// Compact, as JSONWriter writes it, so a round trip gives the same text
+static const char* Document =
+    "{\"name\":\"m8r\",\"list\":[1,2.5,-3,true,false,null],"
+    "\"nested\":{\"a\":{\"b\":[]},\"c\":{}},\"text\":\"tab\\tquote\\\"slash\\\\\"}";
+
+// Writes each JSONReader event back out with a JSONWriter
+class EchoHandler : public JSONReader::Handler
+{
+public:
+    EchoHandler(JSONWriter& writer) : _writer(writer) { }
+
+    virtual void startObject() override { _writer.startObject(); }
+    virtual void endObject() override { _writer.endObject(); }
+    virtual void startArray() override { _writer.startArray(); }
+    virtual void endArray() override { _writer.endArray(); }
+    virtual void key(const char* s, uint16_t length) override { _writer.key(String(s, length)); }
+    virtual void string(const char* s, uint16_t length) override { _writer.value(String(s, length)); }
+    virtual void number(float v) override { _writer.value(v); }
+    virtual void boolean(bool v) override { _writer.value(v); }
+    virtual void null() override { _writer.null(); }
+    virtual void bytes(const uint8_t* data, uint32_t size) override { _writer.bytes(data, size); }
+
+private:
+    JSONWriter& _writer;
+};
+
+// Parse json in chunks of chunkSize and return what EchoHandler wrote,
+// or "error" if the parse failed
+static String echo(const char* json, uint32_t chunkSize = 0)
+{
+    String out;
+    bool success;
+    {
+        JSONWriter writer(out);
+        EchoHandler handler(writer);
+        JSONReader reader(&handler);
+        uint32_t size = static_cast<uint32_t>(strlen(json));
+        if (!chunkSize) {
+            success = reader.parse(json, size);
+        } else {
+            success = true;
+            for (uint32_t i = 0; i < size && success; i += chunkSize) {
+                success = reader.feed(json + i, std::min(chunkSize, size - i));
+            }
+            success = success && reader.finish();
+        }
+    }
+    return success ? out : String("error");
+}
+
+void SelfTest::jsonReader()
+{
+    CHECK(echo(Document) == Document);
+    CHECK(echo(" [ 1 ,\n\t{ \"a\" : null } ] ") == "[1,{\"a\":null}]");
+
+    // Tokens split across chunks are picked up where they left off
+    CHECK(echo(Document, 1) == Document);
+    CHECK(echo(Document, 7) == Document);
+
+    // Escapes are decoded, surrogate pairs are combined and a lone
+    // surrogate is U+FFFD
+    CHECK(echo("\"\\u00e9\"") == "\"\xc3\xa9\"");
+    CHECK(echo("\"\\ud83d\\ude00\"") == "\"\xf0\x9f\x98\x80\"");
+    CHECK(echo("\"\\ud83dx\"") == "\"\xef\xbf\xbdx\"");
+    CHECK(echo("\"\\ude00\"") == "\"\xef\xbf\xbd\"");
+
+    // Strings past the initial buffer size grow it
+    String longString = "\"";
+    for (uint16_t i = 0; i < JSONReader::InitialStringSize * 4; ++i) {
+        longString += static_cast<char>('a' + i % 26);
+    }
+    longString += "\"";
+    CHECK(echo(longString.c_str()) == longString);
+
+    // Errors
+    CHECK(echo("[1,]") == "error");
+    CHECK(echo("{\"a\" 1}") == "error");
+    CHECK(echo("[1") == "error");
+    CHECK(echo("[1] 2") == "error");
+    CHECK(echo("tru") == "error");
+
+    String deep;
+    for (uint8_t i = 0; i <= JSONReader::MaxDepth; ++i) {
+        deep += "[";
+    }
+    CHECK(echo(deep.c_str()) == "error");
+
+    JSONReader::Handler ignore;
+    JSONReader small(&ignore, 8);
+    CHECK(small.parse("\"1234567\"", 9));
+    small.reset();
+    CHECK(!small.parse("\"12345678\"", 10));
+
+    // Errors are located by line and column
+    JSONReader located(&ignore);
+    CHECK(!located.parse("[1,\n  2,\n  x]", 13));
+    CHECK(located.line() == 3 && located.column() == 3);
+}
+
+void SelfTest::jsonTape()
+{
+    JSONTape tape;
+    CHECK(tape.parse(Document));
+    CHECK(tape.stringify() == Document);
+
+    String written;
+    {
+        JSONWriter writer(written);
+        tape.write(writer, tape.root());
+    }
+    CHECK(written == Document);
+
+    JSONTape::Value root = tape.root();
+    CHECK(root.isObject() && root.size() == 4);
+    CHECK(strcmp(root["name"].toString(), "m8r") == 0 && root["name"].size() == 3);
+    CHECK(strcmp(root["text"].toString(), "tab\tquote\"slash\\") == 0);
+    CHECK(!root["missing"].valid());
+
+    JSONTape::Value list = root["list"];
+    CHECK(list.isArray() && list.size() == 6);
+    CHECK(list[0u].toFloat() == 1 && list[1u].toFloat() == 2.5f && list[2u].toFloat() == -3);
+    CHECK(list[3u].isBool() && list[3u].toBool() && list[4u].isBool() && !list[4u].toBool());
+    CHECK(list[5u].isNull());
+    CHECK(!list[6u].valid());
+
+    // Lookups skip over nested containers
+    CHECK(root["nested"]["a"]["b"].isArray() && root["nested"]["a"]["b"].size() == 0);
+    CHECK(root["nested"]["c"].isObject() && root["nested"]["c"].size() == 0);
+    CHECK(tape.stringify(root["nested"]) == "{\"a\":{\"b\":[]},\"c\":{}}");
+
+    // Members come in order, as keys with their values
+    String keys;
+    uint32_t elements = 0;
+    for (JSONTape::Value it = root.first(); it.valid(); it = it.next()) {
+        keys += it.toString();
+        keys += it.value().valid() ? "," : "?";
+    }
+    for (JSONTape::Value it = list.first(); it.valid(); it = it.next()) {
+        ++elements;
+    }
+    CHECK(keys == "name,list,nested,text,");
+    CHECK(elements == 6);
+
+    // Scalars at the top level
+    CHECK(tape.parse(String("\"top\"")) && tape.root().isString() && strcmp(tape.root().toString(), "top") == 0);
+    CHECK(tape.parse(String("-0.5")) && tape.root().toFloat() == -0.5f);
+
+    // A failed parse leaves no document, and the tape can be reused
+    CHECK(!tape.parse(String("{\"a\":[1,2}")));
+    CHECK(tape.error() && !tape.root().valid());
+    CHECK(tape.parse(Document) && tape.stringify() == Document);
+    CHECK(tape.size() > 0);
+}
+
+// Writes Document token by token
+static void writeDocument(JSONWriter& writer)
+{
+    writer.startObject();
+    writer.key("name").value("m8r");
+    writer.key("list").startArray().value(int32_t(1)).value(2.5f).value(-3.0f).value(true).value(false).null().endArray();
+    writer.key("nested").startObject();
+    writer.key("a").startObject().key("b").startArray().endArray().endObject();
+    writer.key("c").startObject().endObject();
+    writer.endObject();
+    writer.key("text").value("tab\tquote\"slash\\");
+    writer.endObject();
+}
+
+void SelfTest::jsonWriter()
+{
+    // Every output target gets the same bytes, and counting gives their size
+    String string;
+    {
+        JSONWriter writer(string);
+        writeDocument(writer);
+        CHECK(writer.valid());
+    }
+    CHECK(string == Document);
+
+    JSONWriter counter;
+    writeDocument(counter);
+    counter.flush();
+    CHECK(counter.size() == strlen(Document));
+
+    String sunk;
+    uint16_t chunks = 0;
+    bool chunksFit = true;
+    {
+        JSONWriter writer([&](const char* data, uint16_t size) {
+            sunk += String(data, size);
+            chunksFit = chunksFit && size <= JSONWriter::BufferSize;
+            ++chunks;
+        });
+        writeDocument(writer);
+    }
+    CHECK(sunk == Document);
+    CHECK(chunks > 1 && chunksFit);
+
+    Mad<File> file = system()->fileSystem()->open("/json", FS::FileOpenMode::Write);
+    {
+        FileStream stream(file);
+        JSONWriter writer(&stream);
+        writeDocument(writer);
+    }
+    system()->fileSystem()->release(file);
+    Vector<char> streamed;
+    CHECK(readFile("/json", streamed));
+    CHECK(String(streamed.begin(), streamed.size()) == Document);
+
+    // Control characters are escaped so the output parses
+    String escaped;
+    {
+        JSONWriter writer(escaped);
+        writer.value("\x01\n\xc3\xa9");
+    }
+    CHECK(escaped == "\"\\u0001\\n\xc3\xa9\"");
+    CHECK(echo(escaped.c_str()) == escaped);
+
+    // Bytes are base64
+    String encoded;
+    {
+        JSONWriter writer(encoded);
+        static const uint8_t Data[] = { 'm', '8', 'r', 's' };
+        writer.bytes(Data, sizeof(Data));
+    }
+    CHECK(encoded == "\"bThycw==\"");
+
+    // Unbalanced or too deep nesting makes the writer invalid
+    JSONWriter unbalanced;
+    unbalanced.startArray().endArray().endArray();
+    CHECK(!unbalanced.valid());
+
+    JSONWriter missingValue;
+    missingValue.startObject().key("a").endObject();
+    CHECK(!missingValue.valid());
+
+    String deep;
+    {
+        JSONWriter writer(deep);
+        for (uint8_t i = 0; i <= JSONWriter::MaxDepth; ++i) {
+            writer.startArray();
+        }
+        CHECK(!writer.valid());
+    }
+    CHECK(deep.size() == JSONWriter::MaxDepth);
+}
+
+void SelfTest::jsonQuery()
+{
+    uint32_t size = static_cast<uint32_t>(strlen(Document));
+    JSONQuery query(Document, size);
+
+    // Views are in place in the text
+    JSONQuery::View whole = query.find("");
+    CHECK(whole.type() == JSONQuery::Type::Object && whole.data() == Document && whole.size() == size);
+    JSONQuery::View name = query.find("/name");
+    CHECK(name.type() == JSONQuery::Type::String && name.data() > Document && name.data() < Document + size);
+    CHECK(String(name.data(), name.size()) == "m8r");
+
+    // Every value the tape sees is found with the same contents
+    JSONTape tape;
+    tape.parse(Document);
+    JSONTape::Value list = tape.root()["list"];
+    bool sameNumbers = true;
+    for (uint32_t i = 0; i < 3; ++i) {
+        float value = 0;
+        sameNumbers = sameNumbers && query.getFloat(String::format("/list/%u", i).c_str(), value) && value == list[i].toFloat();
+    }
+    CHECK(sameNumbers);
+
+    bool flag = false;
+    CHECK(query.getBool("/list/3", flag) && flag);
+    CHECK(query.getBool("/list/4", flag) && !flag);
+    CHECK(query.find("/list/5").type() == JSONQuery::Type::Null);
+
+    String text;
+    CHECK(query.getString("/text", text) && text == tape.root()["text"].toString());
+    CHECK(String(query.find("/text").data(), query.find("/text").size()) == "tab\\tquote\\\"slash\\\\");
+
+    JSONQuery::View empty = query.find("/nested/a/b");
+    CHECK(empty.type() == JSONQuery::Type::Array && String(empty.data(), empty.size()) == "[]");
+    CHECK(query.find("/nested/c").type() == JSONQuery::Type::Object);
+
+    // Missing members, indexes out of range, bad indexes and wrong types
+    CHECK(!query.find("/missing").valid());
+    CHECK(!query.find("/list/6").valid());
+    CHECK(!query.find("/list/01").valid());
+    CHECK(!query.find("/list/x").valid());
+    CHECK(!query.find("/name/0").valid());
+    float number = 0;
+    CHECK(!query.getFloat("/name", number));
+    CHECK(!query.getString("/list/0", text));
+
+    // ~1 and ~0 escape '/' and '~' in keys, and whitespace is skipped
+    const char* escapedKeys = " { \"a/b\" : 1 , \"m~n\" : [ 10 , { \"x\" : \"y\" } ] } ";
+    JSONQuery escapedQuery(escapedKeys, static_cast<uint32_t>(strlen(escapedKeys)));
+    float value = 0;
+    CHECK(escapedQuery.getFloat("/a~1b", value) && value == 1);
+    CHECK(escapedQuery.getFloat("/m~0n/0", value) && value == 10);
+    CHECK(escapedQuery.getString("/m~0n/1/x", text) && text == "y");
+    CHECK(!escapedQuery.find("/a/b").valid());
+    CHECK(!escapedQuery.find("/m~xn/0").valid() && !escapedQuery.find("/m~").valid());
+
+    // Indexes too big for 32 bits don't wrap around
+    CHECK(!query.find("/list/4294967296").valid() && !query.find("/list/99999999999999999999").valid());
+
+    // Unpaired surrogates decode to U+FFFD, as they do in JSONReader
+    const char* surrogates = "{ \"s\" : \"a\\ud800b\", \"\\udc00\" : 1 }";
+    JSONQuery surrogateQuery(surrogates, static_cast<uint32_t>(strlen(surrogates)));
+    JSONTape surrogateTape;
+    CHECK(surrogateTape.parse(surrogates));
+    CHECK(surrogateQuery.getString("/s", text) && text == "a\xef\xbf\xbd" "b" && text == surrogateTape.root()["s"].toString());
+    CHECK(surrogateQuery.getFloat("/\xef\xbf\xbd", value) && value == 1);
+}
+
+// Decode CBOR and return it as JSON text, or "error"
+static String cborToJSON(const Vector<uint8_t>& cbor)
+{
+    String out;
+    bool success;
+    {
+        JSONWriter writer(out);
+        EchoHandler handler(writer);
+        CBORReader reader(&handler);
+        success = reader.parse(cbor.begin(), static_cast<uint32_t>(cbor.size()));
+    }
+    return success ? out : String("error");
+}
+
+static Vector<uint8_t> toCBOR(const std::function<void(JSONWriter&)>& f)
+{
+    Vector<uint8_t> out;
+    {
+        CBORWriter writer([&out](const char* data, uint16_t size) {
+            for (uint16_t i = 0; i < size; ++i) {
+                out.push_back(static_cast<uint8_t>(data[i]));
+            }
+        });
+        f(writer);
+    }
+    return out;
+}
+
+static bool encodes(const std::function<void(JSONWriter&)>& f, const Vector<uint8_t>& expected)
+{
+    Vector<uint8_t> cbor = toCBOR(f);
+    return cbor.size() == expected.size() && memcmp(cbor.begin(), expected.begin(), cbor.size()) == 0;
+}
+
+void SelfTest::cbor()
+{
+    // The document round trips through CBOR, and the tape writes the same bytes
+    Vector<uint8_t> cbor = toCBOR(writeDocument);
+    CHECK(cborToJSON(cbor) == Document);
+    CHECK(cbor.size() < strlen(Document));
+
+    JSONTape tape;
+    tape.parse(Document);
+    Vector<uint8_t> fromTape = toCBOR([&tape](JSONWriter& writer) { tape.write(writer, tape.root()); });
+    CHECK(fromTape.size() == cbor.size() && memcmp(fromTape.begin(), cbor.begin(), cbor.size()) == 0);
+
+    CBORWriter counter;
+    writeDocument(counter);
+    counter.flush();
+    CHECK(counter.size() == cbor.size());
+
+    // Encodings from RFC 7049 appendix A. Integral floats are integers
+    CHECK(encodes([](JSONWriter& w) { w.value(int32_t(10)); }, { 0x0a }));
+    CHECK(encodes([](JSONWriter& w) { w.value(int32_t(500)); }, { 0x19, 0x01, 0xf4 }));
+    CHECK(encodes([](JSONWriter& w) { w.value(int32_t(-1)); }, { 0x20 }));
+    CHECK(encodes([](JSONWriter& w) { w.value(int32_t(-1000)); }, { 0x39, 0x03, 0xe7 }));
+    CHECK(encodes([](JSONWriter& w) { w.value(2.0f); }, { 0x02 }));
+    CHECK(encodes([](JSONWriter& w) { w.value(2.5f); }, { 0xfa, 0x40, 0x20, 0x00, 0x00 }));
+    CHECK(encodes([](JSONWriter& w) { w.value(true).value(false).null(); }, { 0xf5, 0xf4, 0xf6 }));
+    CHECK(encodes([](JSONWriter& w) { w.value("IETF"); }, { 0x64, 'I', 'E', 'T', 'F' }));
+    CHECK(encodes([](JSONWriter& w) { w.startObject().key("a").startArray().endArray().endObject(); }, { 0xbf, 0x61, 'a', 0x9f, 0xff, 0xff }));
+    CHECK(encodes([](JSONWriter& w) { static const uint8_t b[] = { 1, 2, 3 }; w.bytes(b, 3); }, { 0x43, 1, 2, 3 }));
+
+    // The reader takes definite lengths, other float sizes and tags
+    CHECK(cborToJSON({ 0xa1, 0x61, 'a', 0x82, 0x01, 0x38, 0x63 }) == "{\"a\":[1,-100]}");
+    CHECK(cborToJSON({ 0xf9, 0x3c, 0x00 }) == "1");
+    CHECK(cborToJSON({ 0xfb, 0x3f, 0xf8, 0, 0, 0, 0, 0, 0 }) == "1.5");
+    CHECK(cborToJSON({ 0xc1, 0x19, 0x01, 0xf4 }) == "500");
+    CHECK(cborToJSON({ 0x43, 'm', '8', 'r' }) == "\"bThy\"");
+
+    // Truncated input, non-text keys, unclosed containers and extra bytes fail
+    Vector<uint8_t> truncated = cbor;
+    truncated.resize(truncated.size() - 1);
+    CHECK(cborToJSON(truncated) == "error");
+    CHECK(cborToJSON({ 0x19, 0x01 }) == "error");
+    CHECK(cborToJSON({ 0xa1, 0x01, 0x02 }) == "error");
+    CHECK(cborToJSON({ 0x9f, 0x01 }) == "error");
+    CHECK(cborToJSON({ 0x01, 0x02 }) == "error");
+
+    JSONReader::Handler ignore;
+    CBORReader reader(&ignore);
+    static const uint8_t BadKey[] = { 0xa1, 0x01, 0x02 };
+    CHECK(!reader.parse(BadKey, sizeof(BadKey)) && reader.offset() == 1);
+}
@@ -0,0 +1,147 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "SelfTest.h"
+
+#include "KVStore.h"
+#include "SystemInterface.h"
+
+using namespace m8r;
+
+static constexpr const char* StorePath = "/selftest.kv";
+static constexpr const char* CompactPath = "/selftest.kv.new";
+static constexpr uint16_t KeyCount = 40;
+
+// The value of key in a freshly loaded store, or "missing"
+static String reloaded(const char* key)
+{
+    KVStore store(system()->fileSystem(), StorePath);
+    String value;
+    return (store.load() && store.get(key, value)) ? value : String("missing");
+}
+
+void SelfTest::kvStore()
+{
+    FS* fs = system()->fileSystem();
+    fs->remove(StorePath);
+    fs->remove(CompactPath);
+
+    {
+        KVStore store(fs, StorePath);
+        CHECK(store.load() && store.size() == 0);
+
+        CHECK(store.set("a", "1") && store.set("b", "2") && store.set("a", "3"));
+        String value;
+        CHECK(store.get("a", value) && value == "3");
+        CHECK(store.contains("b") && !store.contains("c"));
+        CHECK(store.remove("b") && !store.contains("b") && !store.remove("b"));
+        CHECK(store.size() == 1);
+
+        CHECK(!store.set("", "x") && store.error().code() == Error::Code::InvalidArgumentValue);
+        String longKey;
+        while (longKey.size() < KVStore::MaxKeySize) {
+            longKey += 'k';
+        }
+        CHECK(store.set(longKey.c_str(), "x") && store.remove(longKey.c_str()));
+        longKey += 'k';
+        CHECK(!store.set(longKey.c_str(), "x"));
+
+        // Nothing is written until flush, or the store goes away
+        CHECK(!fs->exists(StorePath));
+        CHECK(store.flush() && fs->exists(StorePath));
+        store.set("unflushed", "u");
+    }
+    CHECK(reloaded("a") == "3");
+    CHECK(reloaded("b") == "missing");
+    CHECK(reloaded("unflushed") == "u");
+
+    // Enough keys that compaction takes several steps, then rewrites of
+    // one key until the log is mostly dead records
+    KVStore store(fs, StorePath);
+    CHECK(store.load());
+    for (uint16_t i = 0; i < KeyCount; ++i) {
+        store.set(String::format("key%u", i).c_str(), String::format("value %u of the selftest", i));
+    }
+    uint16_t rewrites = 0;
+    while (rewrites < 200 && (store.logSize() <= KVStore::CompactMinSize || store.logSize() <= 2 * (store.liveSize() + 8))) {
+        store.set("key0", String::format("rewrite %u", rewrites++));
+        store.flush();
+    }
+    CHECK(rewrites < 200 && store.flush());
+    uint32_t logSize = store.logSize();
+    Vector<char> log;
+    CHECK(readFile(StorePath, log) && log.size() == logSize);
+
+    // Changes made while it's compacting end up in the new log
+    store.runOneIteration();
+    CHECK(store.logSize() == logSize && fs->exists(CompactPath));
+    CHECK(store.set("late", "l") && store.remove("key1"));
+
+    // Together these are more than a Vector holds
+    String big;
+    while (big.size() < KVStore::MaxValueSize) {
+        big += "0123456789abcdef";
+    }
+    bool setBig = true;
+    for (uint8_t i = 0; i < 5; ++i) {
+        setBig = setBig && store.set(String::format("big%u", i).c_str(), big);
+    }
+    CHECK(setBig);
+    for (uint16_t i = 0; i < 200 && fs->exists(CompactPath); ++i) {
+        store.runOneIteration();
+    }
+    CHECK(!fs->exists(CompactPath) && store.error().code() == Error::Code::OK);
+    FS::Info info;
+    CHECK(fs->stat(StorePath, info) && info.size == store.logSize());
+    CHECK(reloaded("late") == "l");
+    CHECK(reloaded("key1") == "missing");
+    CHECK(reloaded("key2") == "value 2 of the selftest");
+    CHECK(reloaded("key0") == String::format("rewrite %u", rewrites - 1));
+    CHECK(reloaded("big0") == big && reloaded("big4") == big);
+    for (uint8_t i = 0; i < 5; ++i) {
+        store.remove(String::format("big%u", i).c_str());
+    }
+
+    // Compacting with nothing changing leaves just the live records
+    CHECK(store.compact());
+    CHECK(store.logSize() == store.liveSize() + 8);
+    CHECK(readFile(StorePath, log) && log.size() == store.logSize());
+    uint16_t count = store.size();
+
+    // A record cut short or damaged at the end is dropped, and the next
+    // flush starts a new log so later records aren't lost behind it
+    CHECK(store.set("tail", "t") && store.flush());
+    CHECK(readFile(StorePath, log));
+    CHECK(writeFile(StorePath, log.begin(), log.size() - 3));
+    CHECK(store.load() && store.size() == count && !store.contains("tail"));
+    CHECK(store.set("after", "a") && store.flush());
+    CHECK(reloaded("after") == "a");
+    CHECK(reloaded("key2") == "value 2 of the selftest");
+
+    CHECK(store.set("tail", "t") && store.flush());
+    CHECK(readFile(StorePath, log));
+    log[log.size() - 5] ^= 0x01;
+    CHECK(writeFile(StorePath, log.begin(), log.size()));
+    CHECK(store.load() && !store.contains("tail") && store.contains("after"));
+
+    // A new log left from losing power while compacting is thrown away
+    CHECK(writeFile(CompactPath, "partial", 7));
+    CHECK(store.load() && store.contains("after") && !fs->exists(CompactPath));
+
+    // A log with a bad header doesn't load, and is replaced on the next flush
+    CHECK(readFile(StorePath, log));
+    log[0] = 'x';
+    CHECK(writeFile(StorePath, log.begin(), log.size()));
+    CHECK(!store.load() && store.error().code() == Error::Code::Corrupted && store.size() == 0);
+    CHECK(store.set("fresh", "f") && store.flush());
+    CHECK(reloaded("fresh") == "f");
+    CHECK(reloaded("after") == "missing");
+
+    fs->remove(StorePath);
+}
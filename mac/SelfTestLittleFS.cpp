@@ -0,0 +1,159 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "SelfTest.h"
+
+using namespace m8r;
+
+// All of file from where it is, or "missing" if it isn't open
+static String readAll(const Mad<File>& file)
+{
+    if (!file.valid() || !file->valid()) {
+        return "missing";
+    }
+    String s;
+    char buf[32];
+    while (true) {
+        int32_t size = file->read(buf, sizeof(buf));
+        if (size <= 0) {
+            break;
+        }
+        s += String(buf, size);
+    }
+    return s;
+}
+
+void SelfTest::handleCache()
+{
+    CHECK(writeFile("/cached", "first", 5, _fs));
+
+    // A released Read handle is rewound and handed out again
+    Mad<File> file = _fs->open("/cached", FS::FileOpenMode::Read);
+    CHECK(readAll(file) == "first");
+    _fs->release(file);
+    Mad<File> again = _fs->open("/cached", FS::FileOpenMode::Read);
+    CHECK(again == file && readAll(again) == "first");
+    
+    // The same path spelled differently finds it too
+    _fs->release(again);
+    again = _fs->open("cached", FS::FileOpenMode::Read);
+    CHECK(again == file && readAll(again) == "first");
+    _fs->release(again);
+
+    // Writing the path closes the cached handle
+    CHECK(writeFile("/cached", "second", 6, _fs));
+    file = _fs->open("/cached", FS::FileOpenMode::Read);
+    CHECK(readAll(file) == "second");
+
+    // A handle that's checked out when the path is written still has the
+    // old file, so it isn't cached when it's released
+    CHECK(writeFile("/cached", "third!!", 7, _fs));
+    _fs->release(file);
+    file = _fs->open("/cached", FS::FileOpenMode::Read);
+    CHECK(readAll(file) == "third!!");
+
+    CHECK(_fs->remove("/cached"));
+    _fs->release(file);
+    file = _fs->open("/cached", FS::FileOpenMode::Read);
+    CHECK(!file->valid() && file->error().code() == Error::Code::FileNotFound);
+    _fs->release(file);
+
+    CHECK(writeFile("/cached", "old", 3, _fs));
+    CHECK(writeFile("/renamed", "new", 3, _fs));
+    file = _fs->open("/cached", FS::FileOpenMode::Read);
+    CHECK(_fs->remove("/cached") && _fs->rename("/renamed", "/cached"));
+    _fs->release(file);
+    file = _fs->open("/cached", FS::FileOpenMode::Read);
+    CHECK(readAll(file) == "new");
+    _fs->release(file);
+
+    // Each open Read handle is separate, and more than fit in the cache
+    // are closed when released
+    CHECK(writeFile("/cached2", "two", 3, _fs));
+    CHECK(writeFile("/cached3", "three", 5, _fs));
+    Mad<File> one = _fs->open("/cached", FS::FileOpenMode::Read);
+    Mad<File> two = _fs->open("/cached2", FS::FileOpenMode::Read);
+    Mad<File> three = _fs->open("/cached3", FS::FileOpenMode::Read);
+    CHECK(readAll(one) == "new" && readAll(two) == "two" && readAll(three) == "three");
+    _fs->release(one);
+    _fs->release(two);
+    _fs->release(three);
+    Mad<File> reopened = _fs->open("/cached", FS::FileOpenMode::Read);
+    CHECK(readAll(reopened) == "new");
+    _fs->release(reopened);
+
+    // With the cache off, everything still reads
+    _fs->setHandleCacheSize(0);
+    CHECK(writeFile("/cached", "off", 3, _fs));
+    file = _fs->open("/cached", FS::FileOpenMode::Read);
+    CHECK(readAll(file) == "off");
+    _fs->release(file);
+    _fs->setHandleCacheSize(LittleFS::DefaultHandleCacheSize);
+
+    _fs->remove("/cached");
+    _fs->remove("/cached2");
+    _fs->remove("/cached3");
+}
+
+void SelfTest::statCache()
+{
+    FS::Info info;
+    _fs->remove("/stat");
+
+    // Misses are cached too, and dropped when the path is made
+    CHECK(!_fs->exists("/stat") && !_fs->stat("/stat", info));
+    CHECK(writeFile("/stat", "12345", 5, _fs));
+    CHECK(_fs->exists("/stat") && _fs->stat("/stat", info) && !info.directory && info.size == 5);
+    CHECK(_fs->exists("stat") && _fs->exists("/stat/"));
+
+    CHECK(writeFile("/stat", "1234567890", 10, _fs));
+    CHECK(_fs->stat("stat", info) && info.size == 10);
+
+    // Opening for Read remembers what it found
+    Mad<File> file = _fs->open("/nothing", FS::FileOpenMode::Read);
+    CHECK(!file->valid() && file->error().code() == Error::Code::FileNotFound);
+    _fs->release(file);
+    CHECK(!_fs->exists("/nothing"));
+    file = _fs->open("/nothing", FS::FileOpenMode::Read);
+    CHECK(!file->valid() && file->error().code() == Error::Code::FileNotFound);
+    _fs->release(file);
+
+    CHECK(_fs->remove("/stat") && !_fs->exists("/stat"));
+
+    // Directories, and renaming one takes the paths under it along
+    CHECK(_fs->makeDirectory("/statdir/sub"));
+    CHECK(writeFile("/statdir/sub/f", "f", 1, _fs));
+    CHECK(_fs->stat("/statdir/sub", info) && info.directory);
+    CHECK(_fs->exists("/statdir/sub/f"));
+    file = _fs->open("/statdir/sub", FS::FileOpenMode::Read);
+    CHECK(!file->valid() && file->error().code() == Error::Code::NotAFile);
+    _fs->release(file);
+
+    CHECK(_fs->rename("/statdir", "/statdir2"));
+    CHECK(!_fs->exists("/statdir/sub/f") && !_fs->exists("/statdir"));
+    CHECK(_fs->exists("/statdir2/sub/f") && _fs->stat("/statdir2/sub", info) && info.directory);
+
+    // More paths than the cache holds all still answer correctly
+    bool allFound = true;
+    for (uint8_t i = 0; i < LittleFS::StatCacheSize + 4; ++i) {
+        String name = String::format("/statdir2/f%u", i);
+        writeFile(name.c_str(), "x", 1, _fs);
+    }
+    for (uint8_t i = 0; i < LittleFS::StatCacheSize + 4; ++i) {
+        String name = String::format("/statdir2/f%u", i);
+        allFound = allFound && _fs->exists(name.c_str()) && _fs->stat(name.c_str(), info) && info.size == 1;
+        _fs->remove(name.c_str());
+        allFound = allFound && !_fs->exists(name.c_str());
+    }
+    CHECK(allFound);
+
+    _fs->remove("/statdir2/sub/f");
+    _fs->remove("/statdir2/sub");
+    _fs->remove("/statdir2");
+}
@@ -0,0 +1,131 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "SelfTest.h"
+
+#include "FileStream.h"
+#include "Scanner.h"
+#include "StringStream.h"
+#include "SystemInterface.h"
+
+using namespace m8r;
+
+// Append a token and its value to tokens, one per line
+static void describe(String& tokens, Token token, const Scanner::TokenType& value)
+{
+    switch (token) {
+        case Token::String:
+        case Token::Identifier:
+            tokens += String::format("%02x '%s'\n", static_cast<uint8_t>(token), String(value.str, value.length).c_str());
+            break;
+        case Token::Integer:
+            tokens += String::format("%02x %u\n", static_cast<uint8_t>(token), value.integer);
+            break;
+        case Token::Float:
+            tokens += String::format("%02x %g\n", static_cast<uint8_t>(token), value.number);
+            break;
+        default:
+            tokens += String::format("%02x\n", static_cast<uint8_t>(token));
+            break;
+    }
+}
+
+// Scan everything from the scanner's stream
+static String scanStream(Scanner& scanner)
+{
+    String tokens;
+    while (true) {
+        Token token = scanner.getToken();
+        describe(tokens, token, scanner.getTokenValue());
+        if (token == Token::EndOfFile || token == Token::Error) {
+            break;
+        }
+        scanner.retireToken();
+    }
+    tokens += String::format("line %u\n", scanner.lineno());
+    return tokens;
+}
+
+// Scan input fed in chunks of chunkSize, feeding the next chunk each time
+// the scanner says it needs one
+static String scanPushed(const char* input, uint32_t chunkSize)
+{
+    Scanner scanner;
+    uint32_t size = static_cast<uint32_t>(strlen(input));
+    uint32_t offset = 0;
+    String tokens;
+    
+    // Every chunk ends at most one Incomplete token, so this is plenty
+    for (uint32_t i = 0; i < size * 4 + 16; ++i) {
+        Token token = scanner.getToken();
+        if (token == Token::Incomplete) {
+            if (offset < size) {
+                uint32_t n = std::min(chunkSize, size - offset);
+                scanner.feed(input + offset, n);
+                offset += n;
+            } else {
+                scanner.finish();
+            }
+            continue;
+        }
+        describe(tokens, token, scanner.getTokenValue());
+        if (token == Token::EndOfFile || token == Token::Error) {
+            tokens += String::format("line %u\n", scanner.lineno());
+            return tokens;
+        }
+        scanner.retireToken();
+    }
+    return "did not finish";
+}
+
+void SelfTest::scannerPush()
+{
+    // Tokens longer than BufferSize cross refills and chunk boundaries
+    String input =
+        "{\n  \"name\": \"m8r\\tscript\", 'single': 'q',\n"
+        "  \"list\": [1, 2.5, -3, 1e3, 0x1f, .5],\n"
+        "  \"flags\": [true, false, null, undefined], identifier_name: $x,\n"
+        "  // a comment\n"
+        "  \"escapes\": \"a\\\"b\\\\c\\u0041\",\n"
+        "  \"long\": \"";
+    for (uint16_t i = 0; i < Scanner::BufferSize * 3; ++i) {
+        input += static_cast<char>('a' + i % 26);
+    }
+    input += "\"\n}\n";
+
+    StringStream stringStream(input.c_str());
+    Scanner fromString(&stringStream);
+    String expected = scanStream(fromString);
+    CHECK(expected.size() > 100);
+    CHECK(strstr(expected.c_str(), "8e\nline 9\n") != nullptr);
+
+    // A stream without span() is read a block at a time and gives the same tokens
+    CHECK(writeFile("/scan", input.c_str(), input.size()));
+    Mad<File> file = system()->fileSystem()->open("/scan", FS::FileOpenMode::Read);
+    {
+        FileStream fileStream(file, 0);
+        Scanner fromFile(&fileStream);
+        CHECK(scanStream(fromFile) == expected);
+    }
+    system()->fileSystem()->release(file);
+
+    // Any split into chunks gives the same tokens and line count
+    static const uint32_t ChunkSizes[] = { 1, 2, 3, 7, 16, 63, 64, 65, 1000 };
+    for (uint32_t chunkSize : ChunkSizes) {
+        String pushed = scanPushed(input.c_str(), chunkSize);
+        if (!CHECK(pushed == expected)) {
+            system()->printf("    with chunks of %u\n", chunkSize);
+        }
+    }
+
+    // A number or identifier at the very end needs finish() to end it
+    CHECK(scanPushed("12", 1) == "8a 12\n8e\nline 1\n");
+    CHECK(scanPushed("abc", 2) == "88 'abc'\n8e\nline 1\n");
+    CHECK(scanPushed("", 1) == "8e\nline 1\n");
+}
@@ -0,0 +1,193 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "SimulatedFlash.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace m8r;
+
+// Sleeps shorter than this are saved up, so small ops add up correctly
+static constexpr uint64_t MinSleepNs = 1000000;
+
+SimulatedFlash& SimulatedFlash::shared()
+{
+    static SimulatedFlash flash;
+    return flash;
+}
+
+void SimulatedFlash::attach(uint8_t* storage, uint32_t size, uint32_t blockSize)
+{
+    _storage = storage;
+    _blockSize = blockSize;
+    _blockCount = blockSize ? size / blockSize : 0;
+    _eraseCounts.resize(static_cast<uint16_t>(_blockCount));
+    resetEraseCounts();
+}
+
+int SimulatedFlash::read(uint32_t block, uint32_t off, void* buffer, uint32_t size)
+{
+    if (!inRange(block, off, size)) {
+        return LFS_ERR_INVAL;
+    }
+
+    int error;
+    if (injectedFailure(Op::Read, error)) {
+        return error;
+    }
+
+    memcpy(buffer, _storage + block * _blockSize + off, size);
+    spend(uint64_t(_timing.readOpUs) * 1000 + uint64_t(_timing.readByteNs) * size);
+    return LFS_ERR_OK;
+}
+
+int SimulatedFlash::prog(uint32_t block, uint32_t off, const void* buffer, uint32_t size)
+{
+    if (!inRange(block, off, size)) {
+        return LFS_ERR_INVAL;
+    }
+
+    int error;
+    if (injectedFailure(Op::Prog, error)) {
+        return error;
+    }
+    if (isBad(block)) {
+        return LFS_ERR_CORRUPT;
+    }
+
+    // A torn prog only gets half way
+    uint32_t count = _powerLost ? size / 2 : size;
+
+    uint8_t* dst = _storage + block * _blockSize + off;
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(buffer);
+    bool violation = false;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (src[i] & ~dst[i]) {
+            violation = true;
+        }
+        dst[i] &= src[i];
+    }
+    if (violation) {
+        ++_progViolations;
+    }
+
+    spend(uint64_t(_timing.progOpUs) * 1000 + uint64_t(_timing.progByteNs) * count);
+    return _powerLost ? LFS_ERR_IO : LFS_ERR_OK;
+}
+
+int SimulatedFlash::erase(uint32_t block)
+{
+    if (!inRange(block, 0, _blockSize)) {
+        return LFS_ERR_INVAL;
+    }
+
+    int error;
+    if (injectedFailure(Op::Erase, error)) {
+        return error;
+    }
+    if (isBad(block)) {
+        return LFS_ERR_CORRUPT;
+    }
+
+    // A torn erase only gets half way
+    uint32_t count = _powerLost ? _blockSize / 2 : _blockSize;
+
+    memset(_storage + block * _blockSize, 0xff, count);
+    ++_eraseCounts[static_cast<uint16_t>(block)];
+
+    uint32_t sectors = (count + SectorSize - 1) / SectorSize;
+    spend(uint64_t(_timing.eraseSectorUs) * 1000 * sectors);
+    return _powerLost ? LFS_ERR_IO : LFS_ERR_OK;
+}
+
+uint32_t SimulatedFlash::maxEraseCount() const
+{
+    return _eraseCounts.empty() ? 0 : *std::max_element(_eraseCounts.begin(), _eraseCounts.end());
+}
+
+void SimulatedFlash::resetEraseCounts()
+{
+    std::fill(_eraseCounts.begin(), _eraseCounts.end(), 0);
+}
+
+void SimulatedFlash::failAfter(Op op, uint32_t count, int error)
+{
+    _failCountdown[static_cast<int>(op)] = static_cast<int32_t>(count);
+    _failError[static_cast<int>(op)] = error;
+}
+
+void SimulatedFlash::setBadBlock(uint32_t block, bool bad)
+{
+    auto it = std::find(_badBlocks.begin(), _badBlocks.end(), block);
+    if (bad && it == _badBlocks.end()) {
+        _badBlocks.push_back(block);
+    } else if (!bad && it != _badBlocks.end()) {
+        _badBlocks.erase(it);
+    }
+}
+
+void SimulatedFlash::powerLossAfter(uint32_t count)
+{
+    _powerLossCountdown = static_cast<int32_t>(count);
+}
+
+void SimulatedFlash::clearFailures()
+{
+    for (int i = 0; i < 3; ++i) {
+        _failCountdown[i] = -1;
+    }
+    _powerLossCountdown = -1;
+    _powerLost = false;
+    _badBlocks.clear();
+}
+
+bool SimulatedFlash::injectedFailure(Op op, int& error)
+{
+    // Once power is lost the device doesn't respond
+    if (_powerLost) {
+        error = LFS_ERR_IO;
+        return true;
+    }
+
+    // Countdown to a torn write. When it gets there _powerLost is set and
+    // the caller does half of the op
+    if (op != Op::Read && _powerLossCountdown >= 0 && _powerLossCountdown-- == 0) {
+        _powerLost = true;
+    }
+
+    int32_t& countdown = _failCountdown[static_cast<int>(op)];
+    if (countdown >= 0 && countdown-- == 0) {
+        error = _failError[static_cast<int>(op)];
+        return true;
+    }
+    return false;
+}
+
+bool SimulatedFlash::isBad(uint32_t block) const
+{
+    return std::find(_badBlocks.begin(), _badBlocks.end(), block) != _badBlocks.end();
+}
+
+void SimulatedFlash::spend(uint64_t ns)
+{
+    if (_clock == Clock::None) {
+        return;
+    }
+
+    _elapsedNs += ns;
+
+    if (_clock == Clock::Sleep) {
+        _sleepNs += ns;
+        if (_sleepNs >= MinSleepNs) {
+            Duration(static_cast<int64_t>(_sleepNs / 1000)).sleep();
+            _sleepNs = 0;
+        }
+    }
+}
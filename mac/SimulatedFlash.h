@@ -0,0 +1,124 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Containers.h"
+#include "MLittleFS.h"
+#include "SystemTime.h"
+
+namespace m8r {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: SimulatedFlash
+//
+//  The host block device behind LittleFS. It works on the mapped image and
+//  acts like NOR flash: a prog can only clear bits, and only an erase sets
+//  them again. Each operation can cost time, either by sleeping or by
+//  adding to a virtual clock. Erases are counted per block. Failures can
+//  be injected: a one time error, bad blocks, and power loss part way
+//  through a write.
+//
+//  With the default Clock::None it costs about as much as a memcpy, so it
+//  is always in place.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class SimulatedFlash {
+public:
+    enum class Op { Read, Prog, Erase };
+
+    // None ignores the timing, Sleep sleeps it, Virtual only adds it to elapsed()
+    enum class Clock { None, Sleep, Virtual };
+
+    static constexpr uint32_t SectorSize = 4096;
+
+    // The defaults are roughly the SPI flash on an ESP8266
+    struct Timing
+    {
+        uint32_t readOpUs = 10;
+        uint32_t readByteNs = 50;
+        uint32_t progOpUs = 20;
+        uint32_t progByteNs = 2700;     // A 256 byte page in about 0.7ms
+        uint32_t eraseSectorUs = 45000;
+    };
+
+    static SimulatedFlash& shared();
+
+    void attach(uint8_t* storage, uint32_t size, uint32_t blockSize);
+    void detach() { attach(nullptr, 0, 0); }
+
+    int read(uint32_t block, uint32_t off, void* buffer, uint32_t size);
+    int prog(uint32_t block, uint32_t off, const void* buffer, uint32_t size);
+    int erase(uint32_t block);
+
+    void setTiming(const Timing& timing) { _timing = timing; }
+    const Timing& timing() const { return _timing; }
+    void setClock(Clock clock) { _clock = clock; }
+    Clock clock() const { return _clock; }
+
+    // Time the operations would have taken on the device, in both Sleep
+    // and Virtual modes
+    Duration elapsed() const { return Duration(static_cast<int64_t>(_elapsedNs / 1000)); }
+    void resetElapsed() { _elapsedNs = 0; _sleepNs = 0; }
+
+    // Progs that tried to set a bit. On a real part the bit stays clear,
+    // which is what happens here too
+    uint32_t progViolations() const { return _progViolations; }
+
+    uint32_t eraseCount(uint32_t block) const { return (block < _eraseCounts.size()) ? _eraseCounts[block] : 0; }
+    uint32_t maxEraseCount() const;
+    void resetEraseCounts();
+
+    // The (count + 1)th op of this type from now fails with error, once
+    void failAfter(Op, uint32_t count, int error = LFS_ERR_IO);
+
+    // Progs and erases on a bad block fail with LFS_ERR_CORRUPT
+    void setBadBlock(uint32_t block, bool bad = true);
+
+    // The (count + 1)th prog or erase from now is torn, leaving half of it
+    // done. Every op after that fails with LFS_ERR_IO, as though the
+    // device were off, until clearFailures()
+    void powerLossAfter(uint32_t count);
+    bool powerLost() const { return _powerLost; }
+
+    void clearFailures();
+
+private:
+    bool inRange(uint32_t block, uint32_t off, uint32_t size) const
+    {
+        return _storage && block < _blockCount && off + size <= _blockSize;
+    }
+
+    bool injectedFailure(Op, int& error);
+    bool isBad(uint32_t block) const;
+    void spend(uint64_t ns);
+
+    uint8_t* _storage = nullptr;
+    uint32_t _blockSize = 0;
+    uint32_t _blockCount = 0;
+
+    Timing _timing;
+    Clock _clock = Clock::None;
+    uint64_t _elapsedNs = 0;
+    uint64_t _sleepNs = 0;
+
+    uint32_t _progViolations = 0;
+    Vector<uint32_t> _eraseCounts;
+
+    // Injected failures. A countdown of -1 is off
+    int32_t _failCountdown[3] = { -1, -1, -1 };
+    int _failError[3] = { 0, 0, 0 };
+    int32_t _powerLossCountdown = -1;
+    bool _powerLost = false;
+    Vector<uint32_t> _badBlocks;
+};
+
+}
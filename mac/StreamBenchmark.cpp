@@ -0,0 +1,172 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#include "StreamBenchmark.h"
+
+#include "FileStream.h"
+#include "Scanner.h"
+#include "SystemInterface.h"
+
+using namespace m8r;
+
+static const uint16_t BufferSizes[] = { 0, 128, 512, 1024, 4096 };
+
+// Stream that makes a File call for every byte
+class UnbufferedStream : public Stream {
+public:
+    UnbufferedStream(Mad<File> file) : _file(file) { }
+
+    virtual int read() const override
+    {
+        char c;
+        return (_file->read(&c, 1) == 1) ? static_cast<uint8_t>(c) : -1;
+    }
+
+    virtual int write(uint8_t c) override
+    {
+        return (_file->write(reinterpret_cast<const char*>(&c), 1) == 1) ? c : -1;
+    }
+
+private:
+    Mad<File> _file;
+};
+
+static uint32_t tokenize(const Stream& stream)
+{
+    Scanner scanner(&stream);
+    uint32_t count = 0;
+    while (scanner.getToken() != Token::EndOfFile) {
+        ++count;
+        scanner.retireToken();
+    }
+    return count;
+}
+
+static bool writeBytes(Stream& stream, const String& s)
+{
+    for (uint32_t i = 0; i < s.size(); ++i) {
+        if (stream.write(static_cast<uint8_t>(s[i])) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+StreamBenchmark::StreamBenchmark(FS* fs, const char* root)
+    : _fs(fs)
+    , _root(root)
+{
+    _path = _root + "/script.m8r";
+    for (uint32_t i = 0; _script.size() < ScriptSize; ++i) {
+        _script += String::format("var item%u = { \"name\": \"value %u\", count: %u };\n", i, i, i * 3);
+    }
+}
+
+StreamBenchmark::~StreamBenchmark()
+{
+    _fs->remove(_path.c_str());
+    _fs->remove(_root.c_str());
+}
+
+void StreamBenchmark::run()
+{
+    _fs->makeDirectory(_root.c_str());
+    for (auto it : BufferSizes) {
+        write(it);
+    }
+    for (auto it : BufferSizes) {
+        load(it);
+    }
+}
+
+void StreamBenchmark::print() const
+{
+    system()->printf("%-8s %8s %8s %10s %8s %6s %8s %8s\n", "workload", "buffer", "bytes", "KB/s", "tokens", "errors", "reads", "progs");
+    for (const auto& it : _results) {
+        system()->printf("%-8s %8u %8u %10.1f %8u %6u %8u %8u\n", it.name, it.bufferSize, it.bytes,
+                         it.bytesPerSecond() / 1024, it.tokens, it.errors, it.reads, it.progs);
+    }
+}
+
+void StreamBenchmark::write(uint16_t bufferSize)
+{
+    begin("write", bufferSize);
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        Mad<File> file = _fs->open(_path.c_str(), FS::FileOpenMode::Write);
+        if (!file->valid()) {
+            ++_current.errors;
+            _fs->release(file);
+            continue;
+        }
+        
+        // FileStream writes out what it holds when it's destroyed, before
+        // the release
+        bool success;
+        if (bufferSize) {
+            FileStream stream(file, bufferSize);
+            success = writeBytes(stream, _script);
+        } else {
+            UnbufferedStream stream(file);
+            success = writeBytes(stream, _script);
+        }
+        if (!success) {
+            ++_current.errors;
+        }
+        _fs->release(file);
+        _current.bytes += static_cast<uint32_t>(_script.size());
+    }
+    end();
+}
+
+void StreamBenchmark::load(uint16_t bufferSize)
+{
+    begin("load", bufferSize);
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        Mad<File> file = _fs->open(_path.c_str(), FS::FileOpenMode::Read);
+        if (!file->valid()) {
+            ++_current.errors;
+            _fs->release(file);
+            continue;
+        }
+        
+        uint32_t tokens;
+        if (bufferSize) {
+            tokens = tokenize(FileStream(file, bufferSize));
+        } else {
+            tokens = tokenize(UnbufferedStream(file));
+        }
+        if (_current.tokens && tokens != _current.tokens) {
+            ++_current.errors;
+        }
+        _current.tokens = tokens;
+        _fs->release(file);
+        _current.bytes += static_cast<uint32_t>(_script.size());
+    }
+    end();
+}
+
+void StreamBenchmark::begin(const char* name, uint16_t bufferSize)
+{
+    _current = Result();
+    _current.name = name;
+    _current.bufferSize = bufferSize;
+    _current.iterations = Iterations;
+    _startFlash = _fs->flashStats();
+    _startTime = Time::now();
+}
+
+void StreamBenchmark::end()
+{
+    _current.elapsed = Time::now() - _startTime;
+
+    FS::FlashStats flash = _fs->flashStats();
+    _current.reads = flash.reads.count - _startFlash.reads.count;
+    _current.progs = flash.progs.count - _startFlash.progs.count;
+    _results.push_back(_current);
+}
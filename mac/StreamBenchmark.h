@@ -0,0 +1,81 @@
+/*-------------------------------------------------------------------------
+    This source file is a part of m8rscript
+    For the latest info, see http:www.marrin.org/
+    Copyright (c) 2018-2019, Chris Marrin
+    All rights reserved.
+    Use of this source code is governed by the MIT license that can be
+    found in the LICENSE file.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Containers.h"
+#include "MFS.h"
+#include "MString.h"
+#include "SystemTime.h"
+
+namespace m8r {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Class: StreamBenchmark
+//
+//  Measures FileStream buffering with the byte at a time access the Scanner
+//  and console output make. A generated script is written one byte at a
+//  time, then loaded by tokenizing it with a Scanner. Each is done with a
+//  stream that makes a File call per byte, which is what FileStream did
+//  before it had a buffer, and with FileStream at several buffer sizes.
+//
+//  The script is written under root, which is removed afterwards.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class StreamBenchmark {
+public:
+    struct Result
+    {
+        const char* name = nullptr;
+        uint16_t bufferSize = 0;    // 0 for a File call per byte
+        uint32_t iterations = 0;
+        uint32_t bytes = 0;
+        uint32_t tokens = 0;        // Per load, 0 for writes
+        uint32_t errors = 0;
+        Duration elapsed;
+        uint32_t reads = 0;         // Block device operations
+        uint32_t progs = 0;
+
+        float bytesPerSecond() const { return elapsed.us() ? float(bytes) * 1000000 / elapsed.us() : 0; }
+    };
+
+    static constexpr uint32_t ScriptSize = 20 * 1024;
+    static constexpr uint32_t Iterations = 5;
+
+    StreamBenchmark(FS*, const char* root = "/streambench");
+    ~StreamBenchmark();
+
+    void run();
+
+    const Vector<Result>& results() const { return _results; }
+
+    // Print the results as a table with system()->printf
+    void print() const;
+
+private:
+    void write(uint16_t bufferSize);
+    void load(uint16_t bufferSize);
+
+    void begin(const char* name, uint16_t bufferSize);
+    void end();
+
+    FS* _fs;
+    String _root;
+    String _path;
+    String _script;
+
+    Vector<Result> _results;
+    Result _current;
+    Time _startTime;
+    FS::FlashStats _startFlash;
+};
+
+}
@@ -10,7 +10,7 @@
 
 #include "Application.h"
 
-static constexpr const char* WebServerRoot = "/sys/bin";
+static constexpr const char* WebServerRoot = "/sys/web";
 static m8r::Duration MainTaskSleepDuration = 10ms;
 
 class Sample : public m8r::Executable
@@ -25,10 +25,8 @@ public:
 
 void m8rmain()
 {
+    // The web UI is built in, see WebAssets in RomFS.h
     m8r::Application application(m8r::Application::HeartbeatType::Status, WebServerRoot, 23);
- 
-     // Upload files needed by web server
-    m8r::Application::uploadFiles({ "web/index.html", "web/favicon.ico" }, WebServerRoot);
 
     application.runAutostartTask(m8r::SharedPtr<Sample>(new Sample()));
 